@@ -36,6 +36,18 @@ typedef NS_ENUM(NSUInteger, GSCXAnalyticsEvent) {
    Analytics event indicating that scan found errors.
    */
   GSCXAnalyticsEventErrorsFound,
+
+  /**
+   Analytics event indicating that a scan was cancelled before checking every element. The count is
+   the number of elements checked.
+   */
+  GSCXAnalyticsEventScanCancelled,
+
+  /**
+   Analytics event indicating that a scan exceeded the scanner's watchdog timeout before checking
+   every element. The count is the number of elements checked.
+   */
+  GSCXAnalyticsEventScanTimedOut,
 };
 
 /**
@@ -45,6 +57,32 @@ typedef NS_ENUM(NSUInteger, GSCXAnalyticsEvent) {
  */
 typedef void(^GSCXAnalyticsHandlerBlock)(GSCXAnalyticsEvent event, NSInteger count);
 
+/**
+ Enum of all timing events measured by GSCXScanner.
+ */
+typedef NS_ENUM(NSUInteger, GSCXAnalyticsTimingEvent) {
+  /**
+   Timing event measuring the time from the user stopping a continuous scan until the first frame
+   of the results is on screen.
+   */
+  GSCXAnalyticsTimingEventContinuousScanResultsFirstFrame,
+
+  /**
+   Timing event measuring the time from the user stopping a continuous scan until all results have
+   been loaded into the results page.
+   */
+  GSCXAnalyticsTimingEventContinuousScanResultsFullyLoaded,
+};
+
+/**
+ Typedef for timing handler.
+
+ @param event The timing event to be handled.
+ @param duration The measured duration, in seconds.
+ */
+typedef void(^GSCXAnalyticsTimingHandlerBlock)(GSCXAnalyticsTimingEvent event,
+                                               NSTimeInterval duration);
+
 /**
  Class that handles all analytics in GSCXScanner.
 
@@ -65,6 +103,12 @@ typedef void(^GSCXAnalyticsHandlerBlock)(GSCXAnalyticsEvent event, NSInteger cou
  */
 @property (class, nonatomic) GSCXAnalyticsHandlerBlock handler;
 
+/**
+ Current timing handler. Default is a no-op block and all timing events are ignored. Timing events
+ are only delivered if @c enabled is @c YES.
+ */
+@property (class, nonatomic) GSCXAnalyticsTimingHandlerBlock timingHandler;
+
 /**
  Feeds an analytics event to be handled.
 
@@ -73,6 +117,14 @@ typedef void(^GSCXAnalyticsHandlerBlock)(GSCXAnalyticsEvent event, NSInteger cou
  */
 + (void)invokeAnalyticsEvent:(GSCXAnalyticsEvent)event count:(NSInteger)count;
 
+/**
+ Feeds a timing event to be handled.
+
+ @param event The timing event to be handled.
+ @param duration The measured duration, in seconds.
+ */
++ (void)invokeTimingEvent:(GSCXAnalyticsTimingEvent)event duration:(NSTimeInterval)duration;
+
 @end
 
 NS_ASSUME_NONNULL_END
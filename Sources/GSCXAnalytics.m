@@ -26,6 +26,11 @@ static BOOL gEnabled = NO;
  */
 static GSCXAnalyticsHandlerBlock gHandler;
 
+/**
+ Storage for GSCXAnalytics.timingHandler property.
+ */
+static GSCXAnalyticsTimingHandlerBlock gTimingHandler;
+
 #pragma mark - Implementation
 
 @implementation GSCXAnalytics
@@ -35,6 +40,9 @@ static GSCXAnalyticsHandlerBlock gHandler;
   gHandler = ^(GSCXAnalyticsEvent event, NSInteger count) {
     // Pass.
   };
+  gTimingHandler = ^(GSCXAnalyticsTimingEvent event, NSTimeInterval duration) {
+    // Pass.
+  };
 }
 
 + (void)setHandler:(GSCXAnalyticsHandlerBlock)handler {
@@ -46,6 +54,15 @@ static GSCXAnalyticsHandlerBlock gHandler;
   return gHandler;
 }
 
++ (void)setTimingHandler:(GSCXAnalyticsTimingHandlerBlock)timingHandler {
+  NSParameterAssert(timingHandler);
+  gTimingHandler = timingHandler;
+}
+
++ (GSCXAnalyticsTimingHandlerBlock)timingHandler {
+  return gTimingHandler;
+}
+
 + (void)setEnabled:(BOOL)enabled {
   gEnabled = enabled;
 }
@@ -60,4 +77,10 @@ static GSCXAnalyticsHandlerBlock gHandler;
   }
 }
 
++ (void)invokeTimingEvent:(GSCXAnalyticsTimingEvent)event duration:(NSTimeInterval)duration {
+  if (self.enabled) {
+    self.timingHandler(event, duration);
+  }
+}
+
 @end
@@ -0,0 +1,104 @@
+//
+// Copyright 2018 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import <UIKit/UIKit.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Memoizes the accessibility attributes of elements for the duration of a scan. Many attributes
+ * are computed on every access, some from localization tables, and every check reads them again.
+ * Each attribute of each element is read from the element on first access and returned from the
+ * cache afterwards, so checks reading attributes through the current cache share them. Elements
+ * are compared by pointer. Must only be used on the main thread.
+ */
+@interface GSCXAttributeCache : NSObject
+
+/**
+ * The number of attribute reads answered from the cache since it was created or reset.
+ */
+@property(assign, nonatomic, readonly) NSUInteger hitCount;
+
+/**
+ * The number of attribute reads that had to query the element since it was created or reset.
+ */
+@property(assign, nonatomic, readonly) NSUInteger missCount;
+
+/**
+ * @return The cache of the scan in progress, or @c nil if no scan is in progress. Checks can read
+ *  attributes through it to share them with other checks.
+ */
++ (nullable GSCXAttributeCache *)currentCache;
+
+/**
+ * Sets the cache returned by @c currentCache. Scanners set it when a scan begins and restore the
+ * previous cache when the scan ends, so a scan started while another is in progress does not clear
+ * the outer scan's cache.
+ *
+ * @param cache The cache of the scan beginning, or the previous cache when the scan ends.
+ */
++ (void)setCurrentCache:(nullable GSCXAttributeCache *)cache;
+
+/**
+ * @param element The element to read.
+ * @return The element's @c accessibilityLabel.
+ */
+- (nullable NSString *)accessibilityLabelOfElement:(id)element;
+
+/**
+ * @param element The element to read.
+ * @return The element's @c accessibilityValue.
+ */
+- (nullable NSString *)accessibilityValueOfElement:(id)element;
+
+/**
+ * @param element The element to read.
+ * @return The element's @c accessibilityHint.
+ */
+- (nullable NSString *)accessibilityHintOfElement:(id)element;
+
+/**
+ * @param element The element to read.
+ * @return The element's @c accessibilityIdentifier, or @c nil if it does not have one.
+ */
+- (nullable NSString *)accessibilityIdentifierOfElement:(id)element;
+
+/**
+ * @param element The element to read.
+ * @return The element's @c accessibilityTraits.
+ */
+- (UIAccessibilityTraits)accessibilityTraitsOfElement:(id)element;
+
+/**
+ * @param element The element to read.
+ * @return The element's @c accessibilityFrame.
+ */
+- (CGRect)accessibilityFrameOfElement:(id)element;
+
+/**
+ * @param element The element to read.
+ * @return The element's @c isAccessibilityElement.
+ */
+- (BOOL)isAccessibilityElement:(id)element;
+
+/**
+ * Forgets every cached attribute and resets @c hitCount and @c missCount.
+ */
+- (void)reset;
+
+@end
+
+NS_ASSUME_NONNULL_END
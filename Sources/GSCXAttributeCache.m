@@ -0,0 +1,170 @@
+//
+// Copyright 2018 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXAttributeCache.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * The attributes memoized by @c GSCXAttributeCache.
+ */
+typedef NS_ENUM(NSInteger, GSCXAttributeCacheAttribute) {
+  GSCXAttributeCacheAttributeLabel,
+  GSCXAttributeCacheAttributeValue,
+  GSCXAttributeCacheAttributeHint,
+  GSCXAttributeCacheAttributeIdentifier,
+  GSCXAttributeCacheAttributeTraits,
+  GSCXAttributeCacheAttributeFrame,
+  GSCXAttributeCacheAttributeIsAccessibilityElement,
+};
+
+/**
+ * The cache of the scan in progress.
+ */
+static GSCXAttributeCache *gCurrentCache;
+
+@interface GSCXAttributeCache ()
+
+/**
+ * The attributes read from each element, keyed by attribute. @c nil attributes are stored as
+ * @c NSNull.
+ */
+@property(strong, nonatomic) NSMapTable<id, NSMutableDictionary<NSNumber *, id> *> *attributes;
+
+@end
+
+@implementation GSCXAttributeCache
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    NSPointerFunctionsOptions pointerOptions =
+        NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality;
+    _attributes = [[NSMapTable alloc] initWithKeyOptions:pointerOptions
+                                            valueOptions:NSPointerFunctionsStrongMemory
+                                                capacity:0];
+  }
+  return self;
+}
+
++ (nullable GSCXAttributeCache *)currentCache {
+  return gCurrentCache;
+}
+
++ (void)setCurrentCache:(nullable GSCXAttributeCache *)cache {
+  gCurrentCache = cache;
+}
+
+- (nullable NSString *)accessibilityLabelOfElement:(id)element {
+  return [self gscx_valueOfAttribute:GSCXAttributeCacheAttributeLabel forElement:element];
+}
+
+- (nullable NSString *)accessibilityValueOfElement:(id)element {
+  return [self gscx_valueOfAttribute:GSCXAttributeCacheAttributeValue forElement:element];
+}
+
+- (nullable NSString *)accessibilityHintOfElement:(id)element {
+  return [self gscx_valueOfAttribute:GSCXAttributeCacheAttributeHint forElement:element];
+}
+
+- (nullable NSString *)accessibilityIdentifierOfElement:(id)element {
+  return [self gscx_valueOfAttribute:GSCXAttributeCacheAttributeIdentifier forElement:element];
+}
+
+- (UIAccessibilityTraits)accessibilityTraitsOfElement:(id)element {
+  NSNumber *traits = [self gscx_valueOfAttribute:GSCXAttributeCacheAttributeTraits
+                                      forElement:element];
+  return [traits unsignedLongLongValue];
+}
+
+- (CGRect)accessibilityFrameOfElement:(id)element {
+  NSValue *frame = [self gscx_valueOfAttribute:GSCXAttributeCacheAttributeFrame
+                                    forElement:element];
+  return [frame CGRectValue];
+}
+
+- (BOOL)isAccessibilityElement:(id)element {
+  NSNumber *isAccessibilityElement =
+      [self gscx_valueOfAttribute:GSCXAttributeCacheAttributeIsAccessibilityElement
+                       forElement:element];
+  return [isAccessibilityElement boolValue];
+}
+
+- (void)reset {
+  [self.attributes removeAllObjects];
+  _hitCount = 0;
+  _missCount = 0;
+}
+
+#pragma mark - Private
+
+/**
+ * Returns an attribute of @c element, reading it from the element only if it is not cached.
+ *
+ * @param attribute The attribute to return.
+ * @param element The element to read.
+ * @return The attribute, boxed if it is not an object, or @c nil if it is @c nil.
+ */
+- (nullable id)gscx_valueOfAttribute:(GSCXAttributeCacheAttribute)attribute
+                          forElement:(id)element {
+  NSMutableDictionary<NSNumber *, id> *elementAttributes = [self.attributes objectForKey:element];
+  if (elementAttributes == nil) {
+    elementAttributes = [[NSMutableDictionary alloc] init];
+    [self.attributes setObject:elementAttributes forKey:element];
+  }
+  id value = elementAttributes[@(attribute)];
+  if (value != nil) {
+    _hitCount++;
+  } else {
+    _missCount++;
+    value = [GSCXAttributeCache gscx_readAttribute:attribute ofElement:element] ?: [NSNull null];
+    elementAttributes[@(attribute)] = value;
+  }
+  return value == [NSNull null] ? nil : value;
+}
+
+/**
+ * Reads an attribute directly from @c element.
+ *
+ * @param attribute The attribute to read.
+ * @param element The element to read.
+ * @return The attribute, boxed if it is not an object, or @c nil if it is @c nil.
+ */
++ (nullable id)gscx_readAttribute:(GSCXAttributeCacheAttribute)attribute ofElement:(id)element {
+  switch (attribute) {
+    case GSCXAttributeCacheAttributeLabel:
+      return [[element accessibilityLabel] copy];
+    case GSCXAttributeCacheAttributeValue:
+      return [[element accessibilityValue] copy];
+    case GSCXAttributeCacheAttributeHint:
+      return [[element accessibilityHint] copy];
+    case GSCXAttributeCacheAttributeIdentifier:
+      if (![element respondsToSelector:@selector(accessibilityIdentifier)]) {
+        return nil;
+      }
+      return [[element accessibilityIdentifier] copy];
+    case GSCXAttributeCacheAttributeTraits:
+      return @([element accessibilityTraits]);
+    case GSCXAttributeCacheAttributeFrame:
+      return [NSValue valueWithCGRect:[element accessibilityFrame]];
+    case GSCXAttributeCacheAttributeIsAccessibilityElement:
+      return @([element isAccessibilityElement]);
+  }
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
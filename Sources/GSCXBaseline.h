@@ -0,0 +1,115 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import <UIKit/UIKit.h>
+
+#import <GTXiLib/GTXiLib.h>
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * A set of known issues that scans should not report. Issues are identified by fingerprints that
+ * stay the same across scans, launches and devices wherever possible: the check name, the element's
+ * class, and its accessibility identifier or, if it has none, its accessibility label. Only
+ * elements with neither fall back to their frame. Baseline files contain one hexadecimal
+ * fingerprint per line. Empty lines and lines starting with @c # are ignored.
+ */
+@interface GSCXBaseline : NSObject
+
+/**
+ * The number of fingerprints in the baseline.
+ */
+@property(assign, nonatomic, readonly) NSUInteger count;
+
+/**
+ * Initializes a baseline containing @c fingerprints.
+ *
+ * @param fingerprints Fingerprints as returned by
+ *  @c fingerprintForCheckResult:elementReference:.
+ * @return An initialized @c GSCXBaseline instance.
+ */
+- (instancetype)initWithFingerprints:(NSSet<NSString *> *)fingerprints NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Reads a baseline file.
+ *
+ * @param url The baseline file to read.
+ * @param error Set if the file cannot be read.
+ * @return The baseline, or @c nil if the file could not be read.
+ */
++ (nullable instancetype)baselineWithContentsOfURL:(NSURL *)url error:(NSError **)error;
+
+/**
+ * Constructs a baseline containing every issue in @c results and every issue already in this
+ * baseline. Issues filtered by this baseline never appear in results, so they must be carried over
+ * to keep being suppressed.
+ *
+ * @param results The results whose issues are added.
+ * @return A new baseline.
+ */
+- (GSCXBaseline *)baselineByAddingResults:(NSArray<GTXHierarchyResultCollection *> *)results;
+
+/**
+ * Writes this baseline to a file, one fingerprint per line in sorted order, so baselines can be
+ * checked in and diffed.
+ *
+ * @param url The file to write.
+ * @param error Set if the file cannot be written.
+ * @return @c YES if the file was written, @c NO otherwise.
+ */
+- (BOOL)writeToURL:(NSURL *)url error:(NSError **)error;
+
+/**
+ * @param checkResult A failing check.
+ * @param elementReference The element failing @c checkResult.
+ * @return @c YES if the issue is in the baseline, @c NO otherwise.
+ */
+- (BOOL)containsCheckResult:(GTXCheckResult *)checkResult
+           elementReference:(GTXElementReference *)elementReference;
+
+/**
+ * Removes issues in the baseline from @c elementResults.
+ *
+ * @param elementResults The element results to filter.
+ * @return The element results with baseline issues removed. Elements with no remaining issues are
+ *  removed. @c elementResults itself if no issues were removed.
+ */
+- (NSArray<GTXElementResultCollection *> *)elementResultsByRemovingBaselineIssues:
+    (NSArray<GTXElementResultCollection *> *)elementResults;
+
+/**
+ * Computes the fingerprint of an issue. Fingerprints compare issues across launches and devices:
+ * they identify baseline issues and match issues between sessions in @c GSCXSessionDiff. Within a
+ * session, issues are compared by @c GSCXIssueDeduplicator.issueKeyForCheckResult:elementReference:
+ * instead, which also uses the element's frame.
+ *
+ * @param checkResult A failing check.
+ * @param elementReference The element failing @c checkResult.
+ * @return The fingerprint of the issue, a 16 character hexadecimal string.
+ */
++ (NSString *)fingerprintForCheckResult:(GTXCheckResult *)checkResult
+                       elementReference:(GTXElementReference *)elementReference;
+
+/**
+ * @return The default location of baselines written from the scanner menu, in the application's
+ *  Documents directory so it can be retrieved with the Files app or Xcode.
+ */
++ (NSURL *)defaultURL;
+
+@end
+
+NS_ASSUME_NONNULL_END
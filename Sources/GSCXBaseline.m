@@ -0,0 +1,170 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXBaseline.h"
+
+#import "GSCXUtils.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * The first line of baseline files written by @c GSCXBaseline.
+ */
+static NSString *const kGSCXBaselineFileHeader =
+    @"# GSCXScanner baseline. One issue fingerprint per line.";
+
+@interface GSCXBaseline ()
+
+/**
+ * The fingerprints of all issues in the baseline.
+ */
+@property(copy, nonatomic) NSSet<NSString *> *fingerprints;
+
+@end
+
+@implementation GSCXBaseline
+
+- (instancetype)initWithFingerprints:(NSSet<NSString *> *)fingerprints {
+  self = [super init];
+  if (self) {
+    _fingerprints = [fingerprints copy];
+  }
+  return self;
+}
+
++ (nullable instancetype)baselineWithContentsOfURL:(NSURL *)url error:(NSError **)error {
+  NSString *contents = [NSString stringWithContentsOfURL:url
+                                                encoding:NSUTF8StringEncoding
+                                                   error:error];
+  if (contents == nil) {
+    return nil;
+  }
+  NSMutableSet<NSString *> *fingerprints = [[NSMutableSet alloc] init];
+  NSCharacterSet *whitespace = [NSCharacterSet whitespaceCharacterSet];
+  NSArray<NSString *> *lines =
+      [contents componentsSeparatedByCharactersInSet:[NSCharacterSet newlineCharacterSet]];
+  for (NSString *line in lines) {
+    NSString *fingerprint = [[line stringByTrimmingCharactersInSet:whitespace] lowercaseString];
+    if (fingerprint.length == 0 || [fingerprint hasPrefix:@"#"]) {
+      continue;
+    }
+    [fingerprints addObject:fingerprint];
+  }
+  return [[GSCXBaseline alloc] initWithFingerprints:fingerprints];
+}
+
+- (NSUInteger)count {
+  return self.fingerprints.count;
+}
+
+- (GSCXBaseline *)baselineByAddingResults:(NSArray<GTXHierarchyResultCollection *> *)results {
+  NSMutableSet<NSString *> *fingerprints = [self.fingerprints mutableCopy];
+  for (GTXHierarchyResultCollection *result in results) {
+    for (GTXElementResultCollection *elementResult in result.elementResults) {
+      for (GTXCheckResult *checkResult in elementResult.checkResults) {
+        [fingerprints
+            addObject:[GSCXBaseline fingerprintForCheckResult:checkResult
+                                             elementReference:elementResult.elementReference]];
+      }
+    }
+  }
+  return [[GSCXBaseline alloc] initWithFingerprints:fingerprints];
+}
+
+- (BOOL)writeToURL:(NSURL *)url error:(NSError **)error {
+  NSArray<NSString *> *lines =
+      [[self.fingerprints allObjects] sortedArrayUsingSelector:@selector(compare:)];
+  NSString *contents =
+      [NSString stringWithFormat:@"%@\n%@\n", kGSCXBaselineFileHeader,
+                                 [lines componentsJoinedByString:@"\n"]];
+  return [contents writeToURL:url atomically:YES encoding:NSUTF8StringEncoding error:error];
+}
+
+- (BOOL)containsCheckResult:(GTXCheckResult *)checkResult
+           elementReference:(GTXElementReference *)elementReference {
+  if (self.fingerprints.count == 0) {
+    return NO;
+  }
+  return [self.fingerprints
+      containsObject:[GSCXBaseline fingerprintForCheckResult:checkResult
+                                            elementReference:elementReference]];
+}
+
+- (NSArray<GTXElementResultCollection *> *)elementResultsByRemovingBaselineIssues:
+    (NSArray<GTXElementResultCollection *> *)elementResults {
+  if (self.fingerprints.count == 0) {
+    return elementResults;
+  }
+  NSMutableArray<GTXElementResultCollection *> *filteredElementResults =
+      [[NSMutableArray alloc] initWithCapacity:elementResults.count];
+  BOOL removedIssues = NO;
+  for (GTXElementResultCollection *elementResult in elementResults) {
+    NSMutableArray<GTXCheckResult *> *checkResults = [[NSMutableArray alloc] init];
+    for (GTXCheckResult *checkResult in elementResult.checkResults) {
+      if (![self containsCheckResult:checkResult
+                    elementReference:elementResult.elementReference]) {
+        [checkResults addObject:checkResult];
+      }
+    }
+    if (checkResults.count == elementResult.checkResults.count) {
+      [filteredElementResults addObject:elementResult];
+      continue;
+    }
+    removedIssues = YES;
+    if (checkResults.count > 0) {
+      [filteredElementResults
+          addObject:[[GTXElementResultCollection alloc]
+                        initWithElement:elementResult.elementReference
+                           checkResults:checkResults]];
+    }
+  }
+  return removedIssues ? filteredElementResults : elementResults;
+}
+
++ (NSString *)fingerprintForCheckResult:(GTXCheckResult *)checkResult
+                       elementReference:(GTXElementReference *)elementReference {
+  NSString *identity = elementReference.accessibilityIdentifier;
+  NSString *identityKind = @"id";
+  if (identity.length == 0) {
+    identity = elementReference.accessibilityLabel;
+    identityKind = @"label";
+  }
+  if (identity.length == 0) {
+    // Frames differ between devices, so they are only used when nothing else identifies the
+    // element. Missing label issues are the most common case.
+    CGRect frame = elementReference.accessibilityFrame;
+    identity = [NSString stringWithFormat:@"%.0f,%.0f,%.0f,%.0f", round(frame.origin.x),
+                                          round(frame.origin.y), round(frame.size.width),
+                                          round(frame.size.height)];
+    identityKind = @"frame";
+  }
+  NSString *keySource =
+      [NSString stringWithFormat:@"%@\n%@\n%@:%@", checkResult.checkName,
+                                 NSStringFromClass(elementReference.elementClass), identityKind,
+                                 identity];
+  return [GSCXUtils hexadecimalHashOfString:keySource];
+}
+
++ (NSURL *)defaultURL {
+  NSURL *documentsURL = [[NSFileManager defaultManager] URLsForDirectory:NSDocumentDirectory
+                                                               inDomains:NSUserDomainMask]
+                            .firstObject;
+  return [documentsURL URLByAppendingPathComponent:@"GSCXScannerBaseline.txt"];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,106 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * The default weight of the most recent measurement in @c GSCXCheckCostModel's moving averages.
+ */
+FOUNDATION_EXTERN const double kGSCXCheckCostModelDefaultSmoothingFactor;
+
+/**
+ * Estimates how long each check takes per element from the scans it has measured, as an
+ * exponentially weighted moving average, so recent scans matter more than old ones. Must only be
+ * used on the main thread.
+ */
+@interface GSCXCheckCostModel : NSObject
+
+/**
+ * The weight of the most recent measurement in each moving average, between 0 exclusive and 1
+ * inclusive. Higher values adapt faster but are noisier.
+ */
+@property(assign, nonatomic, readonly) double smoothingFactor;
+
+/**
+ * The number of elements checked in the most recently recorded scan.
+ */
+@property(assign, nonatomic, readonly) NSUInteger lastScanElementCount;
+
+/**
+ * The total time, in seconds, spent by all checks in the most recently recorded scan.
+ */
+@property(assign, nonatomic, readonly) NSTimeInterval lastScanDuration;
+
+/**
+ * Initializes a @c GSCXCheckCostModel instance with @c kGSCXCheckCostModelDefaultSmoothingFactor.
+ */
+- (instancetype)init;
+
+/**
+ * Initializes a @c GSCXCheckCostModel instance.
+ *
+ * @param smoothingFactor The weight of the most recent measurement in each moving average.
+ * @return An initialized @c GSCXCheckCostModel instance.
+ */
+- (instancetype)initWithSmoothingFactor:(double)smoothingFactor NS_DESIGNATED_INITIALIZER;
+
+/**
+ * Updates the cost of each check measured in a scan.
+ *
+ * @param checkDurations The total time, in seconds, each check spent in the scan, keyed by check
+ *  name. Checks that did not run must be omitted.
+ * @param elementCount The number of elements checked in the scan. If 0, no costs are updated.
+ */
+- (void)recordCheckDurations:(NSDictionary<NSString *, NSNumber *> *)checkDurations
+                elementCount:(NSUInteger)elementCount;
+
+/**
+ * Updates the cost of each check measured in a scan in which some checks were not evaluated on
+ * every element.
+ *
+ * @param checkDurations The total time, in seconds, each check spent in the scan, keyed by check
+ *  name. Checks that did not run must be omitted.
+ * @param evaluationCounts The number of elements each check was evaluated on, keyed by check name.
+ *  Checks that are omitted are assumed to have been evaluated on every element.
+ * @param elementCount The number of elements checked in the scan. If 0, no costs are updated.
+ */
+- (void)recordCheckDurations:(NSDictionary<NSString *, NSNumber *> *)checkDurations
+            evaluationCounts:(NSDictionary<NSString *, NSNumber *> *)evaluationCounts
+                elementCount:(NSUInteger)elementCount;
+
+/**
+ * @param checkName The name of a check.
+ * @return @c YES if the check has been measured, @c NO otherwise.
+ */
+- (BOOL)hasCostForCheckNamed:(NSString *)checkName;
+
+/**
+ * @param checkName The name of a check.
+ * @return The estimated time, in seconds, the check takes per element, or 0 if it has not been
+ *  measured.
+ */
+- (NSTimeInterval)costPerElementForCheckNamed:(NSString *)checkName;
+
+/**
+ * Forgets all measurements.
+ */
+- (void)reset;
+
+@end
+
+NS_ASSUME_NONNULL_END
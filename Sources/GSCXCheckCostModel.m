@@ -0,0 +1,95 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXCheckCostModel.h"
+
+#import <GTXiLib/GTXiLib.h>
+NS_ASSUME_NONNULL_BEGIN
+
+const double kGSCXCheckCostModelDefaultSmoothingFactor = 0.2;
+
+@interface GSCXCheckCostModel ()
+
+/**
+ * The moving average of the time each check takes per element, keyed by check name.
+ */
+@property(strong, nonatomic) NSMutableDictionary<NSString *, NSNumber *> *costsPerElement;
+
+@end
+
+@implementation GSCXCheckCostModel
+
+- (instancetype)init {
+  return [self initWithSmoothingFactor:kGSCXCheckCostModelDefaultSmoothingFactor];
+}
+
+- (instancetype)initWithSmoothingFactor:(double)smoothingFactor {
+  GTX_ASSERT(smoothingFactor > 0.0 && smoothingFactor <= 1.0,
+             @"smoothingFactor must be in (0, 1].");
+  self = [super init];
+  if (self) {
+    _smoothingFactor = smoothingFactor;
+    _costsPerElement = [[NSMutableDictionary alloc] init];
+  }
+  return self;
+}
+
+- (void)recordCheckDurations:(NSDictionary<NSString *, NSNumber *> *)checkDurations
+                elementCount:(NSUInteger)elementCount {
+  [self recordCheckDurations:checkDurations evaluationCounts:@{} elementCount:elementCount];
+}
+
+- (void)recordCheckDurations:(NSDictionary<NSString *, NSNumber *> *)checkDurations
+            evaluationCounts:(NSDictionary<NSString *, NSNumber *> *)evaluationCounts
+                elementCount:(NSUInteger)elementCount {
+  NSTimeInterval totalDuration = 0.0;
+  for (NSString *checkName in checkDurations) {
+    NSTimeInterval duration = [checkDurations[checkName] doubleValue];
+    totalDuration += duration;
+    NSNumber *evaluationCount = evaluationCounts[checkName];
+    NSUInteger sampleCount =
+        evaluationCount != nil ? [evaluationCount unsignedIntegerValue] : elementCount;
+    if (elementCount == 0 || sampleCount == 0) {
+      continue;
+    }
+    NSTimeInterval sample = duration / sampleCount;
+    NSNumber *cost = self.costsPerElement[checkName];
+    if (cost != nil) {
+      sample = self.smoothingFactor * sample + (1.0 - self.smoothingFactor) * [cost doubleValue];
+    }
+    self.costsPerElement[checkName] = @(sample);
+  }
+  _lastScanElementCount = elementCount;
+  _lastScanDuration = totalDuration;
+}
+
+- (BOOL)hasCostForCheckNamed:(NSString *)checkName {
+  return self.costsPerElement[checkName] != nil;
+}
+
+- (NSTimeInterval)costPerElementForCheckNamed:(NSString *)checkName {
+  return [self.costsPerElement[checkName] doubleValue];
+}
+
+- (void)reset {
+  [self.costsPerElement removeAllObjects];
+  _lastScanElementCount = 0;
+  _lastScanDuration = 0.0;
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,123 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+#import "GSCXSnapshotCheck.h"
+#import <GTXiLib/GTXiLib.h>
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * The outcome of evaluating snapshot checks on a list of elements in parallel. Element indexes
+ * refer to the elements that were evaluated, and check indexes to @c GSCXCheckEvaluator.checks.
+ */
+@interface GSCXSnapshotEvaluation : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * @param elementIndex The index of an element.
+ * @return @c YES if the snapshot checks were evaluated on the element, @c NO if it was skipped
+ *  because the evaluation was stopped.
+ */
+- (BOOL)isElementEvaluatedAtIndex:(NSUInteger)elementIndex;
+
+/**
+ * @param elementIndex The index of an evaluated element.
+ * @param checkIndex The index of a snapshot check.
+ * @return @c YES if the element's snapshot failed the check, @c NO otherwise.
+ */
+- (BOOL)elementAtIndex:(NSUInteger)elementIndex failedCheckAtIndex:(NSUInteger)checkIndex;
+
+/**
+ * @param checkIndex The index of a check.
+ * @return The total time, in seconds, the check spent across all threads.
+ */
+- (NSTimeInterval)durationOfCheckAtIndex:(NSUInteger)checkIndex;
+
+/**
+ * @param checkIndex The index of a check.
+ * @return The number of elements the check was evaluated on.
+ */
+- (NSUInteger)evaluationCountOfCheckAtIndex:(NSUInteger)checkIndex;
+
+@end
+
+/**
+ * Evaluates checks one at a time, so a scan can observe and control each check individually
+ * instead of running every check on an element in a single call. Each check is wrapped in its own
+ * toolkit with the same excludeLists, so elements are excluded and errors are formatted exactly as
+ * by a toolkit containing every check. Must only be used on the main thread.
+ */
+@interface GSCXCheckEvaluator : NSObject
+
+/**
+ * The checks evaluated by this instance, in evaluation order.
+ */
+@property(copy, nonatomic, readonly) NSArray<id<GTXChecking>> *checks;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Initializes a @c GSCXCheckEvaluator instance.
+ *
+ * @param checks The checks to evaluate.
+ * @param excludeLists The excludeLists determining which elements each check skips.
+ * @return An initialized @c GSCXCheckEvaluator instance.
+ */
+- (instancetype)initWithChecks:(NSArray<id<GTXChecking>> *)checks
+                  excludeLists:(NSArray<id<GTXExcludeListing>> *)excludeLists
+    NS_DESIGNATED_INITIALIZER;
+
+/**
+ * Evaluates a single check on @c element.
+ *
+ * @param element The element to check.
+ * @param index The index of the check in @c checks.
+ * @return An error describing the failure, in the same format as the errors in
+ *  @c GTXResult.errorsFound, or @c nil if the element passed or was skipped.
+ */
+- (nullable NSError *)errorForElement:(id)element checkAtIndex:(NSUInteger)index;
+
+/**
+ * Combines the errors found by individual checks on the same element into a single element
+ * result.
+ *
+ * @param errors Errors returned by @c errorForElement:checkAtIndex: for the same element. Must not
+ *  be empty.
+ * @return An element result containing the check results of every error in @c errors.
+ */
++ (GTXElementResultCollection *)elementResultWithErrors:(NSArray<NSError *> *)errors;
+
+/**
+ * Captures a snapshot of every element on the calling thread, then evaluates the snapshot checks at
+ * @c indexes on the snapshots, spreading elements across all available cores. Only reports whether
+ * each snapshot passed: errors for failing elements are obtained from
+ * @c errorForElement:checkAtIndex:, which also applies the excludeLists.
+ *
+ * @param indexes The indexes in @c checks of checks conforming to @c GSCXSnapshotChecking.
+ * @param elements The elements to evaluate.
+ * @param shouldStop Called concurrently before each element. If it returns @c YES, the element is
+ *  skipped.
+ * @return Whether each element's snapshot passed each check.
+ */
+- (GSCXSnapshotEvaluation *)evaluateSnapshotChecksAtIndexes:(NSIndexSet *)indexes
+                                                 onElements:(NSArray *)elements
+                                                 shouldStop:(BOOL (^)(void))shouldStop;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,204 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXCheckEvaluator.h"
+
+#import <QuartzCore/QuartzCore.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface GSCXSnapshotEvaluation ()
+
+/**
+ * The number of checks in the evaluator that produced this instance.
+ */
+@property(assign, nonatomic) NSUInteger checkCount;
+
+/**
+ * One byte per element, 1 if the element was evaluated, 0 otherwise.
+ */
+@property(strong, nonatomic) NSData *evaluatedElements;
+
+/**
+ * One byte per element and check, in element-major order, 1 if the element's snapshot failed the
+ * check, 0 otherwise.
+ */
+@property(strong, nonatomic) NSData *failures;
+
+/**
+ * One @c CFTimeInterval per element and check, in element-major order, the time the check spent
+ * on the element.
+ */
+@property(strong, nonatomic) NSData *durations;
+
+@end
+
+@implementation GSCXSnapshotEvaluation
+
+- (instancetype)initWithCheckCount:(NSUInteger)checkCount
+                 evaluatedElements:(NSData *)evaluatedElements
+                          failures:(NSData *)failures
+                         durations:(NSData *)durations {
+  self = [super init];
+  if (self) {
+    _checkCount = checkCount;
+    _evaluatedElements = evaluatedElements;
+    _failures = failures;
+    _durations = durations;
+  }
+  return self;
+}
+
+- (BOOL)isElementEvaluatedAtIndex:(NSUInteger)elementIndex {
+  return ((const uint8_t *)self.evaluatedElements.bytes)[elementIndex] != 0;
+}
+
+- (BOOL)elementAtIndex:(NSUInteger)elementIndex failedCheckAtIndex:(NSUInteger)checkIndex {
+  return ((const uint8_t *)self.failures.bytes)[elementIndex * self.checkCount + checkIndex] != 0;
+}
+
+- (NSTimeInterval)durationOfCheckAtIndex:(NSUInteger)checkIndex {
+  const CFTimeInterval *durations = (const CFTimeInterval *)self.durations.bytes;
+  NSTimeInterval duration = 0.0;
+  for (NSUInteger i = 0; i < self.evaluatedElements.length; i++) {
+    duration += MAX(durations[i * self.checkCount + checkIndex], 0.0);
+  }
+  return duration;
+}
+
+- (NSUInteger)evaluationCountOfCheckAtIndex:(NSUInteger)checkIndex {
+  const CFTimeInterval *durations = (const CFTimeInterval *)self.durations.bytes;
+  NSUInteger count = 0;
+  for (NSUInteger i = 0; i < self.evaluatedElements.length; i++) {
+    if (durations[i * self.checkCount + checkIndex] >= 0.0) {
+      count++;
+    }
+  }
+  return count;
+}
+
+@end
+
+@interface GSCXCheckEvaluator ()
+
+/**
+ * A toolkit containing only the check at the same index in @c checks, and every excludeList.
+ */
+@property(strong, nonatomic) NSArray<GTXToolKit *> *toolkits;
+
+@end
+
+@implementation GSCXCheckEvaluator
+
+- (instancetype)initWithChecks:(NSArray<id<GTXChecking>> *)checks
+                  excludeLists:(NSArray<id<GTXExcludeListing>> *)excludeLists {
+  self = [super init];
+  if (self) {
+    _checks = [checks copy];
+    NSMutableArray<GTXToolKit *> *toolkits = [[NSMutableArray alloc] initWithCapacity:checks.count];
+    for (id<GTXChecking> check in checks) {
+      GTXToolKit *toolkit = [GTXToolKit toolkitWithNoChecks];
+      [toolkit registerCheck:check];
+      for (id<GTXExcludeListing> excludeList in excludeLists) {
+        [toolkit registerExcludeList:excludeList];
+      }
+      [toolkits addObject:toolkit];
+    }
+    _toolkits = toolkits;
+  }
+  return self;
+}
+
+- (nullable NSError *)errorForElement:(id)element checkAtIndex:(NSUInteger)index {
+  NSError *error;
+  if ([self.toolkits[index] checkElement:element error:&error]) {
+    return nil;
+  }
+  return error;
+}
+
++ (GTXElementResultCollection *)elementResultWithErrors:(NSArray<NSError *> *)errors {
+  GTX_ASSERT(errors.count > 0, @"errors cannot be empty.");
+  GTXElementResultCollection *firstResult =
+      [[GTXElementResultCollection alloc] initWithError:errors[0]];
+  if (errors.count == 1) {
+    return firstResult;
+  }
+  NSMutableArray<GTXCheckResult *> *checkResults = [firstResult.checkResults mutableCopy];
+  for (NSUInteger i = 1; i < errors.count; i++) {
+    GTXElementResultCollection *elementResult =
+        [[GTXElementResultCollection alloc] initWithError:errors[i]];
+    [checkResults addObjectsFromArray:elementResult.checkResults];
+  }
+  return [[GTXElementResultCollection alloc] initWithElement:firstResult.elementReference
+                                                checkResults:checkResults];
+}
+
+- (GSCXSnapshotEvaluation *)evaluateSnapshotChecksAtIndexes:(NSIndexSet *)indexes
+                                                 onElements:(NSArray *)elements
+                                                 shouldStop:(BOOL (^)(void))shouldStop {
+  NSUInteger elementCount = elements.count;
+  NSUInteger checkCount = self.checks.count;
+  NSMutableArray<GSCXElementSnapshot *> *snapshots =
+      [[NSMutableArray alloc] initWithCapacity:elementCount];
+  for (id element in elements) {
+    [snapshots addObject:[GSCXElementSnapshot snapshotOfElement:element]];
+  }
+  NSMutableArray<id<GSCXSnapshotChecking>> *snapshotChecks = [[NSMutableArray alloc] init];
+  NS_VALID_UNTIL_END_OF_SCOPE NSMutableData *snapshotCheckIndexesData =
+      [NSMutableData dataWithLength:indexes.count * sizeof(NSUInteger)];
+  NSUInteger *snapshotCheckIndexes = (NSUInteger *)snapshotCheckIndexesData.mutableBytes;
+  [indexes getIndexes:snapshotCheckIndexes maxCount:indexes.count inIndexRange:nil];
+  for (NSUInteger k = 0; k < indexes.count; k++) {
+    id<GTXChecking> check = self.checks[snapshotCheckIndexes[k]];
+    GTX_ASSERT([check conformsToProtocol:@protocol(GSCXSnapshotChecking)],
+               @"%@ is not a snapshot check.", [check name]);
+    [snapshotChecks addObject:(id<GSCXSnapshotChecking>)check];
+  }
+  NSMutableData *evaluatedElements = [NSMutableData dataWithLength:elementCount];
+  NSMutableData *failures = [NSMutableData dataWithLength:elementCount * checkCount];
+  NSMutableData *durations =
+      [NSMutableData dataWithLength:elementCount * checkCount * sizeof(CFTimeInterval)];
+  uint8_t *evaluatedBytes = (uint8_t *)evaluatedElements.mutableBytes;
+  uint8_t *failureBytes = (uint8_t *)failures.mutableBytes;
+  CFTimeInterval *durationValues = (CFTimeInterval *)durations.mutableBytes;
+  // Checks not evaluated on an element are marked with a negative duration.
+  for (NSUInteger i = 0; i < elementCount * checkCount; i++) {
+    durationValues[i] = -1.0;
+  }
+  // Every iteration only writes the bytes of its own element, so no synchronization is needed.
+  dispatch_apply(elementCount, DISPATCH_APPLY_AUTO, ^(size_t elementIndex) {
+    if (shouldStop()) {
+      return;
+    }
+    GSCXElementSnapshot *snapshot = snapshots[elementIndex];
+    for (NSUInteger k = 0; k < snapshotChecks.count; k++) {
+      NSUInteger offset = elementIndex * checkCount + snapshotCheckIndexes[k];
+      CFTimeInterval start = CACurrentMediaTime();
+      failureBytes[offset] = [snapshotChecks[k] checkSnapshot:snapshot] ? 0 : 1;
+      durationValues[offset] = CACurrentMediaTime() - start;
+    }
+    evaluatedBytes[elementIndex] = 1;
+  });
+  return [[GSCXSnapshotEvaluation alloc] initWithCheckCount:checkCount
+                                          evaluatedElements:evaluatedElements
+                                                   failures:failures
+                                                  durations:durations];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
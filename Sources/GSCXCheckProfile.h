@@ -0,0 +1,72 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+#import <GTXiLib/GTXiLib.h>
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * A named set of checks and excludeLists, such as a quick sanity check or a full audit, that a
+ * @c GSCXScanner instance can switch to at runtime.
+ */
+@interface GSCXCheckProfile : NSObject
+
+/**
+ * The name of the profile, displayed in the scanner menu. Unique within a scanner.
+ */
+@property(copy, nonatomic, readonly) NSString *name;
+
+/**
+ * The checks run while this profile is active.
+ */
+@property(copy, nonatomic, readonly) NSArray<id<GTXChecking>> *checks;
+
+/**
+ * The excludeLists used while this profile is active.
+ */
+@property(copy, nonatomic, readonly) NSArray<id<GTXExcludeListing>> *excludeLists;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Initializes a @c GSCXCheckProfile instance.
+ *
+ * @param name The name of the profile.
+ * @param checks The checks run while this profile is active.
+ * @param excludeLists The excludeLists used while this profile is active.
+ * @return An initialized @c GSCXCheckProfile instance.
+ */
+- (instancetype)initWithName:(NSString *)name
+                      checks:(NSArray<id<GTXChecking>> *)checks
+                excludeLists:(NSArray<id<GTXExcludeListing>> *)excludeLists
+    NS_DESIGNATED_INITIALIZER;
+
+/**
+ * Constructs a @c GSCXCheckProfile instance.
+ *
+ * @param name The name of the profile.
+ * @param checks The checks run while this profile is active.
+ * @param excludeLists The excludeLists used while this profile is active.
+ * @return A @c GSCXCheckProfile instance.
+ */
++ (instancetype)profileWithName:(NSString *)name
+                         checks:(NSArray<id<GTXChecking>> *)checks
+                   excludeLists:(NSArray<id<GTXExcludeListing>> *)excludeLists;
+
+@end
+
+NS_ASSUME_NONNULL_END
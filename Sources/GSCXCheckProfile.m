@@ -0,0 +1,43 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXCheckProfile.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@implementation GSCXCheckProfile
+
+- (instancetype)initWithName:(NSString *)name
+                      checks:(NSArray<id<GTXChecking>> *)checks
+                excludeLists:(NSArray<id<GTXExcludeListing>> *)excludeLists {
+  self = [super init];
+  if (self) {
+    _name = [name copy];
+    _checks = [checks copy];
+    _excludeLists = [excludeLists copy];
+  }
+  return self;
+}
+
++ (instancetype)profileWithName:(NSString *)name
+                         checks:(NSArray<id<GTXChecking>> *)checks
+                   excludeLists:(NSArray<id<GTXExcludeListing>> *)excludeLists {
+  return [[GSCXCheckProfile alloc] initWithName:name checks:checks excludeLists:excludeLists];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,113 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import <UIKit/UIKit.h>
+
+#import <GTXiLib/GTXiLib.h>
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Stores scan results in flat arrays instead of object graphs. Long continuous scans retain
+ * thousands of results whose check names, element classes, labels and descriptions are mostly the
+ * same strings. This store keeps each distinct string once, in an interning table, and records
+ * elements and checks as fixed size structs referring to strings by index. Check names are kept in
+ * a separate, smaller table shared by all results. Results are converted back to
+ * @c GTXHierarchyResultCollection instances on demand, and recently converted results are cached
+ * until memory is needed. Records of replaced results are reclaimed once they outnumber the records
+ * of current results.
+ */
+@interface GSCXCompactResultStore : NSObject
+
+/**
+ * Adds @c result to the end of the store.
+ *
+ * @param result The result to add.
+ * @return The index of @c result in the store.
+ */
+- (NSUInteger)addResult:(GTXHierarchyResultCollection *)result;
+
+/**
+ * Replaces the result at @c index with @c result. The storage of the replaced result is reclaimed
+ * when enough replaced records accumulate, so replacing results repeatedly does not grow the store
+ * without bound.
+ *
+ * @param index The index of the result to replace. Must be less than @c resultCount.
+ * @param result The new result.
+ */
+- (void)replaceResultAtIndex:(NSUInteger)index withResult:(GTXHierarchyResultCollection *)result;
+
+/**
+ * Replaces the screenshot of the result at @c index without changing its issues.
+ *
+ * @param screenshot The new screenshot.
+ * @param index The index of the result whose screenshot is replaced. Must be less than
+ *  @c resultCount.
+ */
+- (void)setScreenshot:(UIImage *)screenshot forResultAtIndex:(NSUInteger)index;
+
+/**
+ * Converts the result at @c index back to a @c GTXHierarchyResultCollection instance.
+ *
+ * @param index The index of the result. Must be less than @c resultCount.
+ * @return The result at @c index. Strings are shared with the store.
+ */
+- (GTXHierarchyResultCollection *)resultAtIndex:(NSUInteger)index;
+
+/**
+ * Finds the most recent result whose screenshot is @c screenshot.
+ *
+ * @param screenshot The screenshot to look for. Compared by identity.
+ * @return The index of the result, or @c NSNotFound if no result has @c screenshot.
+ */
+- (NSUInteger)indexOfResultWithScreenshot:(UIImage *)screenshot;
+
+/**
+ * @return The results in the store when this method is called. Results are converted to
+ *  @c GTXHierarchyResultCollection instances only when accessed, so enumerating part of the array
+ *  does not convert the rest. Replacements made later are visible through the array. The array must
+ *  not be accessed after @c removeAllResults is called.
+ */
+- (NSArray<GTXHierarchyResultCollection *> *)results;
+
+/**
+ * Removes all results and strings from the store.
+ */
+- (void)removeAllResults;
+
+/**
+ * @return The number of results in the store.
+ */
+- (NSUInteger)resultCount;
+
+/**
+ * @return The number of check results in all results currently in the store.
+ */
+- (NSUInteger)checkResultCount;
+
+/**
+ * @return The number of distinct strings in the interning table.
+ */
+- (NSUInteger)internedStringCount;
+
+/**
+ * @return An estimate of the number of bytes used by the store's tables and strings, excluding
+ *  screenshots.
+ */
+- (NSUInteger)estimatedByteCount;
+
+@end
+
+NS_ASSUME_NONNULL_END
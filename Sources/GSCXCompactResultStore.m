@@ -0,0 +1,482 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXCompactResultStore.h"
+
+#import "GTXHierarchyResultCollection+GSCXCompleteness.h"
+#import "GTXHierarchyResultCollection+GSCXScreenshot.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * The string ID representing a @c nil string.
+ */
+static const uint32_t kGSCXCompactResultStoreNilStringID = UINT32_MAX;
+
+/**
+ * The minimum number of element records of replaced results before the store is compacted. Avoids
+ * compacting small stores on every replacement.
+ */
+static const NSUInteger kGSCXCompactResultStoreMinimumDeadElementCount = 256;
+
+/**
+ * A scan result. Its elements are the @c elementCount consecutive elements starting at
+ * @c firstElementIndex.
+ */
+typedef struct {
+  uint32_t firstElementIndex;
+  uint32_t elementCount;
+  uint32_t checkCount;
+  CGRect screenshotFrame;
+  BOOL incomplete;
+} GSCXCompactScan;
+
+/**
+ * An element with accessibility issues. Its checks are the @c checkCount consecutive checks
+ * starting at @c firstCheckIndex.
+ */
+typedef struct {
+  NSUInteger elementAddress;
+  CGRect accessibilityFrame;
+  uint32_t classNameID;
+  uint32_t labelID;
+  uint32_t identifierID;
+  uint32_t descriptionID;
+  uint32_t firstCheckIndex;
+  uint32_t checkCount;
+} GSCXCompactElement;
+
+/**
+ * A failing check. @c checkNameID indexes the check name table, @c errorDescriptionID the string
+ * table.
+ */
+typedef struct {
+  uint32_t checkNameID;
+  uint32_t errorDescriptionID;
+} GSCXCompactCheck;
+
+/**
+ * The results of a compact result store, converted on access.
+ */
+@interface GSCXCompactResultStoreResults : NSArray<GTXHierarchyResultCollection *>
+
+/**
+ * The store results are converted from.
+ */
+@property(strong, nonatomic) GSCXCompactResultStore *store;
+
+/**
+ * The number of results in @c store when the array was created.
+ */
+@property(assign, nonatomic) NSUInteger resultCount;
+
+@end
+
+@implementation GSCXCompactResultStoreResults
+
+- (instancetype)initWithStore:(GSCXCompactResultStore *)store {
+  self = [super init];
+  if (self) {
+    _store = store;
+    _resultCount = [store resultCount];
+  }
+  return self;
+}
+
+- (NSUInteger)count {
+  return self.resultCount;
+}
+
+- (GTXHierarchyResultCollection *)objectAtIndex:(NSUInteger)index {
+  if (index >= self.resultCount) {
+    [NSException raise:NSRangeException
+                format:@"Index %lu beyond bounds of %lu results.", (unsigned long)index,
+                       (unsigned long)self.resultCount];
+  }
+  return [self.store resultAtIndex:index];
+}
+
+- (id)copyWithZone:(nullable NSZone *)zone {
+  // Copying an NSArray subclass converts every element. The array is immutable, so it is shared.
+  return self;
+}
+
+@end
+
+@interface GSCXCompactResultStore ()
+
+/**
+ * Every distinct string other than check names, indexed by string ID.
+ */
+@property(strong, nonatomic) NSMutableArray<NSString *> *strings;
+
+/**
+ * Maps strings in @c strings to their IDs.
+ */
+@property(strong, nonatomic) NSMutableDictionary<NSString *, NSNumber *> *stringIDs;
+
+/**
+ * Every distinct check name, indexed by check name ID.
+ */
+@property(strong, nonatomic) NSMutableArray<NSString *> *checkNames;
+
+/**
+ * Maps check names in @c checkNames to their IDs.
+ */
+@property(strong, nonatomic) NSMutableDictionary<NSString *, NSNumber *> *checkNameIDs;
+
+/**
+ * A packed array of @c GSCXCompactScan structs, one per result.
+ */
+@property(strong, nonatomic) NSMutableData *scans;
+
+/**
+ * A packed array of @c GSCXCompactElement structs.
+ */
+@property(strong, nonatomic) NSMutableData *elements;
+
+/**
+ * A packed array of @c GSCXCompactCheck structs.
+ */
+@property(strong, nonatomic) NSMutableData *checks;
+
+/**
+ * The screenshot of each result. Screenshots are not copied, so results sharing a screenshot keep
+ * sharing it.
+ */
+@property(strong, nonatomic) NSMutableArray<UIImage *> *screenshots;
+
+/**
+ * The names of the checks throttled in each result. Few scans throttle checks, so the arrays are
+ * kept as is rather than packed.
+ */
+@property(strong, nonatomic) NSMutableArray<NSArray<NSString *> *> *throttledCheckNames;
+
+/**
+ * Recently converted results, keyed by index.
+ */
+@property(strong, nonatomic) NSCache<NSNumber *, GTXHierarchyResultCollection *> *resultCache;
+
+/**
+ * The number of check results in all results currently in the store.
+ */
+@property(assign, nonatomic) NSUInteger totalCheckCount;
+
+/**
+ * The number of records in @c elements belonging to replaced results.
+ */
+@property(assign, nonatomic) NSUInteger deadElementCount;
+
+/**
+ * The number of records in @c checks belonging to replaced results.
+ */
+@property(assign, nonatomic) NSUInteger deadCheckCount;
+
+@end
+
+@implementation GSCXCompactResultStore
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _strings = [[NSMutableArray alloc] init];
+    _stringIDs = [[NSMutableDictionary alloc] init];
+    _checkNames = [[NSMutableArray alloc] init];
+    _checkNameIDs = [[NSMutableDictionary alloc] init];
+    _scans = [[NSMutableData alloc] init];
+    _elements = [[NSMutableData alloc] init];
+    _checks = [[NSMutableData alloc] init];
+    _screenshots = [[NSMutableArray alloc] init];
+    _throttledCheckNames = [[NSMutableArray alloc] init];
+    _resultCache = [[NSCache alloc] init];
+  }
+  return self;
+}
+
+- (NSUInteger)addResult:(GTXHierarchyResultCollection *)result {
+  GSCXCompactScan scan = [self gscx_compactScanByAppendingResult:result];
+  [self.scans appendBytes:&scan length:sizeof(scan)];
+  [self.screenshots addObject:result.screenshot];
+  [self.throttledCheckNames addObject:result.gscx_throttledCheckNames];
+  self.totalCheckCount += scan.checkCount;
+  return self.screenshots.count - 1;
+}
+
+- (void)replaceResultAtIndex:(NSUInteger)index withResult:(GTXHierarchyResultCollection *)result {
+  GTX_ASSERT(index < [self resultCount], @"index %lu is out of bounds.", (unsigned long)index);
+  const GSCXCompactScan replacedScan = ((const GSCXCompactScan *)self.scans.bytes)[index];
+  self.totalCheckCount -= replacedScan.checkCount;
+  self.deadElementCount += replacedScan.elementCount;
+  self.deadCheckCount += replacedScan.checkCount;
+  GSCXCompactScan scan = [self gscx_compactScanByAppendingResult:result];
+  ((GSCXCompactScan *)self.scans.mutableBytes)[index] = scan;
+  self.screenshots[index] = result.screenshot;
+  self.throttledCheckNames[index] = result.gscx_throttledCheckNames;
+  self.totalCheckCount += scan.checkCount;
+  [self.resultCache removeObjectForKey:@(index)];
+  NSUInteger elementCount = self.elements.length / sizeof(GSCXCompactElement);
+  if (self.deadElementCount >= kGSCXCompactResultStoreMinimumDeadElementCount &&
+      self.deadElementCount * 2 > elementCount) {
+    [self gscx_compact];
+  }
+}
+
+- (void)setScreenshot:(UIImage *)screenshot forResultAtIndex:(NSUInteger)index {
+  GTX_ASSERT(index < [self resultCount], @"index %lu is out of bounds.", (unsigned long)index);
+  self.screenshots[index] = screenshot;
+  [self.resultCache removeObjectForKey:@(index)];
+}
+
+- (GTXHierarchyResultCollection *)resultAtIndex:(NSUInteger)index {
+  GTX_ASSERT(index < [self resultCount], @"index %lu is out of bounds.", (unsigned long)index);
+  GTXHierarchyResultCollection *cachedResult = [self.resultCache objectForKey:@(index)];
+  if (cachedResult != nil) {
+    return cachedResult;
+  }
+  const GSCXCompactScan scan = ((const GSCXCompactScan *)self.scans.bytes)[index];
+  const GSCXCompactElement *elements = (const GSCXCompactElement *)self.elements.bytes;
+  const GSCXCompactCheck *checks = (const GSCXCompactCheck *)self.checks.bytes;
+  NSMutableArray<GTXElementResultCollection *> *elementResults =
+      [[NSMutableArray alloc] initWithCapacity:scan.elementCount];
+  for (uint32_t i = 0; i < scan.elementCount; i++) {
+    const GSCXCompactElement element = elements[scan.firstElementIndex + i];
+    NSMutableArray<GTXCheckResult *> *checkResults =
+        [[NSMutableArray alloc] initWithCapacity:element.checkCount];
+    for (uint32_t j = 0; j < element.checkCount; j++) {
+      const GSCXCompactCheck check = checks[element.firstCheckIndex + j];
+      [checkResults
+          addObject:[[GTXCheckResult alloc]
+                        initWithCheckName:self.checkNames[check.checkNameID]
+                         errorDescription:[self gscx_stringWithID:check.errorDescriptionID]]];
+    }
+    GTXElementReference *elementReference = [[GTXElementReference alloc]
+        initWithElementAddress:element.elementAddress
+                  elementClass:NSClassFromString([self gscx_stringWithID:element.classNameID])
+            accessibilityLabel:[self gscx_stringWithID:element.labelID]
+       accessibilityIdentifier:[self gscx_stringWithID:element.identifierID]
+            accessibilityFrame:element.accessibilityFrame
+            elementDescription:[self gscx_stringWithID:element.descriptionID]];
+    [elementResults addObject:[[GTXElementResultCollection alloc] initWithElement:elementReference
+                                                                     checkResults:checkResults]];
+  }
+  GTXHierarchyResultCollection *result = [GTXHierarchyResultCollection
+      gscx_resultWithElementResults:elementResults
+                         screenshot:self.screenshots[index]
+                    screenshotFrame:scan.screenshotFrame
+                         incomplete:scan.incomplete
+                throttledCheckNames:self.throttledCheckNames[index]];
+  [self.resultCache setObject:result forKey:@(index)];
+  return result;
+}
+
+- (NSUInteger)indexOfResultWithScreenshot:(UIImage *)screenshot {
+  return [self.screenshots indexOfObjectWithOptions:NSEnumerationReverse
+                                        passingTest:^BOOL(UIImage *candidate, NSUInteger index,
+                                                          BOOL *stop) {
+                                          return candidate == screenshot;
+                                        }];
+}
+
+- (NSArray<GTXHierarchyResultCollection *> *)results {
+  return [[GSCXCompactResultStoreResults alloc] initWithStore:self];
+}
+
+- (void)removeAllResults {
+  [self.strings removeAllObjects];
+  [self.stringIDs removeAllObjects];
+  [self.checkNames removeAllObjects];
+  [self.checkNameIDs removeAllObjects];
+  self.scans.length = 0;
+  self.elements.length = 0;
+  self.checks.length = 0;
+  [self.screenshots removeAllObjects];
+  [self.throttledCheckNames removeAllObjects];
+  [self.resultCache removeAllObjects];
+  self.totalCheckCount = 0;
+  self.deadElementCount = 0;
+  self.deadCheckCount = 0;
+}
+
+- (NSUInteger)resultCount {
+  return self.screenshots.count;
+}
+
+- (NSUInteger)checkResultCount {
+  return self.totalCheckCount;
+}
+
+- (NSUInteger)internedStringCount {
+  return self.strings.count + self.checkNames.count;
+}
+
+- (NSUInteger)estimatedByteCount {
+  NSUInteger byteCount = self.scans.length + self.elements.length + self.checks.length;
+  for (NSString *string in self.strings) {
+    byteCount += [string lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+  }
+  for (NSString *checkName in self.checkNames) {
+    byteCount += [checkName lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+  }
+  return byteCount;
+}
+
+#pragma mark - Private
+
+/**
+ * Appends the elements and checks of @c result to the element and check tables.
+ *
+ * @param result The result to append.
+ * @return A scan record referring to the appended elements.
+ */
+- (GSCXCompactScan)gscx_compactScanByAppendingResult:(GTXHierarchyResultCollection *)result {
+  GSCXCompactScan scan;
+  scan.firstElementIndex = (uint32_t)(self.elements.length / sizeof(GSCXCompactElement));
+  scan.elementCount = (uint32_t)result.elementResults.count;
+  scan.checkCount = 0;
+  scan.screenshotFrame = result.gscx_screenshotFrame;
+  scan.incomplete = result.gscx_isIncomplete;
+  for (GTXElementResultCollection *elementResult in result.elementResults) {
+    GTXElementReference *elementReference = elementResult.elementReference;
+    GSCXCompactElement element;
+    element.elementAddress = elementReference.elementAddress;
+    element.accessibilityFrame = elementReference.accessibilityFrame;
+    element.classNameID =
+        [self gscx_internString:NSStringFromClass(elementReference.elementClass)];
+    element.labelID = [self gscx_internString:elementReference.accessibilityLabel];
+    element.identifierID = [self gscx_internString:elementReference.accessibilityIdentifier];
+    element.descriptionID = [self gscx_internString:elementReference.elementDescription];
+    element.firstCheckIndex = (uint32_t)(self.checks.length / sizeof(GSCXCompactCheck));
+    element.checkCount = (uint32_t)elementResult.checkResults.count;
+    for (GTXCheckResult *checkResult in elementResult.checkResults) {
+      GSCXCompactCheck check;
+      check.checkNameID = [self gscx_internCheckName:checkResult.checkName];
+      check.errorDescriptionID = [self gscx_internString:checkResult.errorDescription];
+      [self.checks appendBytes:&check length:sizeof(check)];
+    }
+    [self.elements appendBytes:&element length:sizeof(element)];
+    scan.checkCount += element.checkCount;
+  }
+  return scan;
+}
+
+/**
+ * Rewrites the element, check and string tables to contain only the records and strings of current
+ * results, reclaiming the storage of replaced results. Indexes of results are unchanged, so
+ * converted results in @c resultCache stay valid.
+ */
+- (void)gscx_compact {
+  NSArray<NSString *> *oldStrings = self.strings;
+  NSArray<NSString *> *oldCheckNames = self.checkNames;
+  NS_VALID_UNTIL_END_OF_SCOPE NSData *oldElementData = self.elements;
+  NS_VALID_UNTIL_END_OF_SCOPE NSData *oldCheckData = self.checks;
+  const GSCXCompactElement *oldElements = (const GSCXCompactElement *)oldElementData.bytes;
+  const GSCXCompactCheck *oldChecks = (const GSCXCompactCheck *)oldCheckData.bytes;
+  NSUInteger liveElementCount =
+      oldElementData.length / sizeof(GSCXCompactElement) - self.deadElementCount;
+  NSUInteger liveCheckCount = oldCheckData.length / sizeof(GSCXCompactCheck) - self.deadCheckCount;
+  self.strings = [[NSMutableArray alloc] init];
+  self.stringIDs = [[NSMutableDictionary alloc] init];
+  self.checkNames = [[NSMutableArray alloc] init];
+  self.checkNameIDs = [[NSMutableDictionary alloc] init];
+  self.elements =
+      [[NSMutableData alloc] initWithCapacity:liveElementCount * sizeof(GSCXCompactElement)];
+  self.checks = [[NSMutableData alloc] initWithCapacity:liveCheckCount * sizeof(GSCXCompactCheck)];
+  uint32_t (^reinternString)(uint32_t) = ^uint32_t(uint32_t stringID) {
+    if (stringID == kGSCXCompactResultStoreNilStringID) {
+      return kGSCXCompactResultStoreNilStringID;
+    }
+    return [self gscx_internString:oldStrings[stringID]];
+  };
+  GSCXCompactScan *scans = (GSCXCompactScan *)self.scans.mutableBytes;
+  for (NSUInteger i = 0; i < [self resultCount]; i++) {
+    GSCXCompactScan *scan = &scans[i];
+    uint32_t firstElementIndex = (uint32_t)(self.elements.length / sizeof(GSCXCompactElement));
+    for (uint32_t j = 0; j < scan->elementCount; j++) {
+      GSCXCompactElement element = oldElements[scan->firstElementIndex + j];
+      uint32_t firstCheckIndex = (uint32_t)(self.checks.length / sizeof(GSCXCompactCheck));
+      for (uint32_t k = 0; k < element.checkCount; k++) {
+        GSCXCompactCheck check = oldChecks[element.firstCheckIndex + k];
+        check.checkNameID = [self gscx_internCheckName:oldCheckNames[check.checkNameID]];
+        check.errorDescriptionID = reinternString(check.errorDescriptionID);
+        [self.checks appendBytes:&check length:sizeof(check)];
+      }
+      element.firstCheckIndex = firstCheckIndex;
+      element.classNameID = reinternString(element.classNameID);
+      element.labelID = reinternString(element.labelID);
+      element.identifierID = reinternString(element.identifierID);
+      element.descriptionID = reinternString(element.descriptionID);
+      [self.elements appendBytes:&element length:sizeof(element)];
+    }
+    scan->firstElementIndex = firstElementIndex;
+  }
+  self.deadElementCount = 0;
+  self.deadCheckCount = 0;
+}
+
+/**
+ * Adds @c string to the string table if it is not already in it.
+ *
+ * @param string The string to intern.
+ * @return The ID of @c string, or @c kGSCXCompactResultStoreNilStringID if @c string is @c nil.
+ */
+- (uint32_t)gscx_internString:(nullable NSString *)string {
+  if (string == nil) {
+    return kGSCXCompactResultStoreNilStringID;
+  }
+  NSNumber *stringID = self.stringIDs[string];
+  if (stringID == nil) {
+    stringID = @(self.strings.count);
+    NSString *internedString = [string copy];
+    [self.strings addObject:internedString];
+    self.stringIDs[internedString] = stringID;
+  }
+  return [stringID unsignedIntValue];
+}
+
+/**
+ * Adds @c checkName to the check name table if it is not already in it.
+ *
+ * @param checkName The check name to intern.
+ * @return The ID of @c checkName.
+ */
+- (uint32_t)gscx_internCheckName:(NSString *)checkName {
+  NSNumber *checkNameID = self.checkNameIDs[checkName];
+  if (checkNameID == nil) {
+    checkNameID = @(self.checkNames.count);
+    NSString *internedCheckName = [checkName copy];
+    [self.checkNames addObject:internedCheckName];
+    self.checkNameIDs[internedCheckName] = checkNameID;
+  }
+  return [checkNameID unsignedIntValue];
+}
+
+/**
+ * Looks up a string by ID.
+ *
+ * @param stringID The ID of the string, as returned by @c gscx_internString:.
+ * @return The string with @c stringID, or @c nil if @c stringID is
+ *  @c kGSCXCompactResultStoreNilStringID.
+ */
+- (nullable NSString *)gscx_stringWithID:(uint32_t)stringID {
+  if (stringID == kGSCXCompactResultStoreNilStringID) {
+    return nil;
+  }
+  return self.strings[stringID];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
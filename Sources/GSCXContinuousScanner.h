@@ -16,12 +16,42 @@
 
 #import <Foundation/Foundation.h>
 
+#import "GSCXCompactResultStore.h"
 #import "GSCXContinuousScannerDelegate.h"
 #import "GSCXContinuousScannerScheduling.h"
+#import "GSCXElementSampler.h"
+#import "GSCXIssueDeduplicator.h"
 #import "GSCXScanner.h"
+#import "GSCXScreenClusterer.h"
+#import "GSCXScreenScanQuota.h"
+#import "GSCXScreenshotDeduplicator.h"
+#import "GSCXSessionJournal.h"
 #import <GTXiLib/GTXiLib.h>
 NS_ASSUME_NONNULL_BEGIN
 
+/**
+ * Determines which results a @c GSCXContinuousScanner instance keeps for scans of the same screen.
+ */
+typedef NS_ENUM(NSInteger, GSCXContinuousScannerScreenRetention) {
+  /**
+   * Every scan result is kept, even if it is the same screen as a previous scan.
+   */
+  GSCXContinuousScannerScreenRetentionAllScans = 0,
+
+  /**
+   * Only the most recent result for each screen is kept. It replaces the previous result for that
+   * screen in place.
+   */
+  GSCXContinuousScannerScreenRetentionLatestPerScreen,
+
+  /**
+   * The first result for each screen is kept. Issues found in later scans of the same screen that
+   * are not already in the kept result are added to it. The kept result's screenshot is not
+   * updated, so ring views for added issues are positioned relative to the first screenshot.
+   */
+  GSCXContinuousScannerScreenRetentionMergedPerScreen,
+};
+
 /**
  * Manages scanning the application for accessibility issues in the background without user
  * interactions. The scheduler determines when the application needs to be scanned (such as if the
@@ -34,6 +64,97 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property(strong, nonatomic, readonly) NSArray<GTXHierarchyResultCollection *> *scanResults;
 
+/**
+ * Collapses repeated occurrences of the same issue across all scans, including scans whose results
+ * were later replaced in @c scanResults. Updated as each scan completes and reset when a continuous
+ * scan begins. Its scan indexes count scans, so they only index into @c scanResults if every result
+ * is retained.
+ */
+@property(strong, nonatomic, readonly) GSCXIssueDeduplicator *issueDeduplicator;
+
+/**
+ * Groups scans into screens based on the structure of the scanned view hierarchies. Updated as each
+ * scan completes and reset when a continuous scan begins.
+ */
+@property(strong, nonatomic, readonly) GSCXScreenClusterer *screenClusterer;
+
+/**
+ * Determines which results are kept in @c scanResults for scans of the same screen. Defaults to
+ * @c GSCXContinuousScannerScreenRetentionAllScans. Changing this value only affects future scans.
+ */
+@property(assign, nonatomic) GSCXContinuousScannerScreenRetention screenRetention;
+
+/**
+ * Limits how often the same screen is scanned. If non-nil, scheduled scans of a screen that has
+ * reached its quota are skipped before any checks run. Reset when a continuous scan begins.
+ * Defaults to @c nil, meaning every scheduled scan occurs.
+ */
+@property(strong, nonatomic, nullable) GSCXScreenScanQuota *screenScanQuota;
+
+/**
+ * Lets results with visually identical screenshots and identical issues share one image. If
+ * non-nil, each result is replaced in @c scanResults shortly after its scan, once its screenshot
+ * has been hashed in the background. Reset when a continuous scan begins. Defaults to @c nil,
+ * meaning every result keeps its own screenshot.
+ */
+@property(strong, nonatomic, nullable) GSCXScreenshotDeduplicator *screenshotDeduplicator;
+
+/**
+ * @c YES if results are kept in a @c GSCXCompactResultStore instead of as result objects, reducing
+ * memory use in long sessions. @c scanResults then converts results back to objects each time it
+ * is accessed. Changes take effect when the next continuous scan begins. Defaults to @c NO.
+ */
+@property(assign, nonatomic) BOOL usesCompactResultStore;
+
+/**
+ * The directory continuous scan sessions are journaled to, so results survive the application
+ * crashing or being killed. If non-nil, each continuous scan writes a new session there, which
+ * @c GSCXSessionJournal can read back after relaunch. Changes take effect when the next continuous
+ * scan begins. Defaults to @c nil, meaning sessions are only kept in memory.
+ */
+@property(strong, nonatomic, nullable) NSURL *sessionJournalDirectoryURL;
+
+/**
+ * The names of the scanner's profiles to scan with, in turn. The Nth scan of a continuous scan uses
+ * the profile at index N modulo the count, so cheap checks can run every scan and expensive ones
+ * every few scans, such as @c @[ @"Quick", @"Quick", @"Quick", @"Full" ]. Each name must be the
+ * name of a profile added to the scanner, or @c NSNull to use the scanner's registered checks. The
+ * scanner's @c activeProfileName is restored after each scan. Skipped scans do not advance the
+ * rotation. Defaults to @c nil, meaning every scan uses the scanner's @c activeProfileName.
+ */
+@property(copy, nonatomic, nullable) NSArray *profileRotation;
+
+/**
+ * If greater than 0, each scan is sliced across frames, spending at most this many seconds per
+ * frame checking elements, using @c GSCXScanner.beginSlicedScanOfRootViews:timeBudget:completion:.
+ * Scheduled scans are skipped while a sliced scan is in progress. Scans invalidated because the
+ * hierarchy changed are not retained. Defaults to 0, meaning each scan blocks the main thread until
+ * it completes.
+ */
+@property(assign, nonatomic) NSTimeInterval sliceTimeBudget;
+
+/**
+ * If greater than 0, the seconds checks may spend per minute, as estimated by the scanner's
+ * @c checkCostModel. Each check runs on the first scan of every screen. On later scans of the
+ * screen, the cheapest checks run while they fit in what remains of the budget over the last
+ * minute, and the others are throttled and listed in the result's
+ * @c GTXHierarchyResultCollection.gscx_throttledCheckNames. Sliced scans are not throttled. Reset
+ * when a continuous scan begins. Defaults to 0, meaning every check runs on every scan.
+ */
+@property(assign, nonatomic) NSTimeInterval checkTimeBudgetPerMinute;
+
+/**
+ * If greater than 1, each scan only checks a sample of the screen's elements, chosen by a
+ * @c GSCXElementSampler per screen so every element is checked within this many scans of the
+ * screen. Each screen then keeps a single rolling result in @c scanResults, merging the issues of
+ * its last @c samplingTickCount scans, regardless of @c screenRetention. The delegate is notified
+ * with the result of each sampled scan. Sliced scans are not sampled. Samplers and retained scans
+ * are kept for the most recently sampled screens only, up to the capacity of @c screenScanQuota or
+ * @c kGSCXScreenScanQuotaDefaultCapacity if it is @c nil. Reset when a continuous scan begins.
+ * Defaults to 0, meaning every scan checks every element.
+ */
+@property(assign, nonatomic) NSUInteger samplingTickCount;
+
 /**
  * Initializes a @c GSCXContinuousScanner instance.
  *
@@ -83,6 +204,12 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (NSUInteger)issueCount;
 
+/**
+ * @return The number of distinct accessibility issues found across all scans. Issues occurring in
+ * multiple scans are only counted once.
+ */
+- (NSUInteger)uniqueIssueCount;
+
 @end
 
 NS_ASSUME_NONNULL_END
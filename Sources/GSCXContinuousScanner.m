@@ -16,10 +16,19 @@
 
 #import "GSCXContinuousScanner.h"
 
+#import <QuartzCore/QuartzCore.h>
+
+#import "GSCXMappedSession.h"
 #import "GSCXScanner.h"
+#import "GTXHierarchyResultCollection+GSCXScreenshot.h"
 #import <GTXiLib/GTXiLib.h>
 NS_ASSUME_NONNULL_BEGIN
 
+/**
+ * The length, in seconds, of the window @c checkTimeBudgetPerMinute applies to.
+ */
+static const NSTimeInterval kGSCXContinuousScannerCheckTimeBudgetWindow = 60.0;
+
 @interface GSCXContinuousScanner ()
 
 /**
@@ -37,10 +46,83 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property(strong, nonatomic) id<GSCXContinuousScannerScheduling> scheduler;
 
+/**
+ * Maps the index of a screen in @c screenClusterer to the index of its result in @c scanResults.
+ * Only used if @c screenRetention is not @c GSCXContinuousScannerScreenRetentionAllScans.
+ */
+@property(strong, nonatomic) NSMutableDictionary<NSNumber *, NSNumber *> *resultIndicesByScreen;
+
+/**
+ * Stores results in place of @c _scanResults if @c usesCompactResultStore was @c YES when the
+ * current continuous scan began. @c nil otherwise.
+ */
+@property(strong, nonatomic, nullable) GSCXCompactResultStore *compactResultStore;
+
+/**
+ * Journals the current continuous scan to @c sessionJournalDirectoryURL. @c nil if no directory
+ * was set when the scan began or the session could not be created.
+ */
+@property(strong, nonatomic, nullable) GSCXSessionJournal *sessionJournal;
+
+/**
+ * The number of scans performed in the current continuous scan. Selects the profile in
+ * @c profileRotation.
+ */
+@property(assign, nonatomic) NSUInteger performedScanCount;
+
+/**
+ * The sliced scan in progress, or @c nil if there is none.
+ */
+@property(strong, nonatomic, nullable) GSCXSlicedScan *slicedScan;
+
+/**
+ * The names of the checks that have run on each screen, keyed by the index of the screen in
+ * @c screenClusterer. Only used if @c checkTimeBudgetPerMinute is greater than 0.
+ */
+@property(strong, nonatomic)
+    NSMutableDictionary<NSNumber *, NSMutableSet<NSString *> *> *checkNamesRunByScreen;
+
+/**
+ * The number of elements checked in the most recent scan of each screen, keyed by the index of the
+ * screen in @c screenClusterer. Only used if @c checkTimeBudgetPerMinute is greater than 0.
+ */
+@property(strong, nonatomic) NSMutableDictionary<NSNumber *, NSNumber *> *elementCountsByScreen;
+
+/**
+ * The time checks spent in each scan of the last minute, as pairs of the time the scan began and
+ * its duration, from least to most recent. Only used if @c checkTimeBudgetPerMinute is greater
+ * than 0.
+ */
+@property(strong, nonatomic) NSMutableArray<NSArray<NSNumber *> *> *recentCheckTimeSpent;
+
+/**
+ * The sampler choosing the elements of each screen to check, keyed by the index of the screen in
+ * @c screenClusterer. Only used if @c samplingTickCount is greater than 1.
+ */
+@property(strong, nonatomic)
+    NSMutableDictionary<NSNumber *, GSCXElementSampler *> *samplersByScreen;
+
+/**
+ * The results of the most recent sampled scans of each screen, at most @c samplingTickCount, from
+ * least to most recent, keyed by the index of the screen in @c screenClusterer.
+ */
+@property(strong, nonatomic)
+    NSMutableDictionary<NSNumber *, NSMutableArray<GTXHierarchyResultCollection *> *>
+        *sampledResultsByScreen;
+
+/**
+ * The indices of the screens in @c samplersByScreen, from least to most recently sampled. The
+ * least recently sampled screens are evicted from @c samplersByScreen and
+ * @c sampledResultsByScreen, as in @c GSCXScreenScanQuota.
+ */
+@property(strong, nonatomic) NSMutableArray<NSNumber *> *sampledScreenRecencyOrder;
+
 @end
 
 @implementation GSCXContinuousScanner
 
+@synthesize scanResults = _scanResults;
+
 - (instancetype)initWithScanner:(GSCXScanner *)scanner
                        delegate:(__weak id<GSCXContinuousScannerDelegate>)delegate
                       scheduler:(id<GSCXContinuousScannerScheduling>)scheduler {
@@ -50,6 +132,15 @@ NS_ASSUME_NONNULL_BEGIN
     _delegate = delegate;
     _scheduler = scheduler;
     _scanResults = [NSArray array];
+    _issueDeduplicator = [[GSCXIssueDeduplicator alloc] init];
+    _screenClusterer = [[GSCXScreenClusterer alloc] init];
+    _resultIndicesByScreen = [[NSMutableDictionary alloc] init];
+    _checkNamesRunByScreen = [[NSMutableDictionary alloc] init];
+    _elementCountsByScreen = [[NSMutableDictionary alloc] init];
+    _recentCheckTimeSpent = [[NSMutableArray alloc] init];
+    _samplersByScreen = [[NSMutableDictionary alloc] init];
+    _sampledResultsByScreen = [[NSMutableDictionary alloc] init];
+    _sampledScreenRecencyOrder = [[NSMutableArray alloc] init];
   }
   return self;
 }
@@ -68,6 +159,28 @@ NS_ASSUME_NONNULL_BEGIN
     [self.delegate continuousScannerWillStart:self];
   }
   _scanResults = @[];
+  _compactResultStore = self.usesCompactResultStore ? [[GSCXCompactResultStore alloc] init] : nil;
+  _sessionJournal = nil;
+  if (self.sessionJournalDirectoryURL != nil) {
+    NSError *error;
+    _sessionJournal = [GSCXSessionJournal journalInDirectory:self.sessionJournalDirectoryURL
+                                                       error:&error];
+    if (_sessionJournal == nil) {
+      NSLog(@"Continuous scan results will not be journaled: %@", error);
+    }
+  }
+  [_issueDeduplicator reset];
+  [_screenClusterer reset];
+  [_resultIndicesByScreen removeAllObjects];
+  [_screenScanQuota reset];
+  [_screenshotDeduplicator reset];
+  _performedScanCount = 0;
+  [_checkNamesRunByScreen removeAllObjects];
+  [_elementCountsByScreen removeAllObjects];
+  [_recentCheckTimeSpent removeAllObjects];
+  [_samplersByScreen removeAllObjects];
+  [_sampledResultsByScreen removeAllObjects];
+  [_sampledScreenRecencyOrder removeAllObjects];
   __weak __typeof__(self) weakSelf = self;
   [self.scheduler startSchedulingWithCallback:^(id<GSCXContinuousScannerScheduling> scheduler) {
     return [weakSelf gscx_performScan];
@@ -77,13 +190,31 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)stopScanning {
   GTX_ASSERT([self isScanning], @"Cannot stop scanning while not scanning.");
   [self.scheduler stopScheduling];
+  [self.slicedScan invalidate];
+  NSURL *sessionURL = self.sessionJournal.sessionURL;
+  [self.sessionJournal synchronizeWithCompletion:^{
+    // Indexing now makes reopening the session from the settings page nearly instantaneous.
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+      [GSCXMappedSession writeIndexForSessionAtURL:sessionURL error:nil];
+    });
+  }];
 }
 
 - (BOOL)isScanning {
   return [self.scheduler isScheduling];
 }
 
+- (NSArray<GTXHierarchyResultCollection *> *)scanResults {
+  if (self.compactResultStore != nil) {
+    return [self.compactResultStore results];
+  }
+  return _scanResults;
+}
+
 - (NSUInteger)issueCount {
+  if (self.compactResultStore != nil) {
+    return [self.compactResultStore checkResultCount];
+  }
   NSUInteger count = 0;
   for (GTXHierarchyResultCollection *result in self.scanResults) {
     count += [result checkResultCount];
@@ -91,22 +222,436 @@ NS_ASSUME_NONNULL_BEGIN
   return count;
 }
 
+- (NSUInteger)uniqueIssueCount {
+  return [self.issueDeduplicator uniqueIssueCount];
+}
+
 #pragma mark - Private
 
 /**
- * Performs a scan for accessibility issues. Notifies the delegate that a scan occurred.
+ * Performs a scan for accessibility issues, unless the current screen has reached its quota in
+ * @c screenScanQuota or a sliced scan is in progress. Notifies the delegate when the scan
+ * completes.
  *
- * @return @c YES if a scan occurred, @c NO otherwise. Currently, a scan always occurs, so @c YES is
- * always returned.
+ * @return @c YES if a scan occurred or began, @c NO if it was skipped.
  */
 - (BOOL)gscx_performScan {
-  GTXHierarchyResultCollection *result =
-      [self.scanner scanRootViews:[self.delegate rootViewsToScan]];
-  _scanResults = [_scanResults arrayByAddingObject:result];
+  if (self.slicedScan != nil) {
+    return NO;
+  }
+  NSArray<UIView *> *rootViews = [self.delegate rootViewsToScan];
+  NSUInteger screenIndex = [self.screenClusterer
+      screenIndexForFingerprint:[GSCXScreenFingerprint fingerprintWithRootViews:rootViews]];
+  if (self.screenScanQuota != nil &&
+      ![self.screenScanQuota shouldScanScreenAtIndex:screenIndex time:CACurrentMediaTime()]) {
+    return NO;
+  }
+  NSString *previousProfileName = self.scanner.activeProfileName;
+  [self gscx_activateNextRotatedProfile];
+  if (self.sliceTimeBudget > 0) {
+    __weak __typeof__(self) weakSelf = self;
+    // Sliced scans keep the toolkit that was active when they began, so the previous profile can
+    // be restored immediately.
+    self.slicedScan = [self.scanner
+        beginSlicedScanOfRootViews:rootViews
+                        timeBudget:self.sliceTimeBudget
+                        completion:^(GTXHierarchyResultCollection *_Nullable result) {
+                          __typeof__(self) strongSelf = weakSelf;
+                          strongSelf.slicedScan = nil;
+                          if (result != nil) {
+                            [strongSelf gscx_didPerformScanWithResult:result
+                                                     forScreenAtIndex:screenIndex];
+                          }
+                        }];
+    self.scanner.activeProfileName = previousProfileName;
+    return YES;
+  }
+  CFTimeInterval time = CACurrentMediaTime();
+  GSCXScanOptions *options = [GSCXScanOptions defaultOptions];
+  if (self.checkTimeBudgetPerMinute > 0) {
+    options.measuresCheckCosts = YES;
+    options.throttledCheckNames = [self gscx_throttledCheckNamesForScreenAtIndex:screenIndex
+                                                                            time:time];
+  }
+  if (self.samplingTickCount > 1) {
+    GSCXElementSampler *sampler = [self gscx_samplerForScreenAtIndex:screenIndex];
+    options.elementSampler = ^NSArray *(NSArray *elements) {
+      return [sampler sampleElements:elements];
+    };
+  }
+  GTXHierarchyResultCollection *result = [self.scanner scanRootViews:rootViews options:options];
+  if (self.checkTimeBudgetPerMinute > 0) {
+    [self gscx_recordChecksRunInResult:result onScreenAtIndex:screenIndex time:time];
+  }
+  self.scanner.activeProfileName = previousProfileName;
+  if (options.elementSampler != nil) {
+    [self gscx_didPerformSampledScanWithResult:result forScreenAtIndex:screenIndex];
+  } else {
+    [self gscx_didPerformScanWithResult:result forScreenAtIndex:screenIndex];
+  }
+  return YES;
+}
+
+/**
+ * Retains the result of a scan and notifies the delegate.
+ *
+ * @param result The result of the scan.
+ * @param screenIndex The index of the screen @c result was scanned on.
+ */
+- (void)gscx_didPerformScanWithResult:(GTXHierarchyResultCollection *)result
+                     forScreenAtIndex:(NSUInteger)screenIndex {
+  [_issueDeduplicator addResult:result];
+  [self gscx_retainResult:result forScreenAtIndex:screenIndex];
+  [self gscx_deduplicateScreenshotOfResult:result];
   if ([self.delegate respondsToSelector:@selector(continuousScanner:didPerformScanWithResult:)]) {
     [self.delegate continuousScanner:self didPerformScanWithResult:result];
   }
-  return YES;
+}
+
+/**
+ * Returns the sampler of the screen at @c screenIndex, creating it if needed, and marks the screen
+ * as the most recently sampled. Evicts the least recently sampled screens beyond capacity.
+ *
+ * @param screenIndex The index of the screen in @c screenClusterer.
+ * @return The sampler of the screen.
+ */
+- (GSCXElementSampler *)gscx_samplerForScreenAtIndex:(NSUInteger)screenIndex {
+  NSNumber *key = @(screenIndex);
+  GSCXElementSampler *sampler = self.samplersByScreen[key];
+  if (sampler == nil) {
+    sampler = [[GSCXElementSampler alloc] initWithTickCount:self.samplingTickCount];
+    self.samplersByScreen[key] = sampler;
+  } else {
+    [self.sampledScreenRecencyOrder removeObject:key];
+  }
+  [self.sampledScreenRecencyOrder addObject:key];
+  NSUInteger capacity = self.screenScanQuota != nil ? self.screenScanQuota.capacity
+                                                    : kGSCXScreenScanQuotaDefaultCapacity;
+  while (self.sampledScreenRecencyOrder.count > capacity) {
+    NSNumber *evictedKey = self.sampledScreenRecencyOrder[0];
+    [self.samplersByScreen removeObjectForKey:evictedKey];
+    [self.sampledResultsByScreen removeObjectForKey:evictedKey];
+    [self.sampledScreenRecencyOrder removeObjectAtIndex:0];
+  }
+  return sampler;
+}
+
+/**
+ * Merges the result of a sampled scan into its screen's rolling result, retains the rolling result
+ * in place of the screen's previous one, and notifies the delegate.
+ *
+ * @param result The result of the sampled scan.
+ * @param screenIndex The index of the screen @c result was scanned on.
+ */
+- (void)gscx_didPerformSampledScanWithResult:(GTXHierarchyResultCollection *)result
+                            forScreenAtIndex:(NSUInteger)screenIndex {
+  NSNumber *existingIndex = self.resultIndicesByScreen[@(screenIndex)];
+  NSMutableArray<GTXHierarchyResultCollection *> *sampledResults =
+      self.sampledResultsByScreen[@(screenIndex)];
+  if (sampledResults == nil) {
+    sampledResults = [[NSMutableArray alloc] init];
+    // The screen's rolling state was evicted, but its result was not. Seeding the rolling state
+    // with it keeps issues on elements this scan did not sample until they are sampled again.
+    if (existingIndex != nil) {
+      [sampledResults addObject:[self gscx_resultAtIndex:[existingIndex unsignedIntegerValue]]];
+    }
+    self.sampledResultsByScreen[@(screenIndex)] = sampledResults;
+  }
+  [sampledResults addObject:result];
+  if (sampledResults.count > self.samplingTickCount) {
+    [sampledResults removeObjectAtIndex:0];
+  }
+  // Every element was checked at least once in the retained scans, so merging them approximates a
+  // full scan. The most recent scan's screenshot is kept.
+  GTXHierarchyResultCollection *rollingResult = result;
+  for (NSInteger i = (NSInteger)sampledResults.count - 2; i >= 0; i--) {
+    rollingResult = [GSCXContinuousScanner gscx_resultByMergingResult:sampledResults[i]
+                                                           intoResult:rollingResult];
+  }
+  [_issueDeduplicator addResult:result];
+  if (existingIndex == nil) {
+    self.resultIndicesByScreen[@(screenIndex)] = @([self gscx_resultCount]);
+    [self gscx_appendResult:rollingResult];
+  } else {
+    [self gscx_replaceResultAtIndex:[existingIndex unsignedIntegerValue] withResult:rollingResult];
+  }
+  [self gscx_deduplicateScreenshotOfResult:rollingResult];
+  if ([self.delegate respondsToSelector:@selector(continuousScanner:didPerformScanWithResult:)]) {
+    [self.delegate continuousScanner:self didPerformScanWithResult:result];
+  }
+}
+
+/**
+ * Makes the next profile in @c profileRotation the scanner's active profile and advances the
+ * rotation. Does nothing if @c profileRotation is empty.
+ */
+- (void)gscx_activateNextRotatedProfile {
+  NSArray *profileRotation = self.profileRotation;
+  NSUInteger scanIndex = self.performedScanCount;
+  self.performedScanCount++;
+  if (profileRotation.count == 0) {
+    return;
+  }
+  id profileName = profileRotation[scanIndex % profileRotation.count];
+  self.scanner.activeProfileName = (profileName == [NSNull null]) ? nil : profileName;
+}
+
+/**
+ * Determines which of the scanner's active checks to skip so the time spent by checks stays within
+ * @c checkTimeBudgetPerMinute. Checks that have not run on the screen are never skipped. The others
+ * are included from cheapest to most expensive while their estimated cost fits in the remaining
+ * budget.
+ *
+ * @param screenIndex The index of the screen about to be scanned.
+ * @param time The time the scan begins.
+ * @return The names of the checks to skip.
+ */
+- (NSSet<NSString *> *)gscx_throttledCheckNamesForScreenAtIndex:(NSUInteger)screenIndex
+                                                           time:(CFTimeInterval)time {
+  while (self.recentCheckTimeSpent.count > 0 &&
+         time - [self.recentCheckTimeSpent[0][0] doubleValue] >=
+             kGSCXContinuousScannerCheckTimeBudgetWindow) {
+    [self.recentCheckTimeSpent removeObjectAtIndex:0];
+  }
+  NSTimeInterval remainingBudget = self.checkTimeBudgetPerMinute;
+  for (NSArray<NSNumber *> *timeSpent in self.recentCheckTimeSpent) {
+    remainingBudget -= [timeSpent[1] doubleValue];
+  }
+  GSCXCheckCostModel *costModel = self.scanner.checkCostModel;
+  // Screens that have not been scanned yet fall back to the most recently scanned screen's count.
+  NSNumber *screenElementCount = self.elementCountsByScreen[@(screenIndex)];
+  NSUInteger elementCount = screenElementCount != nil ? [screenElementCount unsignedIntegerValue]
+                                                      : costModel.lastScanElementCount;
+  NSSet<NSString *> *checkNamesRun = self.checkNamesRunByScreen[@(screenIndex)];
+  NSMutableArray<NSString *> *optionalCheckNames = [[NSMutableArray alloc] init];
+  for (id<GTXChecking> check in self.scanner.activeChecks) {
+    NSString *checkName = [check name];
+    if ([checkNamesRun containsObject:checkName]) {
+      [optionalCheckNames addObject:checkName];
+    } else {
+      remainingBudget -= [costModel costPerElementForCheckNamed:checkName] * elementCount;
+    }
+  }
+  [optionalCheckNames sortUsingComparator:^NSComparisonResult(NSString *name1, NSString *name2) {
+    return [@([costModel costPerElementForCheckNamed:name1])
+        compare:@([costModel costPerElementForCheckNamed:name2])];
+  }];
+  NSMutableSet<NSString *> *throttledCheckNames = [[NSMutableSet alloc] init];
+  for (NSString *checkName in optionalCheckNames) {
+    NSTimeInterval estimatedCost = [costModel costPerElementForCheckNamed:checkName] * elementCount;
+    if (estimatedCost <= remainingBudget) {
+      remainingBudget -= estimatedCost;
+    } else {
+      [throttledCheckNames addObject:checkName];
+    }
+  }
+  return throttledCheckNames;
+}
+
+/**
+ * Records which checks ran in a throttled scan, how many elements they checked, and how long they
+ * took. Must be called before the scanner's active profile changes.
+ *
+ * @param result The result of the scan.
+ * @param screenIndex The index of the screen that was scanned.
+ * @param time The time the scan began.
+ */
+- (void)gscx_recordChecksRunInResult:(GTXHierarchyResultCollection *)result
+                     onScreenAtIndex:(NSUInteger)screenIndex
+                                time:(CFTimeInterval)time {
+  NSMutableSet<NSString *> *checkNamesRun = self.checkNamesRunByScreen[@(screenIndex)];
+  if (checkNamesRun == nil) {
+    checkNamesRun = [[NSMutableSet alloc] init];
+    self.checkNamesRunByScreen[@(screenIndex)] = checkNamesRun;
+  }
+  NSArray<NSString *> *throttledCheckNames = result.gscx_throttledCheckNames;
+  for (id<GTXChecking> check in self.scanner.activeChecks) {
+    if (![throttledCheckNames containsObject:[check name]]) {
+      [checkNamesRun addObject:[check name]];
+    }
+  }
+  GSCXCheckCostModel *costModel = self.scanner.checkCostModel;
+  self.elementCountsByScreen[@(screenIndex)] = @(costModel.lastScanElementCount);
+  NSTimeInterval duration = costModel.lastScanDuration;
+  [self.recentCheckTimeSpent addObject:@[ @(time), @(duration) ]];
+}
+
+/**
+ * Adds @c result to @c scanResults according to @c screenRetention.
+ *
+ * @param result The result of the most recent scan.
+ * @param screenIndex The index of the screen @c result was scanned on.
+ */
+- (void)gscx_retainResult:(GTXHierarchyResultCollection *)result
+         forScreenAtIndex:(NSUInteger)screenIndex {
+  NSNumber *existingIndex = self.resultIndicesByScreen[@(screenIndex)];
+  if (self.screenRetention == GSCXContinuousScannerScreenRetentionAllScans ||
+      existingIndex == nil) {
+    if (self.screenRetention != GSCXContinuousScannerScreenRetentionAllScans) {
+      self.resultIndicesByScreen[@(screenIndex)] = @([self gscx_resultCount]);
+    }
+    [self gscx_appendResult:result];
+    return;
+  }
+  NSUInteger resultIndex = [existingIndex unsignedIntegerValue];
+  GTXHierarchyResultCollection *retainedResult = result;
+  if (self.screenRetention == GSCXContinuousScannerScreenRetentionMergedPerScreen) {
+    retainedResult =
+        [GSCXContinuousScanner gscx_resultByMergingResult:result
+                                               intoResult:[self gscx_resultAtIndex:resultIndex]];
+  }
+  [self gscx_replaceResultAtIndex:resultIndex withResult:retainedResult];
+}
+
+/**
+ * @return The number of retained results.
+ */
+- (NSUInteger)gscx_resultCount {
+  if (self.compactResultStore != nil) {
+    return [self.compactResultStore resultCount];
+  }
+  return _scanResults.count;
+}
+
+/**
+ * Returns the retained result at @c index without converting every result in
+ * @c compactResultStore.
+ *
+ * @param index The index of the result.
+ * @return The result at @c index.
+ */
+- (GTXHierarchyResultCollection *)gscx_resultAtIndex:(NSUInteger)index {
+  if (self.compactResultStore != nil) {
+    return [self.compactResultStore resultAtIndex:index];
+  }
+  return _scanResults[index];
+}
+
+/**
+ * Adds @c result to the end of the retained results.
+ *
+ * @param result The result to add.
+ */
+- (void)gscx_appendResult:(GTXHierarchyResultCollection *)result {
+  [self.sessionJournal appendResult:result];
+  if (self.compactResultStore != nil) {
+    [self.compactResultStore addResult:result];
+    return;
+  }
+  _scanResults = [_scanResults arrayByAddingObject:result];
+}
+
+/**
+ * Replaces the retained result at @c index with @c result.
+ *
+ * @param index The index of the result to replace.
+ * @param result The new result.
+ */
+- (void)gscx_replaceResultAtIndex:(NSUInteger)index
+                       withResult:(GTXHierarchyResultCollection *)result {
+  [self.sessionJournal replaceResultAtIndex:index withResult:result];
+  if (self.compactResultStore != nil) {
+    [self.compactResultStore replaceResultAtIndex:index withResult:result];
+    return;
+  }
+  NSMutableArray<GTXHierarchyResultCollection *> *scanResults = [_scanResults mutableCopy];
+  scanResults[index] = result;
+  _scanResults = scanResults;
+}
+
+/**
+ * Replaces @c result in @c scanResults with an equivalent result sharing a previously retained
+ * screenshot, if @c screenshotDeduplicator finds one. Does nothing if @c screenshotDeduplicator is
+ * @c nil or @c result is no longer in @c scanResults when deduplication completes.
+ *
+ * @param result The result of the most recent scan.
+ */
+- (void)gscx_deduplicateScreenshotOfResult:(GTXHierarchyResultCollection *)result {
+  if (self.screenshotDeduplicator == nil) {
+    return;
+  }
+  __weak __typeof__(self) weakSelf = self;
+  [self.screenshotDeduplicator
+      deduplicateResult:result
+             completion:^(GTXHierarchyResultCollection *deduplicatedResult) {
+               __typeof__(self) strongSelf = weakSelf;
+               if (strongSelf == nil || deduplicatedResult == result) {
+                 return;
+               }
+               [strongSelf gscx_replaceResult:result withDeduplicatedResult:deduplicatedResult];
+             }];
+}
+
+/**
+ * Replaces @c result with @c deduplicatedResult in the retained results. Does nothing if
+ * @c result is no longer retained.
+ *
+ * @param result The result whose screenshot was deduplicated.
+ * @param deduplicatedResult An equivalent result sharing a previously retained screenshot.
+ */
+- (void)gscx_replaceResult:(GTXHierarchyResultCollection *)result
+    withDeduplicatedResult:(GTXHierarchyResultCollection *)deduplicatedResult {
+  if (self.compactResultStore != nil) {
+    // The store does not keep result objects, so the result is identified by its screenshot.
+    NSUInteger resultIndex =
+        [self.compactResultStore indexOfResultWithScreenshot:result.screenshot];
+    if (resultIndex != NSNotFound) {
+      [self.compactResultStore setScreenshot:deduplicatedResult.screenshot
+                            forResultAtIndex:resultIndex];
+      GTXHierarchyResultCollection *storedResult =
+          [self.compactResultStore resultAtIndex:resultIndex];
+      [self.sessionJournal replaceResultAtIndex:resultIndex withResult:storedResult];
+    }
+    return;
+  }
+  NSUInteger resultIndex = [_scanResults indexOfObjectIdenticalTo:result];
+  if (resultIndex != NSNotFound) {
+    [self gscx_replaceResultAtIndex:resultIndex withResult:deduplicatedResult];
+  }
+}
+
+/**
+ * Adds the issues in @c newResult that are not already in @c existingResult to @c existingResult.
+ * Issues are compared using @c GSCXIssueDeduplicator keys.
+ *
+ * @param newResult The result containing issues to add.
+ * @param existingResult The result to add issues to.
+ * @return A new result containing the issues in @c existingResult followed by the new issues in
+ *  @c newResult, with @c existingResult's screenshot.
+ */
++ (GTXHierarchyResultCollection *)
+    gscx_resultByMergingResult:(GTXHierarchyResultCollection *)newResult
+                    intoResult:(GTXHierarchyResultCollection *)existingResult {
+  NSMutableSet<NSString *> *existingKeys = [[NSMutableSet alloc] init];
+  for (GTXElementResultCollection *elementResult in existingResult.elementResults) {
+    for (GTXCheckResult *checkResult in elementResult.checkResults) {
+      [existingKeys addObject:[GSCXIssueDeduplicator
+                                  issueKeyForCheckResult:checkResult
+                                        elementReference:elementResult.elementReference]];
+    }
+  }
+  NSMutableArray<GTXElementResultCollection *> *elementResults =
+      [existingResult.elementResults mutableCopy];
+  for (GTXElementResultCollection *elementResult in newResult.elementResults) {
+    NSMutableArray<GTXCheckResult *> *newCheckResults = [[NSMutableArray alloc] init];
+    for (GTXCheckResult *checkResult in elementResult.checkResults) {
+      NSString *issueKey =
+          [GSCXIssueDeduplicator issueKeyForCheckResult:checkResult
+                                       elementReference:elementResult.elementReference];
+      if (![existingKeys containsObject:issueKey]) {
+        [newCheckResults addObject:checkResult];
+      }
+    }
+    if (newCheckResults.count > 0) {
+      [elementResults addObject:[[GTXElementResultCollection alloc]
+                                    initWithElement:elementResult.elementReference
+                                       checkResults:newCheckResults]];
+    }
+  }
+  if (elementResults.count == existingResult.elementResults.count) {
+    return existingResult;
+  }
+  return [existingResult gscx_resultWithElementResults:elementResults];
 }
 
 @end
@@ -51,6 +51,13 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)addCheckWithTitle:(NSString *)title contents:(NSString *)contents;
 
+/**
+ * Removes all checks from @c stackView so this object can be reused to display a different
+ * element. The removed labels are kept and reused by later calls to @c addCheckWithTitle:contents:.
+ * Does not change @c containerView's position or constraints.
+ */
+- (void)removeAllChecks;
+
 /**
  * Updates the content size of @c containerView based on @c stackView. The owner is responsible for
  * calling this method.
@@ -25,6 +25,12 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property(strong, nonatomic) NSMutableArray<UILabel *> *checkLabels;
 
+/**
+ * Labels removed from @c stackView by @c removeAllChecks, reused by @c addCheckWithTitle:contents:
+ * before any new label is created.
+ */
+@property(strong, nonatomic) NSMutableArray<UILabel *> *reusableCheckLabels;
+
 @end
 
 @implementation GSCXContinuousScannerGalleryDetailViewData
@@ -50,25 +56,25 @@ NS_ASSUME_NONNULL_BEGIN
                                                                     metrics:nil
                                                                       views:views]];
     _checkLabels = [NSMutableArray array];
+    _reusableCheckLabels = [NSMutableArray array];
   }
   return self;
 }
 
 - (void)addCheckWithTitle:(NSString *)title contents:(NSString *)contents {
-  UILabel *titleLabel = [[UILabel alloc] init];
-  titleLabel.text = title;
-  titleLabel.numberOfLines = 0;
-  titleLabel.font = [UIFont preferredFontForTextStyle:UIFontTextStyleTitle1];
-  titleLabel.textColor = self.textColor;
-  [self.stackView addArrangedSubview:titleLabel];
-  [self.checkLabels addObject:titleLabel];
-  UILabel *contentsLabel = [[UILabel alloc] init];
-  contentsLabel.text = contents;
-  contentsLabel.numberOfLines = 0;
-  contentsLabel.font = [UIFont preferredFontForTextStyle:UIFontTextStyleBody];
-  contentsLabel.textColor = self.textColor;
-  [self.stackView addArrangedSubview:contentsLabel];
-  [self.checkLabels addObject:contentsLabel];
+  [self gscx_addCheckLabelWithText:title
+                               font:[UIFont preferredFontForTextStyle:UIFontTextStyleTitle1]];
+  [self gscx_addCheckLabelWithText:contents
+                               font:[UIFont preferredFontForTextStyle:UIFontTextStyleBody]];
+}
+
+- (void)removeAllChecks {
+  for (UILabel *label in self.checkLabels) {
+    [label removeFromSuperview];
+  }
+  [self.reusableCheckLabels addObjectsFromArray:self.checkLabels];
+  [self.checkLabels removeAllObjects];
+  self.containerView.contentOffset = CGPointZero;
 }
 
 - (void)didLayoutSubviews {
@@ -87,6 +93,30 @@ NS_ASSUME_NONNULL_BEGIN
   _textColor = textColor;
 }
 
+#pragma mark - Private
+
+/**
+ * Adds a label displaying @c text to the bottom of @c stackView, reusing a label removed by
+ * @c removeAllChecks if there is one.
+ *
+ * @param text The text of the label.
+ * @param font The font of the label.
+ */
+- (void)gscx_addCheckLabelWithText:(NSString *)text font:(UIFont *)font {
+  UILabel *label = [self.reusableCheckLabels lastObject];
+  if (label != nil) {
+    [self.reusableCheckLabels removeLastObject];
+  } else {
+    label = [[UILabel alloc] init];
+    label.numberOfLines = 0;
+  }
+  label.text = text;
+  label.font = font;
+  label.textColor = self.textColor;
+  [self.stackView addArrangedSubview:label];
+  [self.checkLabels addObject:label];
+}
+
 @end
 
 NS_ASSUME_NONNULL_END
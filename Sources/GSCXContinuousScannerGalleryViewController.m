@@ -19,6 +19,7 @@
 #import "GSCXContinuousScannerGalleryDetailViewData.h"
 #import "GSCXRingViewArranger.h"
 #import "GSCXScannerScreenshotViewController.h"
+#import "GTXHierarchyResultCollection+GSCXScreenshot.h"
 #import "NSLayoutConstraint+GSCXUtilities.h"
 #import "UIView+NSLayoutConstraint.h"
 #import "UIViewController+GSCXAppearance.h"
@@ -34,6 +35,12 @@ const CGFloat kGSCXContinuousScannerGalleryZoomScale = 10.0;
  */
 static const CGFloat kGSCXContinuousScannerPageIndicatorAlpha = 0.2;
 
+/**
+ * The number of pages on each side of the current page whose detail views are kept in the detail
+ * scroll view. Detail views for all other pages are recycled.
+ */
+static const NSInteger kGSCXContinuousScannerGalleryDetailViewPageRadius = 1;
+
 @interface GSCXContinuousScannerGalleryViewController () <UIScrollViewDelegate>
 
 /**
@@ -67,9 +74,18 @@ static const CGFloat kGSCXContinuousScannerPageIndicatorAlpha = 0.2;
 @property(weak, nonatomic) IBOutlet UIPageControl *pageControl;
 
 /**
- * Encapsulate detailed information on accessibility issues for individual elements.
+ * Encapsulate detailed information on accessibility issues for the elements on the current page and
+ * its neighbors, keyed by page index.
+ */
+@property(strong, nonatomic)
+    NSMutableDictionary<NSNumber *, GSCXContinuousScannerGalleryDetailViewData *> *detailViews;
+
+/**
+ * Detail views that are not displaying any page and can be reused for the next page that becomes
+ * visible.
  */
-@property(strong, nonatomic) NSArray<GSCXContinuousScannerGalleryDetailViewData *> *detailViews;
+@property(strong, nonatomic)
+    NSMutableArray<GSCXContinuousScannerGalleryDetailViewData *> *reusableDetailViews;
 
 /**
  * The index to focus when the view appears on screen. In some cases, the size of the view is
@@ -98,6 +114,8 @@ static const CGFloat kGSCXContinuousScannerPageIndicatorAlpha = 0.2;
   self = [super initWithNibName:nibNameOrNil bundle:nibBundleOrNil];
   if (self != nil) {
     _result = result;
+    _detailViews = [[NSMutableDictionary alloc] init];
+    _reusableDetailViews = [[NSMutableArray alloc] init];
   }
   return self;
 }
@@ -110,7 +128,6 @@ static const CGFloat kGSCXContinuousScannerPageIndicatorAlpha = 0.2;
   [self gscx_initializeDetailScrollView];
   [self gscx_initializeScrollViewConstraints];
   [self gscx_initializePageControl];
-  [self gscx_initializeDetailViews];
 }
 
 - (void)viewWillLayoutSubviews {
@@ -129,9 +146,7 @@ static const CGFloat kGSCXContinuousScannerPageIndicatorAlpha = 0.2;
   }
   self.detailScrollView.contentSize = CGSizeMake(viewWidth * self.result.elementResults.count,
                                                  self.detailScrollView.frame.size.height);
-  for (GSCXContinuousScannerGalleryDetailViewData *detailView in self.detailViews) {
-    [detailView didLayoutSubviews];
-  }
+  [self gscx_tileDetailViewsAroundPage:self.pageControl.currentPage];
   [self gscx_centerScreenshotForIssueAtIndex:self.pageControl.currentPage animated:NO];
   [self gscx_displayDetailsForIssueAtIndex:self.pageControl.currentPage animated:NO];
   // Content insets let the scroll view zoom and center ring views correctly, even if the ring views
@@ -166,11 +181,18 @@ static const CGFloat kGSCXContinuousScannerPageIndicatorAlpha = 0.2;
 
 #pragma mark - UIScrollViewDelegate
 
+- (void)scrollViewDidScroll:(UIScrollView *)scrollView {
+  if (scrollView != self.detailScrollView) {
+    return;
+  }
+  [self gscx_tileDetailViewsAroundPage:[self gscx_pageAtContentOffset]];
+}
+
 - (void)scrollViewDidEndDecelerating:(UIScrollView *)scrollView {
   if (scrollView != self.detailScrollView) {
     return;
   }
-  NSInteger page = (NSInteger)floor(scrollView.contentOffset.x / scrollView.frame.size.width);
+  NSInteger page = [self gscx_pageAtContentOffset];
   [self.pageControl setCurrentPage:page];
   [self gscx_centerScreenshotForIssueAtIndex:page animated:YES];
 }
@@ -187,8 +209,7 @@ static const CGFloat kGSCXContinuousScannerPageIndicatorAlpha = 0.2;
  */
 - (void)gscx_initializeScreenshot {
   self.screenshot = [[UIImageView alloc] initWithImage:self.result.screenshot];
-  CGRect originalCoordinates =
-      CGRectMake(0, 0, self.result.screenshot.size.width, self.result.screenshot.size.height);
+  CGRect originalCoordinates = self.result.gscx_screenshotFrame;
   self.ringViewArranger = [[GSCXRingViewArranger alloc] initWithResult:self.result];
   [self.ringViewArranger addRingViewsToSuperview:self.screenshot
                                  fromCoordinates:originalCoordinates];
@@ -303,61 +324,106 @@ static const CGFloat kGSCXContinuousScannerPageIndicatorAlpha = 0.2;
 }
 
 /**
- * Initializes the detail views for each element with accessibility issues.
+ * @return The index of the page closest to the current content offset of @c detailScrollView,
+ *  clamped to the valid page indices.
+ */
+- (NSInteger)gscx_pageAtContentOffset {
+  CGFloat pageWidth = CGRectGetWidth(self.detailScrollView.bounds);
+  if (pageWidth <= 0.0) {
+    return 0;
+  }
+  NSInteger page = (NSInteger)round(self.detailScrollView.contentOffset.x / pageWidth);
+  return MAX(0, MIN(page, (NSInteger)self.result.elementResults.count - 1));
+}
+
+/**
+ * Returns the frame in @c detailScrollView's content of the page at @c page.
+ *
+ * @param page The index of the page.
+ * @return The frame of the page at @c page.
+ */
+- (CGRect)gscx_frameForDetailViewAtPage:(NSInteger)page {
+  CGSize pageSize = self.detailScrollView.bounds.size;
+  return CGRectMake(pageSize.width * page, 0.0, pageSize.width, pageSize.height);
+}
+
+/**
+ * Ensures detail views exist for @c page and its neighbors, positioned at their pages. Detail views
+ * for all other pages are recycled. Only a constant number of detail views exist at once,
+ * regardless of how many elements @c result contains.
+ *
+ * @param page The index of the page the user is looking at.
  */
-- (void)gscx_initializeDetailViews {
-  NSMutableArray<GSCXContinuousScannerGalleryDetailViewData *> *detailViews =
-      [NSMutableArray array];
-  UIView *previousView = self.detailScrollView;
-  for (GTXElementResultCollection *elementResult in self.result.elementResults) {
-    GSCXContinuousScannerGalleryDetailViewData *detailView =
-        [[GSCXContinuousScannerGalleryDetailViewData alloc] init];
-    detailView.backgroundColor = [self gscx_backgroundColorForCurrentAppearance];
-    detailView.textColor = [self gscx_textColorForCurrentAppearance];
-    for (GTXCheckResult *checkResult in elementResult.checkResults) {
-      [detailView addCheckWithTitle:checkResult.checkName contents:checkResult.errorDescription];
+- (void)gscx_tileDetailViewsAroundPage:(NSInteger)page {
+  NSInteger firstPage = MAX(0, page - kGSCXContinuousScannerGalleryDetailViewPageRadius);
+  NSInteger lastPage = MIN((NSInteger)self.result.elementResults.count - 1,
+                           page + kGSCXContinuousScannerGalleryDetailViewPageRadius);
+  for (NSNumber *visiblePage in [self.detailViews allKeys]) {
+    NSInteger pageIndex = [visiblePage integerValue];
+    if (pageIndex < firstPage || pageIndex > lastPage) {
+      GSCXContinuousScannerGalleryDetailViewData *detailView = self.detailViews[visiblePage];
+      detailView.containerView.hidden = YES;
+      [self.reusableDetailViews addObject:detailView];
+      [self.detailViews removeObjectForKey:visiblePage];
+    }
+  }
+  for (NSInteger pageIndex = firstPage; pageIndex <= lastPage; pageIndex++) {
+    GSCXContinuousScannerGalleryDetailViewData *detailView = self.detailViews[@(pageIndex)];
+    if (detailView == nil) {
+      detailView = [self gscx_dequeueDetailView];
+      [self gscx_configureDetailView:detailView
+                    forElementResult:self.result.elementResults[pageIndex]];
+      self.detailViews[@(pageIndex)] = detailView;
+    }
+    CGRect frame = [self gscx_frameForDetailViewAtPage:pageIndex];
+    if (!CGRectEqualToRect(detailView.containerView.frame, frame)) {
+      detailView.containerView.frame = frame;
+      [detailView.containerView layoutIfNeeded];
+      [detailView didLayoutSubviews];
     }
-    [self.detailScrollView addSubview:detailView.containerView];
-    [detailViews addObject:detailView];
-    [self gscx_constrainDetailView:detailView toPreviousView:previousView];
-    previousView = detailView.containerView;
   }
-  self.detailViews = detailViews;
 }
 
 /**
- * Adds constraints to the detail views.
+ * Returns a detail view that does not display any page, creating one if none can be reused.
+ *
+ * @return A detail view added to @c detailScrollView and not displaying any checks.
  */
-- (void)gscx_constrainDetailView:(GSCXContinuousScannerGalleryDetailViewData *)detailView
-                  toPreviousView:(UIView *)previousView {
-  id safeAreaView = self.view;
-  if (@available(iOS 11.0, *)) {
-    safeAreaView = self.view.safeAreaLayoutGuide;
+- (GSCXContinuousScannerGalleryDetailViewData *)gscx_dequeueDetailView {
+  GSCXContinuousScannerGalleryDetailViewData *detailView = [self.reusableDetailViews lastObject];
+  if (detailView != nil) {
+    [self.reusableDetailViews removeLastObject];
+    [detailView removeAllChecks];
+    detailView.containerView.hidden = NO;
+    return detailView;
   }
-  NSDictionary<NSString *, id> *views = @{
-    @"previousView" : previousView,
-    @"stackView" : detailView.stackView,
-    @"nextView" : detailView.containerView,
-    @"superview" : self.detailScrollView,
-    @"view" : safeAreaView
-  };
-  [NSLayoutConstraint
-      activateConstraints:[NSLayoutConstraint
-                              constraintsWithVisualFormat:@"[previousView][nextView(==view)]"
-                                                  options:0
-                                                  metrics:nil
-                                                    views:views]];
-  [NSLayoutConstraint
-      activateConstraints:[NSLayoutConstraint constraintsWithVisualFormat:@"[stackView(==view)]"
-                                                                  options:0
-                                                                  metrics:nil
-                                                                    views:views]];
-  [NSLayoutConstraint
-      activateConstraints:[NSLayoutConstraint
-                              constraintsWithVisualFormat:@"V:|[nextView(==superview)]"
-                                                  options:0
-                                                  metrics:nil
-                                                    views:views]];
+  detailView = [[GSCXContinuousScannerGalleryDetailViewData alloc] init];
+  detailView.backgroundColor = [self gscx_backgroundColorForCurrentAppearance];
+  detailView.textColor = [self gscx_textColorForCurrentAppearance];
+  // Detail views are positioned manually as pages scroll, so they use frames instead of
+  // constraints. The stack view still tracks the page width.
+  detailView.containerView.translatesAutoresizingMaskIntoConstraints = YES;
+  [detailView.stackView.widthAnchor constraintEqualToAnchor:detailView.containerView.widthAnchor]
+      .active = YES;
+  [self.detailScrollView addSubview:detailView.containerView];
+  return detailView;
+}
+
+/**
+ * Adds a title and description for each check in @c elementResult to @c detailView.
+ *
+ * @param detailView The detail view to display the checks in.
+ * @param elementResult The element whose checks are displayed.
+ */
+- (void)gscx_configureDetailView:(GSCXContinuousScannerGalleryDetailViewData *)detailView
+                forElementResult:(GTXElementResultCollection *)elementResult {
+  for (GTXCheckResult *checkResult in elementResult.checkResults) {
+    [detailView addCheckWithTitle:checkResult.checkName contents:checkResult.errorDescription];
+  }
+  // The frame is unchanged when reused for a page at the same position, so the content size must be
+  // updated here.
+  [detailView.containerView layoutIfNeeded];
+  [detailView didLayoutSubviews];
 }
 
 /**
@@ -395,8 +461,11 @@ static const CGFloat kGSCXContinuousScannerPageIndicatorAlpha = 0.2;
  */
 - (void)gscx_displayDetailsForIssueAtIndex:(NSUInteger)index animated:(BOOL)animated {
   animated = animated && !UIAccessibilityIsReduceMotionEnabled();
-  [self.detailScrollView scrollRectToVisible:self.detailViews[index].containerView.frame
+  [self.detailScrollView scrollRectToVisible:[self gscx_frameForDetailViewAtPage:index]
                                     animated:animated];
+  if (!animated) {
+    [self gscx_tileDetailViewsAroundPage:index];
+  }
 }
 
 @end
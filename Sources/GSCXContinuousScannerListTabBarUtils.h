@@ -17,9 +17,25 @@
 #import <Foundation/Foundation.h>
 
 #import "GSCXScannerIssueTableViewSection.h"
+#import "GSCXUniqueIssue.h"
 #import <GTXiLib/GTXiLib.h>
 NS_ASSUME_NONNULL_BEGIN
 
+/**
+ * Invoked when sections built on a background queue are ready.
+ *
+ * @param byScanSections Sections grouped by scan, as returned by
+ *  @c sectionsWithGroupedByScanResults:.
+ * @param byCheckSections Sections grouped by check, as returned by
+ *  @c sectionsWithGroupedByCheckResults:.
+ * @param uniqueSections Sections containing each unique issue once, as returned by
+ *  @c sectionsWithUniqueIssues:inResults:.
+ */
+typedef void (^GSCXContinuousScannerListTabBarUtilsSectionsBlock)(
+    NSArray<GSCXScannerIssueTableViewSection *> *byScanSections,
+    NSArray<GSCXScannerIssueTableViewSection *> *byCheckSections,
+    NSArray<GSCXScannerIssueTableViewSection *> *uniqueSections);
+
 /**
  * Contains factory methods for constructing @c GSCXScannerIssueTableViewSection objects to display
  * in the list view.
@@ -31,7 +47,8 @@ NS_ASSUME_NONNULL_BEGIN
  * @c GSCXScannerIssueTableViewSection instances. Each @c GSCXScannerIssueTableViewSection
  * represents a single scan on a single screen. Each row in a section represents a single UI element
  * with accessibility issues found in that scan. Each suggestion in a row represents a single
- * underlying accessibility issue and a suggested fix.
+ * underlying accessibility issue and a suggested fix. Rows are created lazily, when first
+ * requested.
  *
  * @param results The results to convert to table view sections.
  * @return An array of table view sections each representing a single scan in the same order as
@@ -46,6 +63,8 @@ NS_ASSUME_NONNULL_BEGIN
  * represents a single @c id<GTXChecking> instance representing an accessibility issue. Each row in
  * a section represents a single UI element with the corresponding accessibility issue. Each row
  * contains a single suggestion describing the accessibility issue in question and a suggested fix.
+ * Only the indices of each issue are computed up front. Rows are created lazily, when first
+ * requested.
  *
  * @param results The results to convert to table view sections.
  * @return An array of table view sections each representing a single accessibility check.
@@ -53,6 +72,50 @@ NS_ASSUME_NONNULL_BEGIN
 + (NSArray<GSCXScannerIssueTableViewSection *> *)sectionsWithGroupedByCheckResults:
     (NSArray<GTXHierarchyResultCollection *> *)results;
 
+/**
+ * Converts an array of @c GSCXUniqueIssue instances to an array of
+ * @c GSCXScannerIssueTableViewSection instances. Each section represents a single check. Each row
+ * in a section represents a single unique issue, with a subtitle describing how many times and in
+ * which scans it occurred. Rows are created lazily, when first requested.
+ *
+ * @param uniqueIssues The unique issues to convert to table view sections.
+ * @param results The results @c uniqueIssues were found in, in scan order. Each row looks up the
+ *  result containing its issue when the row is created.
+ * @return An array of table view sections each representing a single accessibility check, ordered
+ *  alphabetically by check name.
+ */
++ (NSArray<GSCXScannerIssueTableViewSection *> *)
+    sectionsWithUniqueIssues:(NSArray<GSCXUniqueIssue *> *)uniqueIssues
+                   inResults:(NSArray<GTXHierarchyResultCollection *> *)results;
+
+/**
+ * Converts unique issues grouped by screen, as returned by
+ * @c GSCXSessionDiff's @c issuesByScreenIndexWithChange:, to an array of
+ * @c GSCXScannerIssueTableViewSection instances. Each section represents a single screen and is
+ * titled after the first scan its issues were seen in. Each row in a section represents a single
+ * unique issue. Rows are created lazily, when first requested.
+ *
+ * @param issuesByScreenIndex The unique issues to convert, keyed by screen index.
+ * @param results The results the issues were found in, in scan order.
+ * @return An array of table view sections each representing a single screen, ordered by screen
+ *  index.
+ */
++ (NSArray<GSCXScannerIssueTableViewSection *> *)
+    sectionsWithUniqueIssuesByScreenIndex:
+        (NSDictionary<NSNumber *, NSArray<GSCXUniqueIssue *> *> *)issuesByScreenIndex
+                                inResults:(NSArray<GTXHierarchyResultCollection *> *)results;
+
+/**
+ * Builds sections grouped by scan, sections grouped by check, and sections of unique issues on a
+ * background queue, then invokes
+ * @c completion on the main queue. @c results must not be mutated until @c completion is invoked.
+ *
+ * @param results The results to convert to table view sections.
+ * @param completion Invoked on the main queue with the built sections.
+ */
++ (void)buildSectionsWithResults:(NSArray<GTXHierarchyResultCollection *> *)results
+                      completion:(GSCXContinuousScannerListTabBarUtilsSectionsBlock)completion;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -16,12 +16,35 @@
 
 #import "GSCXContinuousScannerListTabBarUtils.h"
 
+#import "GSCXIssueDeduplicator.h"
+#import "NSArray+GSCXResults.h"
+
+/**
+ * Locates a single accessibility issue across a session of scans.
+ */
+typedef struct {
+  /**
+   * The index of the scan containing the issue.
+   */
+  NSUInteger scanIndex;
+
+  /**
+   * The index of the element in the scan.
+   */
+  NSUInteger elementIndex;
+
+  /**
+   * The index of the check result in the element.
+   */
+  NSUInteger checkIndex;
+} GSCXIssueIndex;
+
 /**
- * Data type for mapping the name of an @c id<GTXChecking> instance to all the rows associated with
- * that check.
+ * Data type for mapping the name of an @c id<GTXChecking> instance to the packed
+ * @c GSCXIssueIndex values of all issues associated with that check.
  */
-typedef NSMutableDictionary<NSString *, NSMutableArray<GSCXScannerIssueTableViewRow *> *>
-    GSCXRowsByCheckNameMutableDictionary;
+typedef NSMutableDictionary<NSString *, NSMutableData *>
+    GSCXIssueIndicesByCheckNameMutableDictionary;
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -29,61 +52,162 @@ NS_ASSUME_NONNULL_BEGIN
 
 + (NSArray<GSCXScannerIssueTableViewSection *> *)sectionsWithGroupedByScanResults:
     (NSArray<GTXHierarchyResultCollection *> *)results {
-  NSMutableArray<GSCXScannerIssueTableViewSection *> *sections = [[NSMutableArray alloc] init];
-  NSInteger sectionIndex = 0;
-  for (GTXHierarchyResultCollection *result in results) {
-    [sections addObject:[self gscx_sectionFromResult:result atIndex:sectionIndex]];
-    sectionIndex++;
+  NSMutableArray<GSCXScannerIssueTableViewSection *> *sections =
+      [[NSMutableArray alloc] initWithCapacity:results.count];
+  for (NSUInteger scanIndex = 0; scanIndex < results.count; scanIndex++) {
+    [sections addObject:[self gscx_sectionFromResultAtIndex:scanIndex inResults:results]];
   }
   return sections;
 }
 
 + (NSArray<GSCXScannerIssueTableViewSection *> *)sectionsWithGroupedByCheckResults:
     (NSArray<GTXHierarchyResultCollection *> *)results {
-  GSCXRowsByCheckNameMutableDictionary *rowsByCheckName = [[NSMutableDictionary alloc] init];
-  NSUInteger scanIndex = 0;
-  for (GTXHierarchyResultCollection *result in results) {
-    NSInteger elementResultIndex = 0;
-    for (GTXElementResultCollection *elementResult in result.elementResults) {
-      [GSCXContinuousScannerListTabBarUtils
-          gscx_addRowsForChecksInElementResult:elementResult
-                                  toDictionary:rowsByCheckName
-                                     scanIndex:scanIndex
-                                      inResult:result
-                          originalElementIndex:elementResultIndex];
-      elementResultIndex++;
+  GSCXIssueIndicesByCheckNameMutableDictionary *indicesByCheckName =
+      [[NSMutableDictionary alloc] init];
+  GSCXIssueIndex issueIndex;
+  for (issueIndex.scanIndex = 0; issueIndex.scanIndex < results.count; issueIndex.scanIndex++) {
+    NSArray<GTXElementResultCollection *> *elementResults =
+        [results gscx_elementResultsOfResultAtIndex:issueIndex.scanIndex];
+    for (issueIndex.elementIndex = 0; issueIndex.elementIndex < elementResults.count;
+         issueIndex.elementIndex++) {
+      NSArray<GTXCheckResult *> *checkResults =
+          elementResults[issueIndex.elementIndex].checkResults;
+      for (issueIndex.checkIndex = 0; issueIndex.checkIndex < checkResults.count;
+           issueIndex.checkIndex++) {
+        NSString *checkName = checkResults[issueIndex.checkIndex].checkName;
+        NSMutableData *indices = indicesByCheckName[checkName];
+        if (indices == nil) {
+          indices = [[NSMutableData alloc] init];
+          indicesByCheckName[checkName] = indices;
+        }
+        [indices appendBytes:&issueIndex length:sizeof(issueIndex)];
+      }
+    }
+  }
+  return [GSCXContinuousScannerListTabBarUtils
+      gscx_sectionsFromIndicesByCheckName:indicesByCheckName
+                                  results:results];
+}
+
++ (NSArray<GSCXScannerIssueTableViewSection *> *)
+    sectionsWithUniqueIssues:(NSArray<GSCXUniqueIssue *> *)uniqueIssues
+                   inResults:(NSArray<GTXHierarchyResultCollection *> *)results {
+  NSMutableDictionary<NSString *, NSMutableArray<GSCXUniqueIssue *> *> *issuesByCheckName =
+      [[NSMutableDictionary alloc] init];
+  for (GSCXUniqueIssue *issue in uniqueIssues) {
+    if (issuesByCheckName[issue.checkName] == nil) {
+      issuesByCheckName[issue.checkName] = [[NSMutableArray alloc] init];
     }
-    scanIndex++;
+    [issuesByCheckName[issue.checkName] addObject:issue];
   }
-  return [GSCXContinuousScannerListTabBarUtils gscx_sectionsFromRowsByCheckName:rowsByCheckName];
+  NSArray<NSString *> *sortedCheckNames =
+      [[issuesByCheckName allKeys] sortedArrayUsingSelector:@selector(compare:)];
+  NSMutableArray<GSCXScannerIssueTableViewSection *> *sections =
+      [[NSMutableArray alloc] initWithCapacity:sortedCheckNames.count];
+  for (NSString *checkName in sortedCheckNames) {
+    NSArray<GSCXUniqueIssue *> *issues = [issuesByCheckName[checkName] copy];
+    [sections addObject:[[GSCXScannerIssueTableViewSection alloc]
+                                  initWithTitle:checkName
+                                       subtitle:nil
+                                   numberOfRows:issues.count
+                            numberOfSuggestions:issues.count
+                                    rowProvider:^GSCXScannerIssueTableViewRow *(
+                                        NSUInteger rowIndex) {
+                                      return [GSCXContinuousScannerListTabBarUtils
+                                          gscx_rowFromUniqueIssue:issues[rowIndex]
+                                                        inResults:results];
+                                    }]];
+  }
+  return sections;
+}
+
++ (NSArray<GSCXScannerIssueTableViewSection *> *)
+    sectionsWithUniqueIssuesByScreenIndex:
+        (NSDictionary<NSNumber *, NSArray<GSCXUniqueIssue *> *> *)issuesByScreenIndex
+                                inResults:(NSArray<GTXHierarchyResultCollection *> *)results {
+  NSArray<NSNumber *> *sortedScreenIndexes =
+      [[issuesByScreenIndex allKeys] sortedArrayUsingSelector:@selector(compare:)];
+  NSMutableArray<GSCXScannerIssueTableViewSection *> *sections =
+      [[NSMutableArray alloc] initWithCapacity:sortedScreenIndexes.count];
+  for (NSNumber *screenIndex in sortedScreenIndexes) {
+    NSArray<GSCXUniqueIssue *> *issues = [issuesByScreenIndex[screenIndex] copy];
+    // TODO: Localize this and load it from an external resource instead of hardcoding
+    // it.
+    NSString *title = [NSString
+        stringWithFormat:@"Screen %lu", (unsigned long)(issues[0].firstSeenScanIndex + 1)];
+    [sections addObject:[[GSCXScannerIssueTableViewSection alloc]
+                                  initWithTitle:title
+                                       subtitle:nil
+                                   numberOfRows:issues.count
+                            numberOfSuggestions:issues.count
+                                    rowProvider:^GSCXScannerIssueTableViewRow *(
+                                        NSUInteger rowIndex) {
+                                      return [GSCXContinuousScannerListTabBarUtils
+                                          gscx_rowFromUniqueIssue:issues[rowIndex]
+                                                        inResults:results];
+                                    }]];
+  }
+  return sections;
+}
+
++ (void)buildSectionsWithResults:(NSArray<GTXHierarchyResultCollection *> *)results
+                      completion:(GSCXContinuousScannerListTabBarUtilsSectionsBlock)completion {
+  // Arrays that decode results on access return themselves when copied, so this does not load
+  // every result.
+  NSArray<GTXHierarchyResultCollection *> *resultsCopy = [results copy];
+  dispatch_async(dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^{
+    NSArray<GSCXScannerIssueTableViewSection *> *byScanSections =
+        [GSCXContinuousScannerListTabBarUtils sectionsWithGroupedByScanResults:resultsCopy];
+    NSArray<GSCXScannerIssueTableViewSection *> *byCheckSections =
+        [GSCXContinuousScannerListTabBarUtils sectionsWithGroupedByCheckResults:resultsCopy];
+    NSArray<GSCXUniqueIssue *> *uniqueIssues =
+        [GSCXIssueDeduplicator deduplicatorWithResults:resultsCopy].uniqueIssues;
+    NSArray<GSCXScannerIssueTableViewSection *> *uniqueSections =
+        [GSCXContinuousScannerListTabBarUtils sectionsWithUniqueIssues:uniqueIssues
+                                                             inResults:resultsCopy];
+    dispatch_async(dispatch_get_main_queue(), ^{
+      completion(byScanSections, byCheckSections, uniqueSections);
+    });
+  });
 }
 
 #pragma mark - Private
 
 /**
- * Converts a @c GTXHierarchyResultCollection instance into a @c GSCXScannerIssueTableViewSection
- * instance. Each row in the section corresponds to an element in @c result.
+ * Converts the result at @c scanIndex into a lazily populated
+ * @c GSCXScannerIssueTableViewSection instance. Each row in the section corresponds to an element
+ * in the result. Only the element results are read up front. The result itself is looked up when a
+ * row is created, so sections do not retain results or load their screenshots.
  *
- * @param result The result to convert into a section.
- * @param scanIndex The index of the scan @c result represents.
+ * @param scanIndex The index of the result to convert into a section.
+ * @param results The results containing the result to convert.
  * @return A @c GSCXScannerIssueTableViewSection instance containing rows representing the elements
- * in
- * @c result.
+ *  in the result at @c scanIndex.
  */
-+ (GSCXScannerIssueTableViewSection *)gscx_sectionFromResult:(GTXHierarchyResultCollection *)result
-                                                     atIndex:(NSInteger)scanIndex {
++ (GSCXScannerIssueTableViewSection *)
+    gscx_sectionFromResultAtIndex:(NSUInteger)scanIndex
+                        inResults:(NSArray<GTXHierarchyResultCollection *> *)results {
+  NSArray<GTXElementResultCollection *> *elementResults =
+      [results gscx_elementResultsOfResultAtIndex:scanIndex];
+  NSUInteger checkResultCount = 0;
+  for (GTXElementResultCollection *elementResult in elementResults) {
+    checkResultCount += elementResult.checkResults.count;
+  }
   // TODO: Localize this and load it from an external resource instead of hardcoding
   // it.
-  NSString *title = [NSString stringWithFormat:@"Screen %ld", (long)(scanIndex + 1)];
-  NSMutableArray<GSCXScannerIssueTableViewRow *> *rows = [[NSMutableArray alloc] init];
-  NSInteger elementResultIndex = 0;
-  for (GTXElementResultCollection *elementResult in result.elementResults) {
-    [rows addObject:[self gscx_rowFromElementResult:elementResult
-                                           inResult:result
-                                            atIndex:elementResultIndex]];
-    elementResultIndex++;
-  }
-  return [[GSCXScannerIssueTableViewSection alloc] initWithTitle:title subtitle:nil rows:rows];
+  NSString *title = [NSString stringWithFormat:@"Screen %lu", (unsigned long)(scanIndex + 1)];
+  return [[GSCXScannerIssueTableViewSection alloc]
+             initWithTitle:title
+                  subtitle:nil
+              numberOfRows:elementResults.count
+       numberOfSuggestions:checkResultCount
+               rowProvider:^GSCXScannerIssueTableViewRow *(NSUInteger rowIndex) {
+                 GTXHierarchyResultCollection *result = results[scanIndex];
+                 return [GSCXContinuousScannerListTabBarUtils
+                     gscx_rowFromElementResult:result.elementResults[rowIndex]
+                                      inResult:result
+                                       atIndex:(NSInteger)rowIndex];
+               }];
 }
 
 /**
@@ -118,109 +242,103 @@ NS_ASSUME_NONNULL_BEGIN
 }
 
 /**
- * Adds a row for each underlying issue in @c elementResult to @c rowsByCheckName.
- *
- * @param elementResult The element containing underlying accessibilty issues to add to
- *  @c rowsByCheckName.
- * @param rowsByCheckName A dictionary mapping check names to rows representing UI elements failing
- *  the corresponding check.
- * @param scanIndex The index of the @c GTXHierarchyResultCollection instance containing
- *  @c elementResult.
- * @param result The result containing @c elementResult.
- * @param originalElementResult The index of the element in @c result.
- */
-+ (void)gscx_addRowsForChecksInElementResult:(GTXElementResultCollection *)elementResult
-                                toDictionary:(GSCXRowsByCheckNameMutableDictionary *)rowsByCheckName
-                                   scanIndex:(NSUInteger)scanIndex
-                                    inResult:(GTXHierarchyResultCollection *)result
-                        originalElementIndex:(NSInteger)originalElementIndex {
-  for (NSUInteger i = 0; i < elementResult.checkResults.count; i++) {
-    NSString *checkName = elementResult.checkResults[i].checkName;
-    GSCXScannerIssueTableViewRow *row =
-        [GSCXContinuousScannerListTabBarUtils gscx_rowFromElementResult:elementResult
-                                                       onlyCheckAtIndex:i
-                                                              scanIndex:scanIndex
-                                                               inResult:result
-                                                   originalElementIndex:originalElementIndex];
-    if ([rowsByCheckName objectForKey:checkName] == nil) {
-      [rowsByCheckName setObject:[[NSMutableArray alloc] init] forKey:checkName];
-    }
-    [[rowsByCheckName objectForKey:checkName] addObject:row];
-  }
-}
-
-/**
- * Constructs a @c GSCXScannerIssueTableViewRow instance for the UI element associated with
- * @c elementResult containing only the check at @c checkIndex.
+ * Constructs a @c GSCXScannerIssueTableViewRow instance for the UI element and check located by
+ * @c issueIndex.
  *
- * @param elementResult The result associated with the UI element the returned row represents.
- * @param checkIndex The index of the check in @c issue to add as a suggestion to the returned row.
- * @param scanIndex The index of the @c GTXHierarchyResultCollection instance containing @c
- *  elementResult.
- * @param result The result containing @c elementResult.
- * @param originalElementIndex The index of @c elementResult in @c result.
- * @return A @c GSCXScannerIssueTableViewRow instance representing the UI element associated with
- *  @c elementResult. Contains suggestions for the accessibility issue at @c checkIndex in
- *  @c elementResult occurring in the scan result at @c scanIndex.
+ * @param issueIndex The location of the issue in @c results.
+ * @param results The results @c issueIndex refers to.
+ * @return A @c GSCXScannerIssueTableViewRow instance representing the UI element located by
+ *  @c issueIndex. Contains a single suggestion for the check located by @c issueIndex.
  */
-+ (GSCXScannerIssueTableViewRow *)gscx_rowFromElementResult:
-                                      (GTXElementResultCollection *)elementResult
-                                           onlyCheckAtIndex:(NSUInteger)checkIndex
-                                                  scanIndex:(NSUInteger)scanIndex
-                                                   inResult:(GTXHierarchyResultCollection *)result
-                                       originalElementIndex:(NSInteger)originalElementIndex {
-  GTXElementResultCollection *copiedElementResult =
-      [GSCXContinuousScannerListTabBarUtils gscx_elementResultFromResult:elementResult
-                                                        onlyCheckAtIndex:checkIndex];
++ (GSCXScannerIssueTableViewRow *)gscx_rowFromIssueIndex:(GSCXIssueIndex)issueIndex
+                                               inResults:
+                                                   (NSArray<GTXHierarchyResultCollection *> *)
+                                                       results {
+  GTXHierarchyResultCollection *result = results[issueIndex.scanIndex];
+  GTXElementResultCollection *elementResult = result.elementResults[issueIndex.elementIndex];
+  GTXCheckResult *checkResult = elementResult.checkResults[issueIndex.checkIndex];
   // TODO: Localize this and load it from an external resource instead of hardcoding
   // it.
-  NSString *subtitle = [NSString stringWithFormat:@"Screen %lu", (unsigned long)(scanIndex + 1)];
+  NSString *subtitle =
+      [NSString stringWithFormat:@"Screen %lu", (unsigned long)(issueIndex.scanIndex + 1)];
   GSCXScannerIssueTableViewRow *row = [[GSCXScannerIssueTableViewRow alloc]
-             initWithTitle:copiedElementResult.elementReference.elementDescription
+             initWithTitle:elementResult.elementReference.elementDescription
                   subtitle:subtitle
             originalResult:result
-      originalElementIndex:originalElementIndex];
-  [row addSuggestionWithTitle:elementResult.checkResults[checkIndex].checkName
-                     contents:elementResult.checkResults[checkIndex].errorDescription];
+      originalElementIndex:(NSInteger)issueIndex.elementIndex];
+  [row addSuggestionWithTitle:checkResult.checkName contents:checkResult.errorDescription];
   return row;
 }
 
 /**
- * Copies a @c GTXElementResultCollection instance, removing all checks except for the check at
- * @c checkIndex.
+ * Constructs a @c GSCXScannerIssueTableViewRow instance for @c issue.
  *
- * @param elementResult The element result to copy.
- * @param checkIndex The index of the only check to include in the copied element result.
- * @return A copy of @c elementResult containing only the check at @c checkIndex.
+ * @param issue The unique issue the returned row represents.
+ * @param results The results @c issue was found in.
+ * @return A @c GSCXScannerIssueTableViewRow instance representing the element @c issue first
+ *  occurred on. Contains a single suggestion for the failing check. The subtitle describes how many
+ *  times and in which scans @c issue occurred.
  */
-+ (GTXElementResultCollection *)gscx_elementResultFromResult:
-                                    (GTXElementResultCollection *)elementResult
-                                            onlyCheckAtIndex:(NSUInteger)checkIndex {
-  return [[GTXElementResultCollection alloc]
-      initWithElement:elementResult.elementReference
-         checkResults:@[ elementResult.checkResults[checkIndex] ]];
++ (GSCXScannerIssueTableViewRow *)gscx_rowFromUniqueIssue:(GSCXUniqueIssue *)issue
+                                                 inResults:
+                                                     (NSArray<GTXHierarchyResultCollection *> *)
+                                                         results {
+  // TODO: Localize this and load it from an external resource instead of hardcoding
+  // it.
+  NSString *subtitle;
+  if (issue.occurrenceCount == 1) {
+    subtitle = [NSString
+        stringWithFormat:@"Seen once on Screen %lu", (unsigned long)(issue.firstSeenScanIndex + 1)];
+  } else {
+    subtitle = [NSString stringWithFormat:@"Seen %lu times on Screens %lu-%lu",
+                                          (unsigned long)issue.occurrenceCount,
+                                          (unsigned long)(issue.firstSeenScanIndex + 1),
+                                          (unsigned long)(issue.lastSeenScanIndex + 1)];
+  }
+  GSCXScannerIssueTableViewRow *row = [[GSCXScannerIssueTableViewRow alloc]
+             initWithTitle:issue.originalElementReference.elementDescription
+                  subtitle:subtitle
+            originalResult:[issue originalResultInResults:results]
+      originalElementIndex:issue.originalElementIndex];
+  [row addSuggestionWithTitle:issue.checkName contents:issue.errorDescription];
+  return row;
 }
 
 /**
- * Converts a dictionary mapping check names to associated table view rows to an array of
- * @c GSCXScannerIssueTableViewSection instance. The array is ordered alphabetically by check name.
+ * Converts a dictionary mapping check names to the locations of associated issues to an array of
+ * lazily populated @c GSCXScannerIssueTableViewSection instances. The array is ordered
+ * alphabetically by check name.
  *
- * @param rowsByCheckName The dictionary to convert to an array of sections. Each key-value pair
+ * @param indicesByCheckName The dictionary to convert to an array of sections. Each key-value pair
  *  represents one section, where the key is the check name associated with that section and the
- *  value is an array of rows in that section.
+ *  value contains the packed @c GSCXIssueIndex values of the rows in that section.
+ * @param results The results the issue indices refer to.
  * @return An array of @c GSCXScannerIssueTableViewSection instances representing the checks in
- *  @c rowsByCheckName, ordered alphabetically by check name.
+ *  @c indicesByCheckName, ordered alphabetically by check name.
  */
-+ (NSArray<GSCXScannerIssueTableViewSection *> *)gscx_sectionsFromRowsByCheckName:
-    (GSCXRowsByCheckNameMutableDictionary *)rowsByCheckName {
++ (NSArray<GSCXScannerIssueTableViewSection *> *)
+    gscx_sectionsFromIndicesByCheckName:(GSCXIssueIndicesByCheckNameMutableDictionary *)
+                                            indicesByCheckName
+                                results:(NSArray<GTXHierarchyResultCollection *> *)results {
   NSArray<NSString *> *sortedCheckNames =
-      [[rowsByCheckName allKeys] sortedArrayUsingSelector:@selector(compare:)];
-  NSMutableArray<GSCXScannerIssueTableViewSection *> *sections = [[NSMutableArray alloc] init];
+      [[indicesByCheckName allKeys] sortedArrayUsingSelector:@selector(compare:)];
+  NSMutableArray<GSCXScannerIssueTableViewSection *> *sections =
+      [[NSMutableArray alloc] initWithCapacity:sortedCheckNames.count];
   for (NSString *checkName in sortedCheckNames) {
+    NSData *indices = [indicesByCheckName[checkName] copy];
+    NSUInteger rowCount = indices.length / sizeof(GSCXIssueIndex);
     [sections addObject:[[GSCXScannerIssueTableViewSection alloc]
-                            initWithTitle:checkName
-                                 subtitle:nil
-                                     rows:rowsByCheckName[checkName]]];
+                                  initWithTitle:checkName
+                                       subtitle:nil
+                                   numberOfRows:rowCount
+                            numberOfSuggestions:rowCount
+                                    rowProvider:^GSCXScannerIssueTableViewRow *(
+                                        NSUInteger rowIndex) {
+                                      const GSCXIssueIndex *issueIndices = indices.bytes;
+                                      return [GSCXContinuousScannerListTabBarUtils
+                                          gscx_rowFromIssueIndex:issueIndices[rowIndex]
+                                                       inResults:results];
+                                    }]];
   }
   return sections;
 }
@@ -57,16 +57,36 @@ FOUNDATION_EXTERN NSString *const kGSCXContinuousScannerScreenshotListByScanTabB
  */
 FOUNDATION_EXTERN NSString *const kGSCXContinuousScannerScreenshotListByCheckTabBarItemTitle;
 
+/**
+ * The title of the tab bar item displaying each unique issue once in the list view.
+ */
+FOUNDATION_EXTERN NSString *const kGSCXContinuousScannerScreenshotListUniqueTabBarItemTitle;
+
 /**
  * Displays a screenshot of a scan result. Views with accessibility issues are highlighted. Displays
  * a carousel so users can quickly access other scans.
  */
 @interface GSCXContinuousScannerScreenshotViewController : UIViewController
 
+/**
+ * The time, as returned by @c CACurrentMediaTime, at which the user requested these results. If
+ * non-zero, the time until the first frame is on screen and the time until all results are loaded
+ * are reported through @c GSCXAnalytics. Defaults to 0.
+ */
+@property(assign, nonatomic) CFTimeInterval presentationRequestTime;
+
+/**
+ * @c YES if the shared report only contains the first occurrence of each unique issue, @c NO if it
+ * contains every issue in every scan. Defaults to @c NO.
+ */
+@property(assign, nonatomic) BOOL sharesDeduplicatedIssues;
+
 - (instancetype)initWithNibName:(nullable NSString *)nibNameOrNil
                          bundle:(nullable NSBundle *)nibBundleOrNil NS_UNAVAILABLE;
 /**
- * Initializes this object by loading the default xib with the given scan results.
+ * Initializes this object by loading the default xib with the given scan results. Only the first
+ * result is loaded before the view appears. The remaining results are added to the carousel in
+ * batches in later run loop iterations so the first frame is not delayed by long sessions.
  *
  * @param scannerResults The results of scans. Cannot be empty.
  * @param sharingDelegate Delegate for configuring the sharing process.
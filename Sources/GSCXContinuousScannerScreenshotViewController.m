@@ -16,6 +16,9 @@
 
 #import "GSCXContinuousScannerScreenshotViewController.h"
 
+#import <QuartzCore/QuartzCore.h>
+
+#import "GSCXAnalytics.h"
 #import "GSCXContinuousScannerGalleryViewController.h"
 #import "GSCXContinuousScannerGridViewController.h"
 #import "GSCXContinuousScannerListTabBarItem.h"
@@ -24,11 +27,13 @@
 #import "GSCXContinuousScannerListViewController.h"
 #import "GSCXContinuousScannerResultViewController.h"
 #import "GSCXImageNames.h"
+#import "GSCXIssueDeduplicator.h"
 #import "GSCXRingViewArranger.h"
 #import "GSCXScannerResultCarousel.h"
 #import "GSCXScannerScreenshotViewController.h"
 #import "GSCXUtils.h"
 #import "NSLayoutConstraint+GSCXUtilities.h"
+#import "GTXHierarchyResultCollection+GSCXScreenshot.h"
 #import "UIViewController+GSCXAppearance.h"
 #import <GTXiLib/GTXiLib.h>
 NS_ASSUME_NONNULL_BEGIN
@@ -52,6 +57,8 @@ NSString *const kGSCXContinuousScannerScreenshotListByScanTabBarItemTitle = @"By
 
 NSString *const kGSCXContinuousScannerScreenshotListByCheckTabBarItemTitle = @"By Check";
 
+NSString *const kGSCXContinuousScannerScreenshotListUniqueTabBarItemTitle = @"Unique";
+
 /**
  * The padding between the edges of the screen and elements in
  * @c GSCXContinuousScannerScreenshotViewController.
@@ -72,6 +79,13 @@ static const CGFloat kGSCXContinuousScannerScreenshotCarouselHeight = 100.0;
  */
 static const CGFloat kGSCXContinuousScannerScreenshotMinimumLabelHeight = 20.5;
 
+/**
+ * The number of results added to the carousel per run loop iteration after the first frame is
+ * displayed. Small enough that each batch fits comfortably in a frame, large enough that long
+ * sessions finish loading quickly.
+ */
+static const NSUInteger kGSCXContinuousScannerScreenshotCarouselBatchSize = 16;
+
 @interface GSCXContinuousScannerScreenshotViewController () <UIScrollViewDelegate>
 
 /**
@@ -152,6 +166,28 @@ static const CGFloat kGSCXContinuousScannerScreenshotMinimumLabelHeight = 20.5;
  */
 @property(weak, nonatomic) IBOutlet UILabel *issueCountLabel;
 
+/**
+ * @c YES if ring views should not be added to the screenshot yet, @c NO otherwise. Ring views are
+ * deferred until after the first frame is on screen. Defaults to @c YES.
+ */
+@property(assign, nonatomic, getter=areRingViewsDeferred) BOOL ringViewsDeferred;
+
+/**
+ * @c YES if the first frame has been displayed and incremental loading has begun, @c NO otherwise.
+ */
+@property(assign, nonatomic, getter=hasBegunIncrementalLoading) BOOL begunIncrementalLoading;
+
+/**
+ * Fires once, at the first display refresh after this view appears. @c nil once it has fired.
+ */
+@property(strong, nonatomic, nullable) CADisplayLink *firstFrameDisplayLink;
+
+/**
+ * @c YES if the list view's sections are being built in the background, @c NO otherwise. Prevents
+ * the list view from being pushed multiple times if the user taps the list button repeatedly.
+ */
+@property(assign, nonatomic, getter=isBuildingListSections) BOOL buildingListSections;
+
 @end
 
 @implementation GSCXContinuousScannerScreenshotViewController
@@ -167,11 +203,13 @@ static const CGFloat kGSCXContinuousScannerScreenshotMinimumLabelHeight = 20.5;
     _scannerResults = scannerResults;
     _sharingDelegate = sharingDelegate;
     __weak __typeof__(self) weakSelf = self;
+    _ringViewsDeferred = YES;
     _carousel = [[GSCXScannerResultCarousel alloc]
-        initWithResults:scannerResults
-         selectionBlock:^(NSUInteger index, GTXHierarchyResultCollection *result) {
-           [weakSelf gscx_displayScannerResultAtIndex:index];
-         }];
+              initWithResults:scannerResults
+        displayedResultCount:1
+               selectionBlock:^(NSUInteger index, GTXHierarchyResultCollection *result) {
+                 [weakSelf gscx_displayScannerResultAtIndex:index];
+               }];
     _carousel.carouselAccessibilityElement.accessibilityIdentifier =
         kGSCXScannerResultCarouselAccessibilityIdentifier;
   }
@@ -217,6 +255,22 @@ static const CGFloat kGSCXContinuousScannerScreenshotMinimumLabelHeight = 20.5;
   ];
 }
 
+- (void)viewWillAppear:(BOOL)animated {
+  [super viewWillAppear:animated];
+  if (self.hasBegunIncrementalLoading) {
+    return;
+  }
+  self.begunIncrementalLoading = YES;
+  // Blocks dispatched to the main queue can run before the current run loop iteration commits its
+  // Core Animation transaction. A display link first fires at the display refresh after that
+  // commit, when the first frame of this view is handed to the display. The display link retains
+  // this view controller until it is invalidated when it fires.
+  self.firstFrameDisplayLink =
+      [CADisplayLink displayLinkWithTarget:self
+                                  selector:@selector(gscx_firstFrameDisplayLinkDidFire:)];
+  [self.firstFrameDisplayLink addToRunLoop:[NSRunLoop mainRunLoop] forMode:NSRunLoopCommonModes];
+}
+
 - (void)viewDidLayoutSubviews {
   [super viewDidLayoutSubviews];
   // Update ring views when the user rotates the device. Subviews' bounds are not necessarily
@@ -231,6 +285,7 @@ static const CGFloat kGSCXContinuousScannerScreenshotMinimumLabelHeight = 20.5;
 }
 
 - (void)focusResultAtIndex:(NSUInteger)index animated:(BOOL)animated {
+  [self gscx_loadCarouselThroughIndex:index];
   [self gscx_displayScannerResultAtIndex:index];
   [self.carousel focusResultAtIndex:index animated:animated];
 }
@@ -467,11 +522,13 @@ static const CGFloat kGSCXContinuousScannerScreenshotMinimumLabelHeight = 20.5;
 
 /**
  * Removes the currently displayed rings and adds ring views to @c currentScreenshot for the
- * currently displayed result.
+ * currently displayed result. Does nothing if ring views are deferred.
  */
 - (void)gscx_addRingViewsToScreenshot {
-  CGSize screenshotSize = self.scannerResults[self.currentIndex].screenshot.size;
-  CGRect originalCoordinates = CGRectMake(0, 0, screenshotSize.width, screenshotSize.height);
+  if (self.areRingViewsDeferred) {
+    return;
+  }
+  CGRect originalCoordinates = self.scannerResults[self.currentIndex].gscx_screenshotFrame;
   [self.ringViews removeRingViewsFromSuperview];
   [self.ringViews addRingViewsToSuperview:self.currentScreenshot
                           fromCoordinates:originalCoordinates];
@@ -510,6 +567,7 @@ static const CGFloat kGSCXContinuousScannerScreenshotMinimumLabelHeight = 20.5;
   } else {
     self.currentIndex--;
   }
+  [self gscx_loadCarouselThroughIndex:self.currentIndex];
   [self.carousel focusResultAtIndex:self.currentIndex animated:YES];
   [self gscx_displayScannerResultAtIndex:self.currentIndex];
 }
@@ -526,10 +584,82 @@ static const CGFloat kGSCXContinuousScannerScreenshotMinimumLabelHeight = 20.5;
   } else {
     self.currentIndex++;
   }
+  [self gscx_loadCarouselThroughIndex:self.currentIndex];
   [self.carousel focusResultAtIndex:self.currentIndex animated:YES];
   [self gscx_displayScannerResultAtIndex:self.currentIndex];
 }
 
+/**
+ * Stops @c firstFrameDisplayLink and handles the first frame being displayed.
+ *
+ * @param displayLink The display link that fired.
+ */
+- (void)gscx_firstFrameDisplayLinkDidFire:(CADisplayLink *)displayLink {
+  [displayLink invalidate];
+  self.firstFrameDisplayLink = nil;
+  [self gscx_didDisplayFirstFrame];
+}
+
+/**
+ * Invoked after the first frame of this view controller is on screen. Reports the time to first
+ * frame, adds ring views, and begins loading the remaining results.
+ */
+- (void)gscx_didDisplayFirstFrame {
+  if (self.presentationRequestTime > 0) {
+    [GSCXAnalytics
+        invokeTimingEvent:GSCXAnalyticsTimingEventContinuousScanResultsFirstFrame
+                 duration:CACurrentMediaTime() - self.presentationRequestTime];
+  }
+  self.ringViewsDeferred = NO;
+  [self.view setNeedsLayout];
+  [self gscx_scheduleNextCarouselBatch];
+}
+
+/**
+ * Adds the next batch of results to the carousel, then schedules the following batch in the next
+ * run loop iteration. Reports the time until fully loaded once all results are in the carousel.
+ */
+- (void)gscx_scheduleNextCarouselBatch {
+  __weak __typeof__(self) weakSelf = self;
+  dispatch_async(dispatch_get_main_queue(), ^{
+    __typeof__(self) strongSelf = weakSelf;
+    if (strongSelf == nil) {
+      return;
+    }
+    NSUInteger loadedCount = [strongSelf.carousel resultCount];
+    if (loadedCount < strongSelf.scannerResults.count) {
+      [strongSelf.carousel
+          displayResultsUpToCount:loadedCount + kGSCXContinuousScannerScreenshotCarouselBatchSize];
+      [strongSelf gscx_scheduleNextCarouselBatch];
+      return;
+    }
+    [strongSelf gscx_didFinishLoadingCarousel];
+  });
+}
+
+/**
+ * Synchronously adds all results up to and including @c index to the carousel if they have not
+ * been added yet. Used when the user navigates to a result before incremental loading finishes.
+ *
+ * @param index The index of the result that must be in the carousel.
+ */
+- (void)gscx_loadCarouselThroughIndex:(NSUInteger)index {
+  [self.carousel displayResultsUpToCount:index + 1];
+}
+
+/**
+ * Invoked when all results have been added to the carousel. Reports the time until fully loaded.
+ * Only reports the first time it is invoked.
+ */
+- (void)gscx_didFinishLoadingCarousel {
+  if (self.presentationRequestTime > 0) {
+    [GSCXAnalytics
+        invokeTimingEvent:GSCXAnalyticsTimingEventContinuousScanResultsFullyLoaded
+                 duration:CACurrentMediaTime() - self.presentationRequestTime];
+    self.presentationRequestTime = 0;
+  }
+}
+
 /**
  * Presents the grid view, allowing easier access to individual scans.
  */
@@ -572,17 +702,50 @@ static const CGFloat kGSCXContinuousScannerScreenshotMinimumLabelHeight = 20.5;
  * concise view of the scan results.
  */
 - (void)gscx_presentListView {
-  NSArray<GSCXScannerIssueTableViewSection *> *byScanSections =
-      [GSCXContinuousScannerListTabBarUtils sectionsWithGroupedByScanResults:self.scannerResults];
-  NSArray<GSCXScannerIssueTableViewSection *> *byCheckSections =
-      [GSCXContinuousScannerListTabBarUtils sectionsWithGroupedByCheckResults:self.scannerResults];
+  if (self.isBuildingListSections) {
+    return;
+  }
+  self.buildingListSections = YES;
+  __weak __typeof__(self) weakSelf = self;
+  [GSCXContinuousScannerListTabBarUtils
+      buildSectionsWithResults:self.scannerResults
+                    completion:^(NSArray<GSCXScannerIssueTableViewSection *> *byScanSections,
+                                 NSArray<GSCXScannerIssueTableViewSection *> *byCheckSections,
+                                 NSArray<GSCXScannerIssueTableViewSection *> *uniqueSections) {
+                      __typeof__(self) strongSelf = weakSelf;
+                      if (strongSelf == nil) {
+                        return;
+                      }
+                      strongSelf.buildingListSections = NO;
+                      [strongSelf gscx_pushListViewWithByScanSections:byScanSections
+                                                      byCheckSections:byCheckSections
+                                                       uniqueSections:uniqueSections];
+                    }];
+}
+
+/**
+ * Pushes the list view onto the navigation stack, displaying the given sections.
+ *
+ * @param byScanSections The sections displayed in the tab grouping issues by scan.
+ * @param byCheckSections The sections displayed in the tab grouping issues by check.
+ * @param uniqueSections The sections displayed in the tab listing each unique issue once.
+ */
+- (void)gscx_pushListViewWithByScanSections:
+            (NSArray<GSCXScannerIssueTableViewSection *> *)byScanSections
+                            byCheckSections:
+                                (NSArray<GSCXScannerIssueTableViewSection *> *)byCheckSections
+                             uniqueSections:
+                                 (NSArray<GSCXScannerIssueTableViewSection *> *)uniqueSections {
   NSArray<GSCXContinuousScannerListTabBarItem *> *items = @[
     [[GSCXContinuousScannerListTabBarItem alloc]
         initWithSections:byScanSections
                    title:kGSCXContinuousScannerScreenshotListByScanTabBarItemTitle],
     [[GSCXContinuousScannerListTabBarItem alloc]
         initWithSections:byCheckSections
-                   title:kGSCXContinuousScannerScreenshotListByCheckTabBarItemTitle]
+                   title:kGSCXContinuousScannerScreenshotListByCheckTabBarItemTitle],
+    [[GSCXContinuousScannerListTabBarItem alloc]
+        initWithSections:uniqueSections
+                   title:kGSCXContinuousScannerScreenshotListUniqueTabBarItemTitle]
   ];
   GSCXContinuousScannerListTabBarViewController *tabBarController =
       [[GSCXContinuousScannerListTabBarViewController alloc] initWithItems:items];
@@ -593,8 +756,29 @@ static const CGFloat kGSCXContinuousScannerScreenshotMinimumLabelHeight = 20.5;
  * Shares all issues found across all scans.
  */
 - (void)gscx_beginSharingIssues {
-  GSCXReport *report = [[GSCXReport alloc] initWithResults:self.scannerResults];
-  [self.sharingDelegate shareReport:report inViewController:self completion:nil];
+  NSArray<GTXHierarchyResultCollection *> *results = self.scannerResults;
+  if (!self.sharesDeduplicatedIssues) {
+    GSCXReport *report = [[GSCXReport alloc] initWithResults:results];
+    [self.sharingDelegate shareReport:report inViewController:self completion:nil];
+    return;
+  }
+  // Continuous scans of the same screen report the same issues repeatedly. Only share the first
+  // occurrence of each issue so the report is not inflated by the number of scans. Deduplicating
+  // reads every result, so it is done on a background queue.
+  __weak __typeof__(self) weakSelf = self;
+  dispatch_async(dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^{
+    GSCXIssueDeduplicator *deduplicator = [GSCXIssueDeduplicator deduplicatorWithResults:results];
+    NSArray<GTXHierarchyResultCollection *> *deduplicatedResults =
+        [deduplicator deduplicatedResultsOfResults:results];
+    dispatch_async(dispatch_get_main_queue(), ^{
+      __typeof__(self) strongSelf = weakSelf;
+      if (strongSelf == nil) {
+        return;
+      }
+      GSCXReport *report = [[GSCXReport alloc] initWithResults:deduplicatedResults];
+      [strongSelf.sharingDelegate shareReport:report inViewController:strongSelf completion:nil];
+    });
+  });
 }
 
 /**
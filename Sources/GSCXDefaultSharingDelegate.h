@@ -19,10 +19,17 @@
 NS_ASSUME_NONNULL_BEGIN
 
 /**
- * Generates a PDF from a @c GSCXReport instance and shares it using a @c UIActivityViewController.
+ * Generates a PDF or machine readable export from a @c GSCXReport instance and shares it using a
+ * @c UIActivityViewController.
  */
 @interface GSCXDefaultSharingDelegate : NSObject <GSCXSharingDelegate>
 
+/**
+ * The format reports are shared in. Defaults to @c GSCXSharedReportFormatPDF. Machine readable
+ * exports are shared along with the screenshots they reference.
+ */
+@property(assign, nonatomic) GSCXSharedReportFormat reportFormat;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -47,11 +47,30 @@ NS_ASSUME_NONNULL_BEGIN
   self.sharing = YES;
   self.completionBlock = completionBlock;
   __weak __typeof__(self) weakSelf = self;
-  [GSCXReport createPDFReport:report
-              completionBlock:^(NSURL *reportUrl) {
-                [weakSelf gscx_shareReportAtURL:reportUrl inViewController:viewController];
-              }
-                   errorBlock:nil];
+  switch (self.reportFormat) {
+    case GSCXSharedReportFormatPDF:
+      [GSCXReport createPDFReport:report
+                  completionBlock:^(NSURL *reportUrl) {
+                    [weakSelf gscx_shareReportAtURL:reportUrl inViewController:viewController];
+                  }
+                       errorBlock:nil];
+      break;
+    case GSCXSharedReportFormatJSONLines:
+    case GSCXSharedReportFormatSARIF:
+      [GSCXReport exportReport:report
+                        format:(self.reportFormat == GSCXSharedReportFormatSARIF
+                                    ? GSCXReportExportFormatSARIF
+                                    : GSCXReportExportFormatJSONLines)
+               completionBlock:^(NSURL *reportURL) {
+                 // Screenshots are written next to the report, so the whole directory is shared.
+                 [weakSelf gscx_shareReportAtURL:[reportURL URLByDeletingLastPathComponent]
+                                inViewController:viewController];
+               }
+                    errorBlock:^(NSError *error) {
+                      [weakSelf gscx_onSharingComplete];
+                    }];
+      break;
+  }
   return YES;
 }
 
@@ -0,0 +1,77 @@
+//
+// Copyright 2018 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Chooses which elements of a large hierarchy to check on each scan, so the hierarchy is covered
+ * over several scans instead of in a single expensive one. Samples are stratified by element
+ * class, so each scan checks a proportional share of every kind of element. A coverage bitmap
+ * keyed by element identity records which elements have been checked in the current round. Each
+ * scan checks up to 1 / @c tickCount of each class among the elements not yet covered, so every
+ * element present throughout a round is covered within @c tickCount scans. A new round begins once
+ * every element has been covered. Views are compared by pointer and held weakly. Other elements,
+ * such as @c UIAccessibilityElement instances, are often recreated by their containers on every
+ * scan, so they are identified by their container and index in it, or by their class and
+ * accessibility frame if their container does not contain them. Must only be used on the main
+ * thread.
+ */
+@interface GSCXElementSampler : NSObject
+
+/**
+ * The number of scans within which every element is covered.
+ */
+@property(assign, nonatomic, readonly) NSUInteger tickCount;
+
+/**
+ * The number of rounds in which every element was covered.
+ */
+@property(assign, nonatomic, readonly) NSUInteger completedRoundCount;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Initializes a @c GSCXElementSampler instance.
+ *
+ * @param tickCount The number of scans within which every element is covered. Must be positive.
+ * @return An initialized @c GSCXElementSampler instance.
+ */
+- (instancetype)initWithTickCount:(NSUInteger)tickCount NS_DESIGNATED_INITIALIZER;
+
+/**
+ * Chooses the elements to check in the next scan and marks them as covered.
+ *
+ * @param elements Every element in the hierarchy being scanned.
+ * @return The elements to check, in the same order as in @c elements.
+ */
+- (NSArray *)sampleElements:(NSArray *)elements;
+
+/**
+ * @param element An element.
+ * @return @c YES if @c element has been checked in the current round, @c NO otherwise.
+ */
+- (BOOL)isElementCovered:(id)element;
+
+/**
+ * Forgets which elements have been covered and resets @c completedRoundCount.
+ */
+- (void)reset;
+
+@end
+
+NS_ASSUME_NONNULL_END
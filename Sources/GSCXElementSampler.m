@@ -0,0 +1,216 @@
+//
+// Copyright 2018 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXElementSampler.h"
+
+#import <UIKit/UIKit.h>
+#import <objc/runtime.h>
+
+#import <GTXiLib/GTXiLib.h>
+NS_ASSUME_NONNULL_BEGIN
+
+@interface GSCXElementSampler ()
+
+/**
+ * The index of each view's bit in @c coverage, assigned when the view is first covered in the
+ * current round.
+ */
+@property(strong, nonatomic) NSMapTable<id, NSNumber *> *bitIndexes;
+
+/**
+ * The index of each other element's bit in @c coverage, keyed by the element's stable key,
+ * assigned when the element is first covered in the current round.
+ */
+@property(strong, nonatomic) NSMutableDictionary<NSString *, NSNumber *> *stableKeyBitIndexes;
+
+/**
+ * One bit per element in @c bitIndexes, set if the element has been covered in the current round.
+ */
+@property(strong, nonatomic) NSMutableData *coverage;
+
+/**
+ * The bit index assigned to the next element covered in the current round. Not derived from
+ * @c bitIndexes, whose count decreases as views are deallocated.
+ */
+@property(assign, nonatomic) NSUInteger nextBitIndex;
+
+@end
+
+@implementation GSCXElementSampler
+
+- (instancetype)initWithTickCount:(NSUInteger)tickCount {
+  GTX_ASSERT(tickCount > 0, @"tickCount must be positive.");
+  self = [super init];
+  if (self) {
+    _tickCount = tickCount;
+    _bitIndexes = [[NSMapTable alloc]
+        initWithKeyOptions:NSPointerFunctionsWeakMemory | NSPointerFunctionsObjectPointerPersonality
+              valueOptions:NSPointerFunctionsStrongMemory
+                  capacity:0];
+    _stableKeyBitIndexes = [[NSMutableDictionary alloc] init];
+    _coverage = [[NSMutableData alloc] init];
+  }
+  return self;
+}
+
+- (NSArray *)sampleElements:(NSArray *)elements {
+  BOOL isRoundComplete = elements.count > 0;
+  for (id element in elements) {
+    if (![self isElementCovered:element]) {
+      isRoundComplete = NO;
+      break;
+    }
+  }
+  if (isRoundComplete) {
+    [self gscx_beginRound];
+    _completedRoundCount++;
+  }
+  NSMapTable<Class, NSMutableArray *> *strata = [NSMapTable strongToStrongObjectsMapTable];
+  for (id element in elements) {
+    Class elementClass = object_getClass(element);
+    NSMutableArray *stratum = [strata objectForKey:elementClass];
+    if (stratum == nil) {
+      stratum = [[NSMutableArray alloc] init];
+      [strata setObject:stratum forKey:elementClass];
+    }
+    [stratum addObject:element];
+  }
+  NSHashTable *sampledElements = [NSHashTable
+      hashTableWithOptions:NSPointerFunctionsStrongMemory |
+                           NSPointerFunctionsObjectPointerPersonality];
+  for (Class elementClass in strata) {
+    NSArray *stratum = [strata objectForKey:elementClass];
+    NSUInteger quota = (stratum.count + self.tickCount - 1) / self.tickCount;
+    NSUInteger sampledCount = 0;
+    for (id element in stratum) {
+      if (sampledCount == quota) {
+        break;
+      }
+      if (![self isElementCovered:element]) {
+        [sampledElements addObject:element];
+        sampledCount++;
+      }
+    }
+  }
+  NSMutableArray *sample = [[NSMutableArray alloc] initWithCapacity:sampledElements.count];
+  for (id element in elements) {
+    if ([sampledElements containsObject:element]) {
+      [sample addObject:element];
+      [self gscx_setElementCovered:element];
+    }
+  }
+  return sample;
+}
+
+- (BOOL)isElementCovered:(id)element {
+  NSNumber *bitIndex = [self gscx_bitIndexOfElement:element];
+  if (bitIndex == nil) {
+    return NO;
+  }
+  NSUInteger index = [bitIndex unsignedIntegerValue];
+  const uint8_t *bits = (const uint8_t *)self.coverage.bytes;
+  return (bits[index / 8] & (1 << (index % 8))) != 0;
+}
+
+- (void)reset {
+  [self gscx_beginRound];
+  _completedRoundCount = 0;
+}
+
+#pragma mark - Private
+
+/**
+ * Marks every element as not covered. Bit indexes are reassigned, so the bitmap only grows with
+ * the number of elements seen in a single round.
+ */
+- (void)gscx_beginRound {
+  [self.bitIndexes removeAllObjects];
+  [self.stableKeyBitIndexes removeAllObjects];
+  self.coverage.length = 0;
+  self.nextBitIndex = 0;
+}
+
+/**
+ * Marks @c element as covered in the current round.
+ *
+ * @param element The element to mark.
+ */
+- (void)gscx_setElementCovered:(id)element {
+  NSNumber *bitIndex = [self gscx_bitIndexOfElement:element];
+  if (bitIndex == nil) {
+    bitIndex = @(self.nextBitIndex);
+    self.nextBitIndex++;
+    NSString *stableKey = [GSCXElementSampler gscx_stableKeyOfElement:element];
+    if (stableKey == nil) {
+      [self.bitIndexes setObject:bitIndex forKey:element];
+    } else {
+      self.stableKeyBitIndexes[stableKey] = bitIndex;
+    }
+  }
+  NSUInteger index = [bitIndex unsignedIntegerValue];
+  if (self.coverage.length <= index / 8) {
+    self.coverage.length = index / 8 + 1;
+  }
+  uint8_t *bits = (uint8_t *)self.coverage.mutableBytes;
+  bits[index / 8] |= (1 << (index % 8));
+}
+
+/**
+ * Looks up the bit index assigned to @c element in the current round.
+ *
+ * @param element The element to look up.
+ * @return The bit index of @c element, or @c nil if it has not been covered in the current round.
+ */
+- (nullable NSNumber *)gscx_bitIndexOfElement:(id)element {
+  NSString *stableKey = [GSCXElementSampler gscx_stableKeyOfElement:element];
+  if (stableKey == nil) {
+    return [self.bitIndexes objectForKey:element];
+  }
+  return self.stableKeyBitIndexes[stableKey];
+}
+
+/**
+ * Computes a key identifying @c element across instances recreated by its container. Uses the
+ * container and the element's index in it if the container contains @c element, and the element's
+ * class and accessibility frame otherwise.
+ *
+ * @param element The element to identify.
+ * @return The key of @c element, or @c nil if @c element is a view, which is identified by pointer.
+ */
++ (nullable NSString *)gscx_stableKeyOfElement:(id)element {
+  if ([element isKindOfClass:[UIView class]]) {
+    return nil;
+  }
+  NSString *className = NSStringFromClass(object_getClass(element));
+  id container = nil;
+  if ([element respondsToSelector:@selector(accessibilityContainer)]) {
+    container = [element accessibilityContainer];
+  }
+  if (container != nil) {
+    NSInteger index = [container indexOfAccessibilityElement:element];
+    if (index != NSNotFound) {
+      return [NSString stringWithFormat:@"%@:%p:%ld", className, container, (long)index];
+    }
+  }
+  CGRect frame = [element respondsToSelector:@selector(accessibilityFrame)]
+                     ? [element accessibilityFrame]
+                     : CGRectNull;
+  return [NSString stringWithFormat:@"%@:%@", className, NSStringFromCGRect(frame)];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
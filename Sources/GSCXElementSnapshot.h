@@ -0,0 +1,80 @@
+//
+// Copyright 2018 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import <UIKit/UIKit.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * An immutable copy of the accessibility attributes of an element, captured on the main thread so
+ * checks can read them from any thread.
+ */
+@interface GSCXElementSnapshot : NSObject
+
+/**
+ * The class of the element.
+ */
+@property(strong, nonatomic, readonly) Class elementClass;
+
+/**
+ * The element's @c isAccessibilityElement.
+ */
+@property(assign, nonatomic, readonly) BOOL isAccessibilityElement;
+
+/**
+ * The element's @c accessibilityLabel.
+ */
+@property(copy, nonatomic, readonly, nullable) NSString *accessibilityLabel;
+
+/**
+ * The element's @c accessibilityValue.
+ */
+@property(copy, nonatomic, readonly, nullable) NSString *accessibilityValue;
+
+/**
+ * The element's @c accessibilityHint.
+ */
+@property(copy, nonatomic, readonly, nullable) NSString *accessibilityHint;
+
+/**
+ * The element's @c accessibilityIdentifier, or @c nil if it does not have one.
+ */
+@property(copy, nonatomic, readonly, nullable) NSString *accessibilityIdentifier;
+
+/**
+ * The element's @c accessibilityTraits.
+ */
+@property(assign, nonatomic, readonly) UIAccessibilityTraits accessibilityTraits;
+
+/**
+ * The element's @c accessibilityFrame, in screen coordinates.
+ */
+@property(assign, nonatomic, readonly) CGRect accessibilityFrame;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Captures the accessibility attributes of @c element, through the current @c GSCXAttributeCache
+ * if a scan is in progress. Must be called on the main thread.
+ *
+ * @param element The element to capture.
+ * @return A snapshot of @c element.
+ */
++ (instancetype)snapshotOfElement:(id)element;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,53 @@
+//
+// Copyright 2018 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXElementSnapshot.h"
+
+#import <objc/runtime.h>
+
+#import "GSCXAttributeCache.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@implementation GSCXElementSnapshot
+
+- (instancetype)initWithElement:(id)element {
+  self = [super init];
+  if (self) {
+    GSCXAttributeCache *cache = [GSCXAttributeCache currentCache];
+    if (cache == nil) {
+      // Outside of a scan, attributes are read through a temporary cache.
+      cache = [[GSCXAttributeCache alloc] init];
+    }
+    _elementClass = object_getClass(element);
+    _isAccessibilityElement = [cache isAccessibilityElement:element];
+    _accessibilityLabel = [cache accessibilityLabelOfElement:element];
+    _accessibilityValue = [cache accessibilityValueOfElement:element];
+    _accessibilityHint = [cache accessibilityHintOfElement:element];
+    _accessibilityIdentifier = [cache accessibilityIdentifierOfElement:element];
+    _accessibilityTraits = [cache accessibilityTraitsOfElement:element];
+    _accessibilityFrame = [cache accessibilityFrameOfElement:element];
+  }
+  return self;
+}
+
++ (instancetype)snapshotOfElement:(id)element {
+  return [[GSCXElementSnapshot alloc] initWithElement:element];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
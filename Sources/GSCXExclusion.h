@@ -0,0 +1,157 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import <UIKit/UIKit.h>
+
+#import <GTXiLib/GTXiLib.h>
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * The ways a @c GSCXExclusion instance can match views.
+ */
+typedef NS_ENUM(NSInteger, GSCXExclusionKind) {
+  /**
+   * Matches a single view.
+   */
+  GSCXExclusionKindSubtree,
+
+  /**
+   * Matches views that are instances of a class or its subclasses.
+   */
+  GSCXExclusionKindClass,
+
+  /**
+   * Matches views with an accessibility identifier.
+   */
+  GSCXExclusionKindAccessibilityIdentifier,
+
+  /**
+   * Matches a single window.
+   */
+  GSCXExclusionKindWindow,
+};
+
+/**
+ * Declares part of the view hierarchy the scanner should skip. A matching view and all its
+ * descendants are excluded from every check. Unlike @c GTXExcludeListing blocks, exclusions are
+ * declarative, so the scanner can compile all of them into hash lookups once per scan instead of
+ * evaluating each one for every element and check.
+ */
+@interface GSCXExclusion : NSObject
+
+/**
+ * How this exclusion matches views.
+ */
+@property(assign, nonatomic, readonly) GSCXExclusionKind kind;
+
+/**
+ * The view or window excluded by subtree and window exclusions. Held weakly, so an exclusion does
+ * not keep its view alive. @c nil for other kinds, or if the view was deallocated.
+ */
+@property(weak, nonatomic, readonly, nullable) UIView *view;
+
+/**
+ * The class excluded by class exclusions. @c nil for other kinds.
+ */
+@property(strong, nonatomic, readonly, nullable) Class excludedClass;
+
+/**
+ * The accessibility identifier excluded by accessibility identifier exclusions. @c nil for other
+ * kinds.
+ */
+@property(copy, nonatomic, readonly, nullable) NSString *accessibilityIdentifier;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * @param view The root of the subtree to exclude.
+ * @return An exclusion matching @c view.
+ */
++ (instancetype)exclusionWithSubtreeRootedAtView:(UIView *)view;
+
+/**
+ * @param excludedClass The class to exclude.
+ * @return An exclusion matching instances of @c excludedClass and its subclasses.
+ */
++ (instancetype)exclusionWithClass:(Class)excludedClass;
+
+/**
+ * @param accessibilityIdentifier The accessibility identifier to exclude.
+ * @return An exclusion matching views whose accessibility identifier is @c accessibilityIdentifier.
+ */
++ (instancetype)exclusionWithAccessibilityIdentifier:(NSString *)accessibilityIdentifier;
+
+/**
+ * @param window The window to exclude.
+ * @return An exclusion matching @c window.
+ */
++ (instancetype)exclusionWithWindow:(UIWindow *)window;
+
+@end
+
+/**
+ * Compiles a set of @c GSCXExclusion instances into hash sets, and answers whether an element is
+ * excluded in amortized constant time. Before a scan, @c prepareWithRootViews: walks the hierarchy
+ * once in pre-order, without descending into excluded subtrees, and records the result for every
+ * visited view. Elements are then resolved to their nearest view and looked up, so no check
+ * repeats the superview walk. Must only be used on the main thread.
+ */
+@interface GSCXExclusionIndex : NSObject <GTXExcludeListing>
+
+/**
+ * The exclusions in this index.
+ */
+@property(copy, nonatomic, readonly) NSArray<GSCXExclusion *> *exclusions;
+
+/**
+ * Adds @c exclusion to the index. Does nothing if it was already added.
+ *
+ * @param exclusion The exclusion to add.
+ */
+- (void)addExclusion:(GSCXExclusion *)exclusion;
+
+/**
+ * Removes @c exclusion from the index. Does nothing if it was not added.
+ *
+ * @param exclusion The exclusion to remove.
+ */
+- (void)removeExclusion:(GSCXExclusion *)exclusion;
+
+/**
+ * Compiles the exclusions and records which views under @c rootViews are excluded. Must be called
+ * before each scan, because the hierarchy may have changed since the last one.
+ *
+ * @param rootViews The root views of the upcoming scan.
+ */
+- (void)prepareWithRootViews:(NSArray<UIView *> *)rootViews;
+
+/**
+ * Determines if @c element is excluded from every check. Always returns @c NO unless the index was
+ * prepared with @c prepareWithRootViews:.
+ *
+ * @param element The element to look up.
+ * @return @c YES if @c element is excluded, @c NO otherwise.
+ */
+- (BOOL)isElementExcluded:(id)element;
+
+/**
+ * Releases the state recorded by @c prepareWithRootViews:. Must be called after each scan.
+ */
+- (void)reset;
+
+@end
+
+NS_ASSUME_NONNULL_END
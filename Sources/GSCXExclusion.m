@@ -0,0 +1,303 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXExclusion.h"
+
+#import <objc/runtime.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@implementation GSCXExclusion
+
+- (instancetype)initWithKind:(GSCXExclusionKind)kind
+                        view:(nullable UIView *)view
+               excludedClass:(nullable Class)excludedClass
+     accessibilityIdentifier:(nullable NSString *)accessibilityIdentifier {
+  self = [super init];
+  if (self) {
+    _kind = kind;
+    _view = view;
+    _excludedClass = excludedClass;
+    _accessibilityIdentifier = [accessibilityIdentifier copy];
+  }
+  return self;
+}
+
++ (instancetype)exclusionWithSubtreeRootedAtView:(UIView *)view {
+  return [[GSCXExclusion alloc] initWithKind:GSCXExclusionKindSubtree
+                                        view:view
+                               excludedClass:nil
+                     accessibilityIdentifier:nil];
+}
+
++ (instancetype)exclusionWithClass:(Class)excludedClass {
+  return [[GSCXExclusion alloc] initWithKind:GSCXExclusionKindClass
+                                        view:nil
+                               excludedClass:excludedClass
+                     accessibilityIdentifier:nil];
+}
+
++ (instancetype)exclusionWithAccessibilityIdentifier:(NSString *)accessibilityIdentifier {
+  return [[GSCXExclusion alloc] initWithKind:GSCXExclusionKindAccessibilityIdentifier
+                                        view:nil
+                               excludedClass:nil
+                     accessibilityIdentifier:accessibilityIdentifier];
+}
+
++ (instancetype)exclusionWithWindow:(UIWindow *)window {
+  return [[GSCXExclusion alloc] initWithKind:GSCXExclusionKindWindow
+                                        view:window
+                               excludedClass:nil
+                     accessibilityIdentifier:nil];
+}
+
+@end
+
+@interface GSCXExclusionIndex ()
+
+/**
+ * The exclusions in this index, in the order they were added.
+ */
+@property(strong, nonatomic) NSMutableArray<GSCXExclusion *> *mutableExclusions;
+
+/**
+ * @c YES between calls to @c prepareWithRootViews: and @c reset, @c NO otherwise.
+ */
+@property(assign, nonatomic, getter=isPrepared) BOOL prepared;
+
+/**
+ * The views and windows excluded by subtree and window exclusions, compared by pointer.
+ */
+@property(strong, nonatomic, nullable) NSHashTable *excludedRoots;
+
+/**
+ * The classes excluded by class exclusions.
+ */
+@property(strong, nonatomic, nullable) NSSet<Class> *excludedClasses;
+
+/**
+ * The accessibility identifiers excluded by accessibility identifier exclusions.
+ */
+@property(strong, nonatomic, nullable) NSSet<NSString *> *excludedIdentifiers;
+
+/**
+ * Maps each class seen during this scan to whether it or a superclass is in @c excludedClasses,
+ * so class hierarchies are only walked once per class.
+ */
+@property(strong, nonatomic, nullable) NSMapTable<Class, NSNumber *> *classMatches;
+
+/**
+ * Maps each element resolved during this scan, compared by pointer, to whether it is excluded.
+ */
+@property(strong, nonatomic, nullable) NSMapTable<id, NSNumber *> *excludedByElement;
+
+@end
+
+@implementation GSCXExclusionIndex
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _mutableExclusions = [[NSMutableArray alloc] init];
+  }
+  return self;
+}
+
+- (NSArray<GSCXExclusion *> *)exclusions {
+  return [self.mutableExclusions copy];
+}
+
+- (void)addExclusion:(GSCXExclusion *)exclusion {
+  if ([self.mutableExclusions indexOfObjectIdenticalTo:exclusion] == NSNotFound) {
+    [self.mutableExclusions addObject:exclusion];
+  }
+}
+
+- (void)removeExclusion:(GSCXExclusion *)exclusion {
+  [self.mutableExclusions removeObjectIdenticalTo:exclusion];
+}
+
+- (void)prepareWithRootViews:(NSArray<UIView *> *)rootViews {
+  [self reset];
+  if (self.mutableExclusions.count == 0) {
+    return;
+  }
+  NSPointerFunctionsOptions pointerOptions =
+      NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality;
+  NSHashTable *excludedRoots = [[NSHashTable alloc] initWithOptions:pointerOptions capacity:0];
+  NSMutableSet<Class> *excludedClasses = [[NSMutableSet alloc] init];
+  NSMutableSet<NSString *> *excludedIdentifiers = [[NSMutableSet alloc] init];
+  for (GSCXExclusion *exclusion in self.mutableExclusions) {
+    switch (exclusion.kind) {
+      case GSCXExclusionKindSubtree:
+      case GSCXExclusionKindWindow: {
+        UIView *view = exclusion.view;
+        if (view != nil) {
+          [excludedRoots addObject:view];
+        }
+        break;
+      }
+      case GSCXExclusionKindClass:
+        [excludedClasses addObject:exclusion.excludedClass];
+        break;
+      case GSCXExclusionKindAccessibilityIdentifier:
+        [excludedIdentifiers addObject:exclusion.accessibilityIdentifier];
+        break;
+    }
+  }
+  self.excludedRoots = excludedRoots;
+  self.excludedClasses = excludedClasses;
+  self.excludedIdentifiers = excludedIdentifiers;
+  self.classMatches = [NSMapTable strongToStrongObjectsMapTable];
+  self.excludedByElement = [[NSMapTable alloc] initWithKeyOptions:pointerOptions
+                                                     valueOptions:NSPointerFunctionsStrongMemory
+                                                         capacity:0];
+  self.prepared = YES;
+
+  NSMutableArray<UIView *> *stack = [[NSMutableArray alloc] init];
+  for (UIView *rootView in rootViews) {
+    // The root may itself be inside an excluded subtree.
+    UIView *superview = rootView.superview;
+    if (superview == nil || ![self gscx_isViewExcluded:superview]) {
+      [stack addObject:rootView];
+    } else {
+      [self.excludedByElement setObject:@YES forKey:rootView];
+    }
+  }
+  while (stack.count > 0) {
+    UIView *view = [stack lastObject];
+    [stack removeLastObject];
+    if ([self gscx_elementMatches:view]) {
+      // The subtree is not visited. Descendants are resolved lazily if GTXiLib asks about them.
+      [self.excludedByElement setObject:@YES forKey:view];
+      continue;
+    }
+    [self.excludedByElement setObject:@NO forKey:view];
+    [stack addObjectsFromArray:view.subviews];
+  }
+}
+
+- (void)reset {
+  self.prepared = NO;
+  self.excludedRoots = nil;
+  self.excludedClasses = nil;
+  self.excludedIdentifiers = nil;
+  self.classMatches = nil;
+  self.excludedByElement = nil;
+}
+
+- (BOOL)isElementExcluded:(id)element {
+  if (!self.isPrepared) {
+    return NO;
+  }
+  NSNumber *excluded = [self.excludedByElement objectForKey:element];
+  if (excluded != nil) {
+    return [excluded boolValue];
+  }
+  if ([element isKindOfClass:[UIView class]]) {
+    return [self gscx_isViewExcluded:element];
+  }
+  // Accessibility elements that are not views are excluded if they match, or if their container
+  // is excluded. UITableView, for example, represents some of its content this way.
+  BOOL isExcluded = [self gscx_elementMatches:element];
+  if (!isExcluded && [element respondsToSelector:@selector(accessibilityContainer)]) {
+    id container = [element accessibilityContainer];
+    if (container != nil && container != element) {
+      isExcluded = [self isElementExcluded:container];
+    }
+  }
+  [self.excludedByElement setObject:@(isExcluded) forKey:element];
+  return isExcluded;
+}
+
+#pragma mark - GTXExcludeListing
+
+- (BOOL)shouldIgnoreElement:(id)element forCheckNamed:(NSString *)check {
+  return [self isElementExcluded:element];
+}
+
+#pragma mark - Private
+
+/**
+ * Determines if @c view or any of its ancestors is excluded, recording the result for every view
+ * walked so later lookups of the same views are constant time.
+ *
+ * @param view The view to look up.
+ * @return @c YES if @c view is excluded, @c NO otherwise.
+ */
+- (BOOL)gscx_isViewExcluded:(UIView *)view {
+  NSMutableArray<UIView *> *path = [[NSMutableArray alloc] init];
+  BOOL isExcluded = NO;
+  UIView *current = view;
+  while (current != nil) {
+    NSNumber *excluded = [self.excludedByElement objectForKey:current];
+    if (excluded != nil) {
+      isExcluded = [excluded boolValue];
+      break;
+    }
+    [path addObject:current];
+    current = current.superview;
+  }
+  // Exclusions are only evaluated below the nearest recorded ancestor, and not at all inside an
+  // excluded subtree.
+  for (UIView *walkedView in [path reverseObjectEnumerator]) {
+    if (!isExcluded && [self gscx_elementMatches:walkedView]) {
+      isExcluded = YES;
+    }
+    [self.excludedByElement setObject:@(isExcluded) forKey:walkedView];
+  }
+  return isExcluded;
+}
+
+/**
+ * Determines if @c element itself matches an exclusion, without considering its ancestors.
+ *
+ * @param element The element to match.
+ * @return @c YES if @c element matches an exclusion, @c NO otherwise.
+ */
+- (BOOL)gscx_elementMatches:(id)element {
+  if ([self.excludedRoots containsObject:element]) {
+    return YES;
+  }
+  if (self.excludedIdentifiers.count > 0 &&
+      [element respondsToSelector:@selector(accessibilityIdentifier)]) {
+    NSString *identifier = [element accessibilityIdentifier];
+    if (identifier != nil && [self.excludedIdentifiers containsObject:identifier]) {
+      return YES;
+    }
+  }
+  if (self.excludedClasses.count == 0) {
+    return NO;
+  }
+  Class elementClass = object_getClass(element);
+  NSNumber *classMatches = [self.classMatches objectForKey:elementClass];
+  if (classMatches == nil) {
+    BOOL matches = NO;
+    for (Class cls = elementClass; cls != Nil; cls = class_getSuperclass(cls)) {
+      if ([self.excludedClasses containsObject:cls]) {
+        matches = YES;
+        break;
+      }
+    }
+    classMatches = @(matches);
+    [self.classMatches setObject:classMatches forKey:elementClass];
+  }
+  return [classMatches boolValue];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -70,17 +70,52 @@ static const NSTimeInterval kGSCXContinuousScannerInterval = 2.0;
   viewController.scanner = [GSCXScanner scannerWithChecks:options.checks
                                              excludeLists:options.excludeLists];
   viewController.scanner.delegate = options.scannerDelegate;
+  viewController.scanner.watchdogTimeout = options.scanWatchdogTimeout;
+  if (options.screenshotCapturePolicy != nil) {
+    viewController.scanner.screenshotCapturePolicy = options.screenshotCapturePolicy;
+  }
+  if (options.baselineURL != nil) {
+    NSError *error;
+    viewController.scanner.baseline = [GSCXBaseline baselineWithContentsOfURL:options.baselineURL
+                                                                        error:&error];
+    if (viewController.scanner.baseline == nil) {
+      NSLog(@"Baseline could not be loaded, all issues will be reported: %@", error);
+    }
+  }
+  for (GSCXCheckProfile *profile in options.checkProfiles) {
+    [viewController.scanner addProfile:profile];
+  }
 
   GSCXContinuousScanner *continuousScanner =
       [GSCXInstaller _continuousScannerWithScanner:viewController.scanner
                                    activitySources:options.activitySources
                                         schedulers:options.schedulers
                                           delegate:viewController];
+  if (options.maximumScansPerScreen > 0) {
+    continuousScanner.screenScanQuota =
+        [GSCXScreenScanQuota quotaWithMaximumScansPerScreen:options.maximumScansPerScreen
+                                                 timeWindow:options.screenScanQuotaTimeWindow];
+  }
+  continuousScanner.usesCompactResultStore = options.usesCompactResultStore;
+  continuousScanner.sessionJournalDirectoryURL = options.sessionJournalDirectoryURL;
+  continuousScanner.profileRotation = options.profileRotation;
+  continuousScanner.sliceTimeBudget = options.continuousScanSliceTimeBudget;
+  continuousScanner.checkTimeBudgetPerMinute = options.continuousScanCheckTimeBudgetPerMinute;
+  continuousScanner.samplingTickCount = options.continuousScanSamplingTickCount;
+  if (options.deduplicatesScreenshots) {
+    continuousScanner.screenshotDeduplicator = [[GSCXScreenshotDeduplicator alloc] init];
+  }
   viewController.continuousScanner = continuousScanner;
   viewController.resultsWindowCoordinator = [GSCXScannerWindowCoordinator
       coordinatorWithMultiWindowPresentation:options.isMultiWindowPresentation];
-  viewController.sharingDelegate =
-      options.sharingDelegate ?: [[GSCXDefaultSharingDelegate alloc] init];
+  if (options.sharingDelegate != nil) {
+    viewController.sharingDelegate = options.sharingDelegate;
+  } else {
+    GSCXDefaultSharingDelegate *sharingDelegate = [[GSCXDefaultSharingDelegate alloc] init];
+    sharingDelegate.reportFormat = options.sharedReportFormat;
+    viewController.sharingDelegate = sharingDelegate;
+  }
+  viewController.sharesDeduplicatedIssues = options.sharesDeduplicatedIssues;
   // This forces the performScanButton into memory if it isn't already.
   [viewController loadViewIfNeeded];
   overlayWindow.windowLevel = [GSCXScannerWindowCoordinator windowLevel];
@@ -17,8 +17,10 @@
 #import <UIKit/UIKit.h>
 
 #import "GSCXActivitySourceMonitoring.h"
+#import "GSCXCheckProfile.h"
 #import "GSCXContinuousScannerScheduling.h"
 #import "GSCXScannerDelegate.h"
+#import "GSCXScreenshotCapturePolicy.h"
 #import "GSCXSharingDelegate.h"
 #import <GTXiLib/GTXiLib.h>
 NS_ASSUME_NONNULL_BEGIN
@@ -65,6 +67,103 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property(strong, nonatomic, nullable) id<GSCXSharingDelegate> sharingDelegate;
 
+/**
+ * The format the default sharing delegate shares reports in. Ignored if @c sharingDelegate is not
+ * @c nil. Defaults to @c GSCXSharedReportFormatPDF.
+ */
+@property(assign, nonatomic) GSCXSharedReportFormat sharedReportFormat;
+
+/**
+ * @c YES if shared reports of continuous scans only contain the first occurrence of each unique
+ * issue, so they are not inflated by scanning the same screen repeatedly. @c NO if they contain
+ * every issue in every scan. Defaults to @c NO.
+ */
+@property(assign, nonatomic) BOOL sharesDeduplicatedIssues;
+
+/**
+ * The maximum number of times the continuous scanner scans the same screen within
+ * @c screenScanQuotaTimeWindow. Scheduled scans beyond the quota are skipped. 0 means there is no
+ * quota. Defaults to 0.
+ */
+@property(assign, nonatomic) NSUInteger maximumScansPerScreen;
+
+/**
+ * The length of the window, in seconds, to which @c maximumScansPerScreen applies. Ignored if
+ * @c maximumScansPerScreen is 0. Defaults to 60 seconds.
+ */
+@property(assign, nonatomic) NSTimeInterval screenScanQuotaTimeWindow;
+
+/**
+ * @c YES if continuous scan results with visually identical screenshots and identical issues should
+ * share one screenshot, reducing memory use in long sessions. Defaults to @c NO.
+ */
+@property(assign, nonatomic) BOOL deduplicatesScreenshots;
+
+/**
+ * Determines how the scanner captures screenshots. Optional. If @c nil,
+ * @c GSCXScreenshotCapturePolicy.defaultPolicy is used.
+ */
+@property(copy, nonatomic, nullable) GSCXScreenshotCapturePolicy *screenshotCapturePolicy;
+
+/**
+ * @c YES if the continuous scanner keeps results in a compact store with interned strings instead
+ * of as result objects. Defaults to @c NO.
+ */
+@property(assign, nonatomic) BOOL usesCompactResultStore;
+
+/**
+ * The directory continuous scan sessions are journaled to, so they can be reopened from the
+ * scanner menu after the application crashes or is killed. @c GSCXSessionJournal.defaultDirectory
+ * is a suitable value. Optional. If @c nil, sessions are not journaled.
+ */
+@property(strong, nonatomic, nullable) NSURL *sessionJournalDirectoryURL;
+
+/**
+ * A baseline file of known issues that scans should not report, as written by
+ * @c GSCXBaseline.writeToURL:error:. Loaded once when the scanner is installed. Optional. If
+ * @c nil, all issues are reported.
+ */
+@property(strong, nonatomic, nullable) NSURL *baselineURL;
+
+/**
+ * Named sets of checks the scanner can switch between from the scanner menu, in addition to
+ * @c checks. Defaults to an empty array.
+ */
+@property(strong, nonatomic) NSArray<GSCXCheckProfile *> *checkProfiles;
+
+/**
+ * The names of profiles in @c checkProfiles the continuous scanner scans with, in turn. See
+ * @c GSCXContinuousScanner.profileRotation. Optional. If @c nil, every continuous scan uses the
+ * profile selected in the scanner menu.
+ */
+@property(copy, nonatomic, nullable) NSArray *profileRotation;
+
+/**
+ * If greater than 0, continuous scans are sliced across frames, spending at most this many seconds
+ * per frame checking elements. See @c GSCXContinuousScanner.sliceTimeBudget. Defaults to 0.
+ */
+@property(assign, nonatomic) NSTimeInterval continuousScanSliceTimeBudget;
+
+/**
+ * If greater than 0, the seconds continuous scans may spend running checks per minute. Expensive
+ * checks are throttled on screens they already ran on. See
+ * @c GSCXContinuousScanner.checkTimeBudgetPerMinute. Defaults to 0.
+ */
+@property(assign, nonatomic) NSTimeInterval continuousScanCheckTimeBudgetPerMinute;
+
+/**
+ * If greater than 1, each continuous scan only checks a sample of the screen's elements, covering
+ * every element within this many scans of the screen. See
+ * @c GSCXContinuousScanner.samplingTickCount. Defaults to 0.
+ */
+@property(assign, nonatomic) NSUInteger continuousScanSamplingTickCount;
+
+/**
+ * The maximum number of seconds a scan spends checking elements before stopping with a partial
+ * result. See @c GSCXScanner.watchdogTimeout. Defaults to 0, meaning scans are never stopped early.
+ */
+@property(assign, nonatomic) NSTimeInterval scanWatchdogTimeout;
+
 @end
 
 NS_ASSUME_NONNULL_END
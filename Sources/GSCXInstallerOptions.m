@@ -39,6 +39,21 @@ NS_ASSUME_NONNULL_BEGIN
     _activitySources = nil;
     _schedulers = nil;
     _sharingDelegate = nil;
+    _maximumScansPerScreen = 0;
+    _screenScanQuotaTimeWindow = 60.0;
+    _deduplicatesScreenshots = NO;
+    _screenshotCapturePolicy = nil;
+    _usesCompactResultStore = NO;
+    _sessionJournalDirectoryURL = nil;
+    _baselineURL = nil;
+    _checkProfiles = @[];
+    _profileRotation = nil;
+    _continuousScanSliceTimeBudget = 0;
+    _continuousScanCheckTimeBudgetPerMinute = 0;
+    _continuousScanSamplingTickCount = 0;
+    _scanWatchdogTimeout = 0;
+    _sharedReportFormat = GSCXSharedReportFormatPDF;
+    _sharesDeduplicatedIssues = NO;
     _multiWindowPresentation = NO;
   }
   return self;
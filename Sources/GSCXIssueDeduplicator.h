@@ -0,0 +1,115 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+#import "GSCXUniqueIssue.h"
+#import <GTXiLib/GTXiLib.h>
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Collapses repeated occurrences of the same accessibility issue across scans. Continuous scanning
+ * of the same screen reports the same failures repeatedly. This object assigns each failure a
+ * stable key and tracks each unique issue once, with the number of times and the range of scans it
+ * occurred in. Results are added incrementally, so this can be updated as each scan completes.
+ */
+@interface GSCXIssueDeduplicator : NSObject
+
+/**
+ * The unique issues found so far, ordered by when they were first seen.
+ */
+@property(copy, nonatomic, readonly) NSArray<GSCXUniqueIssue *> *uniqueIssues;
+
+/**
+ * The number of scan results added so far.
+ */
+@property(assign, nonatomic, readonly) NSUInteger scanCount;
+
+/**
+ * Constructs a @c GSCXIssueDeduplicator instance containing the issues in @c results.
+ *
+ * @param results The results to deduplicate, in the order they were scanned.
+ * @return A @c GSCXIssueDeduplicator instance containing the issues in @c results.
+ */
++ (instancetype)deduplicatorWithResults:(NSArray<GTXHierarchyResultCollection *> *)results;
+
+/**
+ * Adds all issues in @c result as the next scan. Issues with the same key as an existing issue
+ * increment its occurrence count. Other issues are added as new unique issues.
+ *
+ * @param result The result of the next scan.
+ */
+- (void)addResult:(GTXHierarchyResultCollection *)result;
+
+/**
+ * Removes all unique issues and resets the scan count.
+ */
+- (void)reset;
+
+/**
+ * @return The number of unique issues found so far.
+ */
+- (NSUInteger)uniqueIssueCount;
+
+/**
+ * Returns scan results containing only the first occurrence of each unique issue. Elements whose
+ * issues all occurred in previous scans are removed, and scans with no remaining elements are
+ * omitted. Useful to generate reports that are not inflated by the number of scans.
+ *
+ * @param results The results added to the receiver, in the order they were added. Unique issues
+ *  only refer to results by index, so the receiver does not retain results or their screenshots.
+ * @return The deduplicated scan results, in scan order.
+ */
+- (NSArray<GTXHierarchyResultCollection *> *)deduplicatedResultsOfResults:
+    (NSArray<GTXHierarchyResultCollection *> *)results;
+
+/**
+ * Constructs scan results containing only @c uniqueIssues. Each issue is placed on the element and
+ * scan it first occurred in. Scans with no issues are omitted.
+ *
+ * @param uniqueIssues The issues to convert to scan results, ordered by when they were first seen.
+ * @param results The results @c uniqueIssues were found in, in scan order.
+ * @return The scan results containing @c uniqueIssues, in scan order.
+ */
++ (NSArray<GTXHierarchyResultCollection *> *)
+    resultsWithUniqueIssues:(NSArray<GSCXUniqueIssue *> *)uniqueIssues
+                  inResults:(NSArray<GTXHierarchyResultCollection *> *)results;
+
+/**
+ * Computes the key identifying an issue across scans. The key is a hash of the check name and the
+ * element's identity: its class, accessibility identifier, and frame rounded to whole points. If
+ * the element has no accessibility identifier, its accessibility label is used instead. Two
+ * occurrences with the same key are considered the same issue.
+ *
+ * The key does not include the class path from the window to the element. Results only keep a
+ * @c GTXElementReference, which records the element's own class but none of its ancestors, and
+ * results read back from a session journal carry nothing more. The rounded frame stands in for the
+ * element's position in the hierarchy instead.
+ *
+ * Issue keys compare issues within a session: they deduplicate issues, screenshots and sampled
+ * scans. The frame tells apart elements sharing a label, but differs between devices, so baselines
+ * and session comparisons use @c GSCXBaseline.fingerprintForCheckResult:elementReference: instead.
+ *
+ * @param checkResult The failing check.
+ * @param elementReference The element the check failed on.
+ * @return The key identifying the issue.
+ */
++ (NSString *)issueKeyForCheckResult:(GTXCheckResult *)checkResult
+                    elementReference:(GTXElementReference *)elementReference;
+
+@end
+
+NS_ASSUME_NONNULL_END
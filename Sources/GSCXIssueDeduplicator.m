@@ -0,0 +1,176 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXIssueDeduplicator.h"
+
+#import "GSCXUtils.h"
+#import "GTXHierarchyResultCollection+GSCXScreenshot.h"
+#import "NSArray+GSCXResults.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface GSCXIssueDeduplicator ()
+
+/**
+ * The unique issues found so far, ordered by when they were first seen.
+ */
+@property(strong, nonatomic) NSMutableArray<GSCXUniqueIssue *> *mutableUniqueIssues;
+
+/**
+ * Maps issue keys to the unique issue with that key.
+ */
+@property(strong, nonatomic) NSMutableDictionary<NSString *, GSCXUniqueIssue *> *issuesByKey;
+
+@end
+
+@implementation GSCXIssueDeduplicator
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _mutableUniqueIssues = [[NSMutableArray alloc] init];
+    _issuesByKey = [[NSMutableDictionary alloc] init];
+  }
+  return self;
+}
+
++ (instancetype)deduplicatorWithResults:(NSArray<GTXHierarchyResultCollection *> *)results {
+  GSCXIssueDeduplicator *deduplicator = [[GSCXIssueDeduplicator alloc] init];
+  for (NSUInteger i = 0; i < results.count; i++) {
+    // Only the element results are read, so results decoded on access do not load screenshots.
+    [deduplicator gscx_addElementResults:[results gscx_elementResultsOfResultAtIndex:i]];
+  }
+  return deduplicator;
+}
+
+- (NSArray<GSCXUniqueIssue *> *)uniqueIssues {
+  return [self.mutableUniqueIssues copy];
+}
+
+- (void)addResult:(GTXHierarchyResultCollection *)result {
+  [self gscx_addElementResults:result.elementResults];
+}
+
+- (void)reset {
+  [self.mutableUniqueIssues removeAllObjects];
+  [self.issuesByKey removeAllObjects];
+  _scanCount = 0;
+}
+
+- (NSUInteger)uniqueIssueCount {
+  return self.mutableUniqueIssues.count;
+}
+
+- (NSArray<GTXHierarchyResultCollection *> *)deduplicatedResultsOfResults:
+    (NSArray<GTXHierarchyResultCollection *> *)results {
+  return [GSCXIssueDeduplicator resultsWithUniqueIssues:self.mutableUniqueIssues
+                                              inResults:results];
+}
+
++ (NSArray<GTXHierarchyResultCollection *> *)
+    resultsWithUniqueIssues:(NSArray<GSCXUniqueIssue *> *)uniqueIssues
+                  inResults:(NSArray<GTXHierarchyResultCollection *> *)results {
+  NSMutableArray<GTXHierarchyResultCollection *> *deduplicatedResults =
+      [[NSMutableArray alloc] init];
+  // Unique issues are ordered by first occurrence, so all issues first seen in the same scan are
+  // contiguous.
+  NSUInteger issueIndex = 0;
+  while (issueIndex < uniqueIssues.count) {
+    GSCXUniqueIssue *firstIssue = uniqueIssues[issueIndex];
+    GTXHierarchyResultCollection *result = [firstIssue originalResultInResults:results];
+    NSUInteger scanIndex = firstIssue.firstSeenScanIndex;
+    NSMutableDictionary<NSNumber *, NSMutableArray<GTXCheckResult *> *> *checksByElementIndex =
+        [[NSMutableDictionary alloc] init];
+    while (issueIndex < uniqueIssues.count &&
+           uniqueIssues[issueIndex].firstSeenScanIndex == scanIndex) {
+      GSCXUniqueIssue *issue = uniqueIssues[issueIndex];
+      NSNumber *elementIndex = @(issue.originalElementIndex);
+      if (checksByElementIndex[elementIndex] == nil) {
+        checksByElementIndex[elementIndex] = [[NSMutableArray alloc] init];
+      }
+      [checksByElementIndex[elementIndex]
+          addObject:[[GTXCheckResult alloc] initWithCheckName:issue.checkName
+                                             errorDescription:issue.errorDescription]];
+      issueIndex++;
+    }
+    NSArray<NSNumber *> *sortedElementIndices =
+        [[checksByElementIndex allKeys] sortedArrayUsingSelector:@selector(compare:)];
+    NSMutableArray<GTXElementResultCollection *> *elementResults = [[NSMutableArray alloc] init];
+    for (NSNumber *elementIndex in sortedElementIndices) {
+      GTXElementReference *elementReference =
+          result.elementResults[[elementIndex integerValue]].elementReference;
+      [elementResults
+          addObject:[[GTXElementResultCollection alloc]
+                        initWithElement:elementReference
+                           checkResults:checksByElementIndex[elementIndex]]];
+    }
+    [deduplicatedResults addObject:[result gscx_resultWithElementResults:elementResults]];
+  }
+  return deduplicatedResults;
+}
+
++ (NSString *)issueKeyForCheckResult:(GTXCheckResult *)checkResult
+                    elementReference:(GTXElementReference *)elementReference {
+  NSString *identity = elementReference.accessibilityIdentifier;
+  if (identity.length == 0) {
+    identity = elementReference.accessibilityLabel ?: @"";
+  }
+  // Subpixel differences between scans of the same screen should not create new issues.
+  CGRect frame = elementReference.accessibilityFrame;
+  NSString *keySource = [NSString
+      stringWithFormat:@"%@\n%@\n%@\n%.0f,%.0f,%.0f,%.0f", checkResult.checkName,
+                       NSStringFromClass(elementReference.elementClass), identity,
+                       round(frame.origin.x), round(frame.origin.y), round(frame.size.width),
+                       round(frame.size.height)];
+  return [GSCXUtils hexadecimalHashOfString:keySource];
+}
+
+#pragma mark - Private
+
+/**
+ * Adds all issues in @c elementResults as the next scan.
+ *
+ * @param elementResults The element results of the next scan.
+ */
+- (void)gscx_addElementResults:(NSArray<GTXElementResultCollection *> *)elementResults {
+  NSUInteger scanIndex = self.scanCount;
+  NSInteger elementIndex = 0;
+  for (GTXElementResultCollection *elementResult in elementResults) {
+    for (GTXCheckResult *checkResult in elementResult.checkResults) {
+      NSString *issueKey =
+          [GSCXIssueDeduplicator issueKeyForCheckResult:checkResult
+                                       elementReference:elementResult.elementReference];
+      GSCXUniqueIssue *issue = self.issuesByKey[issueKey];
+      if (issue != nil) {
+        [issue addOccurrenceAtScanIndex:scanIndex];
+        continue;
+      }
+      issue = [[GSCXUniqueIssue alloc] initWithIssueKey:issueKey
+                                            checkResult:checkResult
+                               originalElementReference:elementResult.elementReference
+                                   originalElementIndex:elementIndex
+                                              scanIndex:scanIndex];
+      self.issuesByKey[issueKey] = issue;
+      [self.mutableUniqueIssues addObject:issue];
+    }
+    elementIndex++;
+  }
+  _scanCount++;
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
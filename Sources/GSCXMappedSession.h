@@ -0,0 +1,113 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import <UIKit/UIKit.h>
+
+#import <GTXiLib/GTXiLib.h>
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * The name of the index file in a session directory.
+ */
+FOUNDATION_EXTERN NSString *const kGSCXMappedSessionIndexFileName;
+
+/**
+ * Reads a session written by @c GSCXSessionJournal without loading it into memory. The journal is
+ * converted once into an index file containing fixed width scan, element and check records and a
+ * table of interned strings. The index is memory mapped, and results are only decoded, along with
+ * their screenshots, when they are accessed. Recently accessed results and screenshots are cached.
+ * Safe to use from any thread.
+ */
+@interface GSCXMappedSession : NSObject
+
+/**
+ * The session directory this session was read from.
+ */
+@property(strong, nonatomic, readonly) NSURL *sessionURL;
+
+/**
+ * The number of results in the session.
+ */
+@property(assign, nonatomic, readonly) NSUInteger resultCount;
+
+/**
+ * The number of check results in all results in the session. Computed without decoding results.
+ */
+@property(assign, nonatomic, readonly) NSUInteger checkResultCount;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Opens the session at @c sessionURL, first writing its index if it does not exist or is older than
+ * the session's journal.
+ *
+ * @param sessionURL The session directory to read.
+ * @param error Set if the session cannot be read.
+ * @return The mapped session, or @c nil if it could not be read.
+ */
++ (nullable instancetype)sessionAtURL:(NSURL *)sessionURL error:(NSError **)error;
+
+/**
+ * Writes the index of the session at @c sessionURL, replacing any existing index. May be called
+ * on any thread, but is proportional to the size of the journal, so should not be called on the
+ * main thread.
+ *
+ * @param sessionURL The session directory to index.
+ * @param error Set if the index cannot be written.
+ * @return @c YES if the index was written, @c NO otherwise.
+ */
++ (BOOL)writeIndexForSessionAtURL:(NSURL *)sessionURL error:(NSError **)error;
+
+/**
+ * Decodes the result at @c index. Crashes with an assertion if @c index is out of bounds.
+ *
+ * @param index The index of the result.
+ * @return The result at @c index.
+ */
+- (GTXHierarchyResultCollection *)resultAtIndex:(NSUInteger)index;
+
+/**
+ * Decodes the element results of the result at @c index without loading its screenshot. Crashes
+ * with an assertion if @c index is out of bounds.
+ *
+ * @param index The index of the result.
+ * @return The element results of the result at @c index.
+ */
+- (NSArray<GTXElementResultCollection *> *)elementResultsAtIndex:(NSUInteger)index;
+
+/**
+ * @param index The index of a result. Crashes with an assertion if it is out of bounds.
+ * @return The size, in points, of the screenshot of the result at @c index, without loading it.
+ */
+- (CGSize)screenshotSizeAtIndex:(NSUInteger)index;
+
+/**
+ * @param index The index of a result. Crashes with an assertion if it is out of bounds.
+ * @return The number of check results in the result at @c index, without decoding it.
+ */
+- (NSUInteger)checkResultCountAtIndex:(NSUInteger)index;
+
+/**
+ * @return An array of all results in the session. Results are decoded when they are accessed, so
+ *  the array can be passed to the result view controllers and report without loading the whole
+ *  session. Copying the array returns the same array. Its @c NSArray+GSCXResults methods do not
+ *  load screenshots. The array retains the receiver.
+ */
+- (NSArray<GTXHierarchyResultCollection *> *)results;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,689 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXMappedSession.h"
+
+#import "GSCXSessionJournal.h"
+#import "GTXHierarchyResultCollection+GSCXCompleteness.h"
+#import "GTXHierarchyResultCollection+GSCXScreenshot.h"
+#import "NSArray+GSCXResults.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+NSString *const kGSCXMappedSessionIndexFileName = @"session.index";
+
+/**
+ * The bytes at the start of every index file. The last character is the format version.
+ */
+static const char kGSCXMappedSessionMagic[8] = {'G', 'S', 'C', 'X', 'I', 'D', 'X', '2'};
+
+/**
+ * The string ID representing a @c nil string.
+ */
+static const uint32_t kGSCXMappedSessionNilStringID = UINT32_MAX;
+
+/**
+ * The maximum number of decoded results cached at once.
+ */
+static const NSUInteger kGSCXMappedSessionResultCacheLimit = 64;
+
+/**
+ * The maximum number of decoded screenshots cached at once.
+ */
+static const NSUInteger kGSCXMappedSessionScreenshotCacheLimit = 8;
+
+/**
+ * The header at the start of an index file. It is followed by @c scanCount @c GSCXMappedScan
+ * records, @c elementCount @c GSCXMappedElement records, @c checkCount @c GSCXMappedCheck records,
+ * @c throttledCheckNameCount @c uint32_t string IDs of throttled check names, @c stringCount + 1
+ * @c uint32_t offsets into the string data, and @c stringDataLength bytes of UTF-8 string data.
+ * String @c i spans offsets @c i to @c i + 1.
+ */
+typedef struct {
+  char magic[8];
+  uint64_t journalLength;
+  uint32_t scanCount;
+  uint32_t elementCount;
+  uint32_t checkCount;
+  uint32_t throttledCheckNameCount;
+  uint32_t stringCount;
+  uint64_t stringDataLength;
+} GSCXMappedSessionHeader;
+
+/**
+ * A scan result. Its elements are the @c elementCount consecutive elements starting at
+ * @c firstElementIndex, and its throttled checks the @c throttledCheckNameCount consecutive
+ * throttled check names starting at @c firstThrottledCheckNameIndex.
+ */
+typedef struct {
+  uint32_t screenshotFileNameID;
+  uint32_t firstElementIndex;
+  uint32_t elementCount;
+  uint32_t checkCount;
+  uint32_t firstThrottledCheckNameIndex;
+  uint32_t throttledCheckNameCount;
+  uint32_t incomplete;
+  double screenshotScale;
+  double screenshotFrame[4];
+} GSCXMappedScan;
+
+/**
+ * An element with accessibility issues. Its checks are the @c checkCount consecutive checks
+ * starting at @c firstCheckIndex.
+ */
+typedef struct {
+  uint64_t elementAddress;
+  double accessibilityFrame[4];
+  uint32_t classNameID;
+  uint32_t labelID;
+  uint32_t identifierID;
+  uint32_t descriptionID;
+  uint32_t firstCheckIndex;
+  uint32_t checkCount;
+} GSCXMappedElement;
+
+/**
+ * A failing check.
+ */
+typedef struct {
+  uint32_t checkNameID;
+  uint32_t errorDescriptionID;
+} GSCXMappedCheck;
+
+/**
+ * Converts a rectangle to the representation stored in the index.
+ */
+static void GSCXMappedSessionStoreRect(CGRect rect, double values[4]) {
+  values[0] = rect.origin.x;
+  values[1] = rect.origin.y;
+  values[2] = rect.size.width;
+  values[3] = rect.size.height;
+}
+
+/**
+ * Converts a rectangle from the representation stored in the index.
+ */
+static CGRect GSCXMappedSessionLoadRect(const double values[4]) {
+  return CGRectMake(values[0], values[1], values[2], values[3]);
+}
+
+/**
+ * Collects the tables of an index while a journal is replayed.
+ */
+@interface GSCXMappedSessionIndexBuilder : NSObject
+
+/**
+ * Packed @c GSCXMappedScan records, one per result.
+ */
+@property(strong, nonatomic) NSMutableData *scans;
+
+/**
+ * Packed @c GSCXMappedElement records. Elements of replaced results are left in place,
+ * unreferenced.
+ */
+@property(strong, nonatomic) NSMutableData *elements;
+
+/**
+ * Packed @c GSCXMappedCheck records. Checks of replaced results are left in place, unreferenced.
+ */
+@property(strong, nonatomic) NSMutableData *checks;
+
+/**
+ * Packed @c uint32_t string IDs of throttled check names. Names of replaced results are left in
+ * place, unreferenced.
+ */
+@property(strong, nonatomic) NSMutableData *throttledCheckNameIDs;
+
+/**
+ * Every distinct string, in ID order, as concatenated UTF-8 bytes.
+ */
+@property(strong, nonatomic) NSMutableData *stringData;
+
+/**
+ * Offsets of each string into @c stringData, followed by the length of @c stringData.
+ */
+@property(strong, nonatomic) NSMutableData *stringOffsets;
+
+/**
+ * Maps strings to their IDs.
+ */
+@property(strong, nonatomic) NSMutableDictionary<NSString *, NSNumber *> *stringIDs;
+
+@end
+
+@implementation GSCXMappedSessionIndexBuilder
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _scans = [[NSMutableData alloc] init];
+    _elements = [[NSMutableData alloc] init];
+    _checks = [[NSMutableData alloc] init];
+    _throttledCheckNameIDs = [[NSMutableData alloc] init];
+    _stringData = [[NSMutableData alloc] init];
+    _stringOffsets = [[NSMutableData alloc] init];
+    _stringIDs = [[NSMutableDictionary alloc] init];
+  }
+  return self;
+}
+
+- (uint32_t)stringIDForString:(nullable NSString *)string {
+  if (string == nil) {
+    return kGSCXMappedSessionNilStringID;
+  }
+  NSNumber *stringID = self.stringIDs[string];
+  if (stringID != nil) {
+    return stringID.unsignedIntValue;
+  }
+  uint32_t newID = (uint32_t)self.stringIDs.count;
+  uint32_t offset = (uint32_t)self.stringData.length;
+  [self.stringOffsets appendBytes:&offset length:sizeof(offset)];
+  [self.stringData appendData:[string dataUsingEncoding:NSUTF8StringEncoding]];
+  self.stringIDs[string] = @(newID);
+  return newID;
+}
+
+- (GSCXMappedScan)scanByAppendingElementResults:
+    (NSArray<GTXElementResultCollection *> *)elementResults {
+  GSCXMappedScan scan = {0};
+  scan.firstElementIndex = (uint32_t)(self.elements.length / sizeof(GSCXMappedElement));
+  scan.elementCount = (uint32_t)elementResults.count;
+  for (GTXElementResultCollection *elementResult in elementResults) {
+    GTXElementReference *elementReference = elementResult.elementReference;
+    GSCXMappedElement element = {0};
+    element.elementAddress = elementReference.elementAddress;
+    GSCXMappedSessionStoreRect(elementReference.accessibilityFrame, element.accessibilityFrame);
+    element.classNameID = [self stringIDForString:NSStringFromClass(elementReference.elementClass)];
+    element.labelID = [self stringIDForString:elementReference.accessibilityLabel];
+    element.identifierID = [self stringIDForString:elementReference.accessibilityIdentifier];
+    element.descriptionID = [self stringIDForString:elementReference.elementDescription];
+    element.firstCheckIndex = (uint32_t)(self.checks.length / sizeof(GSCXMappedCheck));
+    element.checkCount = (uint32_t)elementResult.checkResults.count;
+    for (GTXCheckResult *checkResult in elementResult.checkResults) {
+      GSCXMappedCheck check = {[self stringIDForString:checkResult.checkName],
+                               [self stringIDForString:checkResult.errorDescription]};
+      [self.checks appendBytes:&check length:sizeof(check)];
+    }
+    scan.checkCount += element.checkCount;
+    [self.elements appendBytes:&element length:sizeof(element)];
+  }
+  return scan;
+}
+
+- (void)setThrottledCheckNames:(NSArray<NSString *> *)throttledCheckNames
+                        ofScan:(GSCXMappedScan *)scan {
+  scan->firstThrottledCheckNameIndex =
+      (uint32_t)(self.throttledCheckNameIDs.length / sizeof(uint32_t));
+  scan->throttledCheckNameCount = (uint32_t)throttledCheckNames.count;
+  for (NSString *checkName in throttledCheckNames) {
+    uint32_t checkNameID = [self stringIDForString:checkName];
+    [self.throttledCheckNameIDs appendBytes:&checkNameID length:sizeof(checkNameID)];
+  }
+}
+
+- (NSData *)indexDataWithJournalLength:(uint64_t)journalLength {
+  uint32_t stringDataLength = (uint32_t)self.stringData.length;
+  GSCXMappedSessionHeader header = {{0}};
+  memcpy(header.magic, kGSCXMappedSessionMagic, sizeof(header.magic));
+  header.journalLength = journalLength;
+  header.scanCount = (uint32_t)(self.scans.length / sizeof(GSCXMappedScan));
+  header.elementCount = (uint32_t)(self.elements.length / sizeof(GSCXMappedElement));
+  header.checkCount = (uint32_t)(self.checks.length / sizeof(GSCXMappedCheck));
+  header.throttledCheckNameCount = (uint32_t)(self.throttledCheckNameIDs.length / sizeof(uint32_t));
+  header.stringCount = (uint32_t)self.stringIDs.count;
+  header.stringDataLength = stringDataLength;
+  NSMutableData *data = [[NSMutableData alloc] initWithBytes:&header length:sizeof(header)];
+  [data appendData:self.scans];
+  [data appendData:self.elements];
+  [data appendData:self.checks];
+  [data appendData:self.throttledCheckNameIDs];
+  [data appendData:self.stringOffsets];
+  [data appendBytes:&stringDataLength length:sizeof(stringDataLength)];
+  [data appendData:self.stringData];
+  return data;
+}
+
+@end
+
+/**
+ * An array whose elements are decoded from a mapped session when accessed.
+ */
+@interface GSCXMappedSessionResults : NSArray<GTXHierarchyResultCollection *>
+
+/**
+ * The session results are decoded from.
+ */
+@property(strong, nonatomic) GSCXMappedSession *session;
+
+@end
+
+@implementation GSCXMappedSessionResults
+
+- (instancetype)initWithSession:(GSCXMappedSession *)session {
+  self = [super init];
+  if (self) {
+    _session = session;
+  }
+  return self;
+}
+
+- (NSUInteger)count {
+  return self.session.resultCount;
+}
+
+- (GTXHierarchyResultCollection *)objectAtIndex:(NSUInteger)index {
+  if (index >= self.session.resultCount) {
+    [NSException raise:NSRangeException
+                format:@"Index %lu beyond bounds of %lu results.", (unsigned long)index,
+                       (unsigned long)self.session.resultCount];
+  }
+  return [self.session resultAtIndex:index];
+}
+
+- (id)copyWithZone:(nullable NSZone *)zone {
+  // Copying an NSArray subclass decodes every element. The array is immutable, so it is shared.
+  return self;
+}
+
+- (NSArray<GTXElementResultCollection *> *)gscx_elementResultsOfResultAtIndex:(NSUInteger)index {
+  return [self.session elementResultsAtIndex:index];
+}
+
+- (CGSize)gscx_screenshotSizeOfResultAtIndex:(NSUInteger)index {
+  return [self.session screenshotSizeAtIndex:index];
+}
+
+@end
+
+@interface GSCXMappedSession ()
+
+/**
+ * The memory mapped index file.
+ */
+@property(strong, nonatomic) NSData *indexData;
+
+/**
+ * The header of @c indexData.
+ */
+@property(assign, nonatomic) GSCXMappedSessionHeader header;
+
+/**
+ * The scan records in @c indexData.
+ */
+@property(assign, nonatomic) const GSCXMappedScan *scans;
+
+/**
+ * The element records in @c indexData.
+ */
+@property(assign, nonatomic) const GSCXMappedElement *elements;
+
+/**
+ * The check records in @c indexData.
+ */
+@property(assign, nonatomic) const GSCXMappedCheck *checks;
+
+/**
+ * The string IDs of throttled check names in @c indexData.
+ */
+@property(assign, nonatomic) const uint32_t *throttledCheckNameIDs;
+
+/**
+ * The string offsets in @c indexData.
+ */
+@property(assign, nonatomic) const uint32_t *stringOffsets;
+
+/**
+ * The string data in @c indexData.
+ */
+@property(assign, nonatomic) const char *stringData;
+
+/**
+ * Recently decoded results, keyed by index.
+ */
+@property(strong, nonatomic) NSCache<NSNumber *, GTXHierarchyResultCollection *> *resultCache;
+
+/**
+ * Recently decoded screenshots, keyed by file name.
+ */
+@property(strong, nonatomic) NSCache<NSString *, UIImage *> *screenshotCache;
+
+@end
+
+@implementation GSCXMappedSession
+
+- (instancetype)initWithSessionURL:(NSURL *)sessionURL
+                         indexData:(NSData *)indexData
+                            header:(GSCXMappedSessionHeader)header {
+  self = [super init];
+  if (self) {
+    _sessionURL = sessionURL;
+    _indexData = indexData;
+    _header = header;
+    const uint8_t *bytes = (const uint8_t *)indexData.bytes + sizeof(header);
+    _scans = (const GSCXMappedScan *)bytes;
+    bytes += sizeof(GSCXMappedScan) * header.scanCount;
+    _elements = (const GSCXMappedElement *)bytes;
+    bytes += sizeof(GSCXMappedElement) * header.elementCount;
+    _checks = (const GSCXMappedCheck *)bytes;
+    bytes += sizeof(GSCXMappedCheck) * header.checkCount;
+    _throttledCheckNameIDs = (const uint32_t *)bytes;
+    bytes += sizeof(uint32_t) * header.throttledCheckNameCount;
+    _stringOffsets = (const uint32_t *)bytes;
+    bytes += sizeof(uint32_t) * (header.stringCount + 1);
+    _stringData = (const char *)bytes;
+    _resultCount = header.scanCount;
+    for (uint32_t i = 0; i < header.scanCount; i++) {
+      _checkResultCount += _scans[i].checkCount;
+    }
+    _resultCache = [[NSCache alloc] init];
+    _resultCache.countLimit = kGSCXMappedSessionResultCacheLimit;
+    _screenshotCache = [[NSCache alloc] init];
+    _screenshotCache.countLimit = kGSCXMappedSessionScreenshotCacheLimit;
+  }
+  return self;
+}
+
++ (nullable instancetype)sessionAtURL:(NSURL *)sessionURL error:(NSError **)error {
+  NSURL *journalURL = [GSCXSessionJournal journalURLOfSessionAtURL:sessionURL];
+  NSNumber *journalLength =
+      [[NSFileManager defaultManager] attributesOfItemAtPath:journalURL.path error:nil][NSFileSize];
+  GSCXMappedSession *session = [GSCXMappedSession gscx_mappedIndexOfSessionAtURL:sessionURL
+                                                                   journalLength:journalLength];
+  if (session != nil) {
+    return session;
+  }
+  if (![GSCXMappedSession writeIndexForSessionAtURL:sessionURL error:error]) {
+    return nil;
+  }
+  session = [GSCXMappedSession gscx_mappedIndexOfSessionAtURL:sessionURL journalLength:nil];
+  if (session == nil && error != NULL) {
+    *error = [NSError errorWithDomain:kGSCXSessionJournalErrorDomain
+                                 code:GSCXSessionJournalErrorCodeInvalidJournal
+                             userInfo:@{
+                               NSLocalizedDescriptionKey : @"Could not read session index.",
+                               NSFilePathErrorKey : sessionURL.path
+                             }];
+  }
+  return session;
+}
+
++ (BOOL)writeIndexForSessionAtURL:(NSURL *)sessionURL error:(NSError **)error {
+  NSURL *journalURL = [GSCXSessionJournal journalURLOfSessionAtURL:sessionURL];
+  // The length is read first, so records appended while indexing cause the index to be rebuilt the
+  // next time it is opened instead of being missed.
+  NSNumber *journalLength =
+      [[NSFileManager defaultManager] attributesOfItemAtPath:journalURL.path error:nil][NSFileSize];
+  GSCXMappedSessionIndexBuilder *builder = [[GSCXMappedSessionIndexBuilder alloc] init];
+  NSMutableSet<NSString *> *existingScreenshotFileNames = [[NSMutableSet alloc] init];
+  __block BOOL indexingStopped = NO;
+  GSCXSessionJournalRecordBlock block = ^(BOOL isReplacement, NSUInteger index,
+                                          NSString *screenshotFileName, CGFloat screenshotScale,
+                                          CGRect screenshotFrame, BOOL incomplete,
+                                          NSArray<NSString *> *throttledCheckNames,
+                                          NSArray<GTXElementResultCollection *> *elementResults) {
+    NSUInteger scanCount = builder.scans.length / sizeof(GSCXMappedScan);
+    if (indexingStopped || (isReplacement && index >= scanCount)) {
+      indexingStopped = YES;
+      return;
+    }
+    if (![existingScreenshotFileNames containsObject:screenshotFileName]) {
+      NSString *screenshotPath =
+          [sessionURL URLByAppendingPathComponent:screenshotFileName].path;
+      if (![[NSFileManager defaultManager] fileExistsAtPath:screenshotPath]) {
+        // Matches GSCXSessionJournal, which stops replaying at the first missing screenshot.
+        indexingStopped = YES;
+        return;
+      }
+      [existingScreenshotFileNames addObject:screenshotFileName];
+    }
+    GSCXMappedScan scan = [builder scanByAppendingElementResults:elementResults];
+    scan.screenshotFileNameID = [builder stringIDForString:screenshotFileName];
+    scan.screenshotScale = screenshotScale;
+    GSCXMappedSessionStoreRect(screenshotFrame, scan.screenshotFrame);
+    scan.incomplete = incomplete ? 1 : 0;
+    [builder setThrottledCheckNames:throttledCheckNames ofScan:&scan];
+    if (isReplacement) {
+      [builder.scans replaceBytesInRange:NSMakeRange(index * sizeof(scan), sizeof(scan))
+                               withBytes:&scan];
+    } else {
+      [builder.scans appendBytes:&scan length:sizeof(scan)];
+    }
+  };
+  if ([GSCXSessionJournal enumerateRecordsOfSessionAtURL:sessionURL
+                                              usingBlock:block
+                                                   error:error] == 0) {
+    return NO;
+  }
+  NSData *indexData = [builder indexDataWithJournalLength:journalLength.unsignedLongLongValue];
+  NSURL *indexURL = [sessionURL URLByAppendingPathComponent:kGSCXMappedSessionIndexFileName];
+  return [indexData writeToURL:indexURL options:NSDataWritingAtomic error:error];
+}
+
+- (GTXHierarchyResultCollection *)resultAtIndex:(NSUInteger)index {
+  GTX_ASSERT(index < self.resultCount, @"Index %lu is out of bounds.", (unsigned long)index);
+  GTXHierarchyResultCollection *result = [self.resultCache objectForKey:@(index)];
+  if (result != nil) {
+    return result;
+  }
+  GSCXMappedScan scan;
+  memcpy(&scan, &self.scans[index], sizeof(scan));
+  NSArray<GTXElementResultCollection *> *elementResults = [self elementResultsAtIndex:index];
+  NSString *screenshotFileName = [self gscx_stringWithID:scan.screenshotFileNameID] ?: @"";
+  CGRect screenshotFrame = GSCXMappedSessionLoadRect(scan.screenshotFrame);
+  UIImage *screenshot = [self gscx_screenshotWithFileName:screenshotFileName
+                                                    scale:(CGFloat)scan.screenshotScale
+                                                     size:screenshotFrame.size];
+  result = [GTXHierarchyResultCollection
+      gscx_resultWithElementResults:elementResults
+                         screenshot:screenshot
+                    screenshotFrame:screenshotFrame
+                         incomplete:scan.incomplete != 0
+                throttledCheckNames:[self gscx_throttledCheckNamesOfScan:scan]];
+  [self.resultCache setObject:result forKey:@(index)];
+  return result;
+}
+
+- (NSArray<GTXElementResultCollection *> *)elementResultsAtIndex:(NSUInteger)index {
+  GTX_ASSERT(index < self.resultCount, @"Index %lu is out of bounds.", (unsigned long)index);
+  GTXHierarchyResultCollection *result = [self.resultCache objectForKey:@(index)];
+  if (result != nil) {
+    return result.elementResults;
+  }
+  GSCXMappedScan scan;
+  memcpy(&scan, &self.scans[index], sizeof(scan));
+  NSMutableArray<GTXElementResultCollection *> *elementResults =
+      [[NSMutableArray alloc] initWithCapacity:scan.elementCount];
+  for (uint32_t i = 0; i < scan.elementCount; i++) {
+    uint32_t elementIndex = scan.firstElementIndex + i;
+    if (elementIndex >= self.header.elementCount) {
+      break;
+    }
+    [elementResults addObject:[self gscx_elementResultAtIndex:elementIndex]];
+  }
+  return elementResults;
+}
+
+- (CGSize)screenshotSizeAtIndex:(NSUInteger)index {
+  GTX_ASSERT(index < self.resultCount, @"Index %lu is out of bounds.", (unsigned long)index);
+  GSCXMappedScan scan;
+  memcpy(&scan, &self.scans[index], sizeof(scan));
+  return GSCXMappedSessionLoadRect(scan.screenshotFrame).size;
+}
+
+- (NSUInteger)checkResultCountAtIndex:(NSUInteger)index {
+  GTX_ASSERT(index < self.resultCount, @"Index %lu is out of bounds.", (unsigned long)index);
+  return self.scans[index].checkCount;
+}
+
+- (NSArray<GTXHierarchyResultCollection *> *)results {
+  return [[GSCXMappedSessionResults alloc] initWithSession:self];
+}
+
+#pragma mark - Private
+
+/**
+ * Maps the index of the session at @c sessionURL and validates its size.
+ *
+ * @param sessionURL The session directory containing the index.
+ * @param journalLength The current length of the session's journal, or @c nil to accept an index
+ *  of any journal length.
+ * @return The mapped session, or @c nil if the index is missing, invalid, or does not match
+ *  @c journalLength.
+ */
++ (nullable instancetype)gscx_mappedIndexOfSessionAtURL:(NSURL *)sessionURL
+                                          journalLength:(nullable NSNumber *)journalLength {
+  NSURL *indexURL = [sessionURL URLByAppendingPathComponent:kGSCXMappedSessionIndexFileName];
+  NSData *indexData = [NSData dataWithContentsOfURL:indexURL
+                                            options:NSDataReadingMappedIfSafe
+                                              error:nil];
+  GSCXMappedSessionHeader header;
+  if (indexData.length < sizeof(header)) {
+    return nil;
+  }
+  memcpy(&header, indexData.bytes, sizeof(header));
+  if (memcmp(header.magic, kGSCXMappedSessionMagic, sizeof(header.magic)) != 0 ||
+      (journalLength != nil && header.journalLength != journalLength.unsignedLongLongValue)) {
+    return nil;
+  }
+  uint64_t expectedLength = sizeof(header) + sizeof(GSCXMappedScan) * (uint64_t)header.scanCount +
+                            sizeof(GSCXMappedElement) * (uint64_t)header.elementCount +
+                            sizeof(GSCXMappedCheck) * (uint64_t)header.checkCount +
+                            sizeof(uint32_t) * (uint64_t)header.throttledCheckNameCount +
+                            sizeof(uint32_t) * ((uint64_t)header.stringCount + 1) +
+                            header.stringDataLength;
+  if (indexData.length != expectedLength) {
+    return nil;
+  }
+  return [[GSCXMappedSession alloc] initWithSessionURL:sessionURL
+                                             indexData:indexData
+                                                header:header];
+}
+
+/**
+ * Decodes the element at @c elementIndex and its checks.
+ *
+ * @param elementIndex The index of the element record. Must be in bounds.
+ * @return The decoded element result.
+ */
+- (GTXElementResultCollection *)gscx_elementResultAtIndex:(uint32_t)elementIndex {
+  GSCXMappedElement element;
+  memcpy(&element, &self.elements[elementIndex], sizeof(element));
+  NSMutableArray<GTXCheckResult *> *checkResults =
+      [[NSMutableArray alloc] initWithCapacity:element.checkCount];
+  for (uint32_t i = 0; i < element.checkCount; i++) {
+    uint32_t checkIndex = element.firstCheckIndex + i;
+    if (checkIndex >= self.header.checkCount) {
+      break;
+    }
+    GSCXMappedCheck check = self.checks[checkIndex];
+    NSString *checkName = [self gscx_stringWithID:check.checkNameID] ?: @"";
+    NSString *errorDescription = [self gscx_stringWithID:check.errorDescriptionID];
+    [checkResults addObject:[[GTXCheckResult alloc] initWithCheckName:checkName
+                                                      errorDescription:errorDescription]];
+  }
+  NSString *className = [self gscx_stringWithID:element.classNameID];
+  // Classes that are not loaded in the reading application fall back to UIView, as in
+  // GSCXSessionJournal.
+  Class elementClass = (className ? NSClassFromString(className) : Nil) ?: [UIView class];
+  GTXElementReference *elementReference = [[GTXElementReference alloc]
+      initWithElementAddress:(NSUInteger)element.elementAddress
+                elementClass:elementClass
+          accessibilityLabel:[self gscx_stringWithID:element.labelID]
+     accessibilityIdentifier:[self gscx_stringWithID:element.identifierID]
+          accessibilityFrame:GSCXMappedSessionLoadRect(element.accessibilityFrame)
+          elementDescription:[self gscx_stringWithID:element.descriptionID]];
+  return [[GTXElementResultCollection alloc] initWithElement:elementReference
+                                                checkResults:checkResults];
+}
+
+/**
+ * Decodes the names of the checks throttled in @c scan.
+ *
+ * @param scan The scan record.
+ * @return The throttled check names, skipping any that are out of bounds.
+ */
+- (NSArray<NSString *> *)gscx_throttledCheckNamesOfScan:(GSCXMappedScan)scan {
+  NSMutableArray<NSString *> *throttledCheckNames =
+      [[NSMutableArray alloc] initWithCapacity:scan.throttledCheckNameCount];
+  for (uint32_t i = 0; i < scan.throttledCheckNameCount; i++) {
+    uint32_t nameIndex = scan.firstThrottledCheckNameIndex + i;
+    if (nameIndex >= self.header.throttledCheckNameCount) {
+      break;
+    }
+    NSString *checkName = [self gscx_stringWithID:self.throttledCheckNameIDs[nameIndex]];
+    if (checkName != nil) {
+      [throttledCheckNames addObject:checkName];
+    }
+  }
+  return throttledCheckNames;
+}
+
+/**
+ * Decodes the string with ID @c stringID.
+ *
+ * @param stringID The ID of the string.
+ * @return The decoded string, or @c nil if @c stringID represents @c nil or is invalid.
+ */
+- (nullable NSString *)gscx_stringWithID:(uint32_t)stringID {
+  if (stringID >= self.header.stringCount) {
+    return nil;
+  }
+  uint32_t start = self.stringOffsets[stringID];
+  uint32_t end = self.stringOffsets[stringID + 1];
+  if (start > end || end > self.header.stringDataLength) {
+    return nil;
+  }
+  return [[NSString alloc] initWithBytes:self.stringData + start
+                                  length:end - start
+                                encoding:NSUTF8StringEncoding];
+}
+
+/**
+ * Loads the screenshot in @c fileName, or returns it from the cache.
+ *
+ * @param fileName The name of the screenshot file in the session directory.
+ * @param scale The scale of the screenshot.
+ * @param size The size, in points, of the screenshot. Used for a blank placeholder if the file
+ *  can no longer be read.
+ * @return The screenshot.
+ */
+- (UIImage *)gscx_screenshotWithFileName:(NSString *)fileName
+                                   scale:(CGFloat)scale
+                                    size:(CGSize)size {
+  UIImage *screenshot = [self.screenshotCache objectForKey:fileName];
+  if (screenshot != nil) {
+    return screenshot;
+  }
+  NSURL *screenshotURL = [self.sessionURL URLByAppendingPathComponent:fileName];
+  NSData *data = [NSData dataWithContentsOfURL:screenshotURL];
+  screenshot = data ? [UIImage imageWithData:data scale:scale] : nil;
+  if (screenshot == nil) {
+    UIGraphicsImageRendererFormat *format = [[UIGraphicsImageRendererFormat alloc] init];
+    format.scale = 1.0;
+    CGSize placeholderSize = CGSizeMake(MAX(size.width, 1.0), MAX(size.height, 1.0));
+    screenshot = [[[UIGraphicsImageRenderer alloc] initWithSize:placeholderSize format:format]
+        imageWithActions:^(UIGraphicsImageRendererContext *context) {
+          [[UIColor lightGrayColor] setFill];
+          [context fillRect:CGRectMake(0, 0, placeholderSize.width, placeholderSize.height)];
+        }];
+  }
+  [self.screenshotCache setObject:screenshot forKey:fileName];
+  return screenshot;
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
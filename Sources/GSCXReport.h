@@ -17,6 +17,8 @@
 #import <Foundation/Foundation.h>
 #import <WebKit/WebKit.h>
 
+#import "GSCXReportExporter.h"
+#import "GSCXSessionDiff.h"
 #import <GTXiLib/GTXiLib.h>
 NS_ASSUME_NONNULL_BEGIN
 
@@ -34,6 +36,14 @@ typedef void (^GSCXHTMLReportCompletionBlock)(WKWebView *webView);
  */
 typedef void (^GSCXPDFReportCompletionBlock)(NSURL *reportUrl);
 
+/**
+ * Invoked when a @c GSCXReport instance has finished exporting a machine readable report.
+ *
+ * @param reportURL A URL representing a local file at which the report is stored. Screenshots
+ *  referenced by the report are stored in the same directory.
+ */
+typedef void (^GSCXExportedReportCompletionBlock)(NSURL *reportURL);
+
 /**
  * Invoked when a @c GSCXReport instance fails to create a report.
  *
@@ -60,6 +70,16 @@ typedef void (^GSCXReportErrorBlock)(NSError *error);
  */
 - (instancetype)initWithResults:(NSArray<GTXHierarchyResultCollection *> *)results;
 
+/**
+ * Initializes a @c GSCXReport instance displaying one kind of change between two sessions, such as
+ * the issues a new build introduced. Each issue is reported once.
+ *
+ * @param diff The differences between two sessions.
+ * @param change The kind of change to display in the report.
+ * @return An initialized @c GSCXReport instance.
+ */
+- (instancetype)initWithSessionDiff:(GSCXSessionDiff *)diff change:(GSCXSessionDiffChange)change;
+
 /**
  * Creates an HTML report describing the issues found in @c report.
  *
@@ -82,6 +102,20 @@ typedef void (^GSCXReportErrorBlock)(NSError *error);
         completionBlock:(GSCXPDFReportCompletionBlock)onComplete
              errorBlock:(nullable GSCXReportErrorBlock)onError;
 
+/**
+ * Exports the issues found in @c report in a machine readable format. Unlike HTML and PDF reports,
+ * no web view is used, and records are streamed to disk on a background queue.
+ *
+ * @param report Contains the issues to export.
+ * @param format The format to export.
+ * @param onComplete Invoked on the main queue when the report has been exported.
+ * @param onError Invoked on the main queue when the report fails to be exported. Optional.
+ */
++ (void)exportReport:(GSCXReport *)report
+              format:(GSCXReportExportFormat)format
+     completionBlock:(GSCXExportedReportCompletionBlock)onComplete
+          errorBlock:(nullable GSCXReportErrorBlock)onError;
+
 @end
 
 NS_ASSUME_NONNULL_END
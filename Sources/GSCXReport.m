@@ -55,6 +55,10 @@ NS_ASSUME_NONNULL_BEGIN
   return self;
 }
 
+- (instancetype)initWithSessionDiff:(GSCXSessionDiff *)diff change:(GSCXSessionDiffChange)change {
+  return [self initWithResults:[diff resultsWithChange:change]];
+}
+
 /**
  * Begins generating an HTML report with the given results.
  *
@@ -175,6 +179,38 @@ NS_ASSUME_NONNULL_BEGIN
       }];
 }
 
++ (void)exportReport:(GSCXReport *)report
+              format:(GSCXReportExportFormat)format
+     completionBlock:(GSCXExportedReportCompletionBlock)onComplete
+          errorBlock:(nullable GSCXReportErrorBlock)onError {
+  GSCXReportExporter *exporter = [[GSCXReportExporter alloc] initWithFormat:format];
+  NSURL *directoryURL = [GSCXUtils uniqueTemporaryDirectoryURL];
+  NSURL *reportURL = [[directoryURL URLByAppendingPathComponent:@"report"]
+      URLByAppendingPathExtension:[exporter fileExtension]];
+  NSError *error = nil;
+  NSFileHandle *fileHandle = nil;
+  if ([[NSData data] writeToURL:reportURL options:0 error:&error]) {
+    fileHandle = [NSFileHandle fileHandleForWritingToURL:reportURL error:&error];
+  }
+  if (fileHandle == nil) {
+    if (onError) {
+      onError(error);
+    }
+    return;
+  }
+  [exporter exportResults:report.results
+                toFileHandle:fileHandle
+      screenshotDirectoryURL:directoryURL
+                  completion:^(NSError *_Nullable exportError) {
+                    [fileHandle closeFile];
+                    if (exportError == nil) {
+                      onComplete(reportURL);
+                    } else if (onError) {
+                      onError(exportError);
+                    }
+                  }];
+}
+
 #pragma mark - Private
 
 /**
@@ -0,0 +1,104 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import <UIKit/UIKit.h>
+
+#import <GTXiLib/GTXiLib.h>
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * The machine readable formats @c GSCXReportExporter can write.
+ */
+typedef NS_ENUM(NSInteger, GSCXReportExportFormat) {
+  /**
+   * One JSON object per line, one line per check result.
+   */
+  GSCXReportExportFormatJSONLines = 0,
+
+  /**
+   * A SARIF 2.1.0 log with one result per check result.
+   */
+  GSCXReportExportFormatSARIF,
+};
+
+/**
+ * The keys of each record in a JSON Lines export.
+ */
+FOUNDATION_EXTERN NSString *const kGSCXReportExporterScanIndexKey;
+FOUNDATION_EXTERN NSString *const kGSCXReportExporterCheckNameKey;
+FOUNDATION_EXTERN NSString *const kGSCXReportExporterErrorDescriptionKey;
+FOUNDATION_EXTERN NSString *const kGSCXReportExporterElementDescriptionKey;
+FOUNDATION_EXTERN NSString *const kGSCXReportExporterElementClassKey;
+FOUNDATION_EXTERN NSString *const kGSCXReportExporterAccessibilityLabelKey;
+FOUNDATION_EXTERN NSString *const kGSCXReportExporterAccessibilityIdentifierKey;
+FOUNDATION_EXTERN NSString *const kGSCXReportExporterFrameKey;
+FOUNDATION_EXTERN NSString *const kGSCXReportExporterScreenshotKey;
+
+/**
+ * Invoked when an export finishes.
+ *
+ * @param error The error that stopped the export, or @c nil if it succeeded.
+ */
+typedef void (^GSCXReportExporterCompletionBlock)(NSError *_Nullable error);
+
+/**
+ * Writes scan results in a machine readable format for consumption by other tools. Records are
+ * encoded and written to the file handle one scan result at a time on a background queue, so
+ * exporting does not hold the whole report in memory. Screenshots are written as PNG files next to
+ * the exported file and referenced by file name. Screenshots shared by several results are written
+ * once.
+ */
+@interface GSCXReportExporter : NSObject
+
+/**
+ * The format records are written in.
+ */
+@property(assign, nonatomic, readonly) GSCXReportExportFormat format;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Initializes an exporter writing @c format.
+ *
+ * @param format The format records are written in.
+ * @return An initialized @c GSCXReportExporter instance.
+ */
+- (instancetype)initWithFormat:(GSCXReportExportFormat)format NS_DESIGNATED_INITIALIZER;
+
+/**
+ * @return The file extension of exported files, not including the period.
+ */
+- (NSString *)fileExtension;
+
+/**
+ * Exports @c results to @c fileHandle. Returns immediately. Must not be called again until
+ * @c completion is invoked.
+ *
+ * @param results The results to export. Accessed on a background queue, so must not be mutated
+ *  until @c completion is invoked.
+ * @param fileHandle The file handle records are written to. Not closed by the exporter.
+ * @param screenshotDirectoryURL The directory screenshots are written to, or @c nil to reference
+ *  screenshots by file name without writing them.
+ * @param completion Invoked on the main queue when the export finishes.
+ */
+- (void)exportResults:(NSArray<GTXHierarchyResultCollection *> *)results
+              toFileHandle:(NSFileHandle *)fileHandle
+    screenshotDirectoryURL:(nullable NSURL *)screenshotDirectoryURL
+                completion:(GSCXReportExporterCompletionBlock)completion;
+
+@end
+
+NS_ASSUME_NONNULL_END
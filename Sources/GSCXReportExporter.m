@@ -0,0 +1,362 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXReportExporter.h"
+
+#import "GTXHierarchyResultCollection+GSCXScreenshot.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+NSString *const kGSCXReportExporterScanIndexKey = @"scanIndex";
+NSString *const kGSCXReportExporterCheckNameKey = @"checkName";
+NSString *const kGSCXReportExporterErrorDescriptionKey = @"errorDescription";
+NSString *const kGSCXReportExporterElementDescriptionKey = @"elementDescription";
+NSString *const kGSCXReportExporterElementClassKey = @"elementClass";
+NSString *const kGSCXReportExporterAccessibilityLabelKey = @"accessibilityLabel";
+NSString *const kGSCXReportExporterAccessibilityIdentifierKey = @"accessibilityIdentifier";
+NSString *const kGSCXReportExporterFrameKey = @"frame";
+NSString *const kGSCXReportExporterScreenshotKey = @"screenshot";
+
+/**
+ * The SARIF version written by SARIF exports.
+ */
+static NSString *const kGSCXReportExporterSARIFVersion = @"2.1.0";
+
+/**
+ * The schema of SARIF exports.
+ */
+static NSString *const kGSCXReportExporterSARIFSchema =
+    @"https://json.schemastore.org/sarif-2.1.0.json";
+
+/**
+ * The tool name reported in SARIF exports.
+ */
+static NSString *const kGSCXReportExporterSARIFToolName = @"GSCXScanner";
+
+/**
+ * The URL of the tool reported in SARIF exports.
+ */
+static NSString *const kGSCXReportExporterSARIFToolURI = @"https://github.com/google/GSCXScanner";
+
+@interface GSCXReportExporter ()
+
+/**
+ * Serializes encoding and writing of exports.
+ */
+@property(strong, nonatomic) dispatch_queue_t exportQueue;
+
+@end
+
+@implementation GSCXReportExporter
+
+- (instancetype)initWithFormat:(GSCXReportExportFormat)format {
+  self = [super init];
+  if (self) {
+    _format = format;
+    _exportQueue =
+        dispatch_queue_create("com.google.gscxscanner.reportexporter", DISPATCH_QUEUE_SERIAL);
+  }
+  return self;
+}
+
+- (NSString *)fileExtension {
+  switch (self.format) {
+    case GSCXReportExportFormatJSONLines:
+      return @"jsonl";
+    case GSCXReportExportFormatSARIF:
+      return @"sarif";
+  }
+}
+
+- (void)exportResults:(NSArray<GTXHierarchyResultCollection *> *)results
+              toFileHandle:(NSFileHandle *)fileHandle
+    screenshotDirectoryURL:(nullable NSURL *)screenshotDirectoryURL
+                completion:(GSCXReportExporterCompletionBlock)completion {
+  GSCXReportExportFormat format = self.format;
+  dispatch_async(self.exportQueue, ^{
+    NSError *error = nil;
+    [GSCXReportExporter gscx_exportResults:results
+                                    format:format
+                              toFileHandle:fileHandle
+                    screenshotDirectoryURL:screenshotDirectoryURL
+                                     error:&error];
+    dispatch_async(dispatch_get_main_queue(), ^{
+      completion(error);
+    });
+  });
+}
+
+#pragma mark - Private
+
+/**
+ * Exports @c results synchronously. Must be called on the export queue.
+ *
+ * @param results The results to export.
+ * @param format The format to write.
+ * @param fileHandle The file handle records are written to.
+ * @param screenshotDirectoryURL The directory screenshots are written to, or @c nil.
+ * @param error Set if the export fails.
+ * @return @c YES if the export succeeded, @c NO otherwise.
+ */
++ (BOOL)gscx_exportResults:(NSArray<GTXHierarchyResultCollection *> *)results
+                    format:(GSCXReportExportFormat)format
+              toFileHandle:(NSFileHandle *)fileHandle
+    screenshotDirectoryURL:(nullable NSURL *)screenshotDirectoryURL
+                     error:(NSError **)error {
+  BOOL isSARIF = (format == GSCXReportExportFormatSARIF);
+  if (isSARIF && ![self gscx_writeData:[self gscx_SARIFPrologue]
+                          toFileHandle:fileHandle
+                                 error:error]) {
+    return NO;
+  }
+  // Screenshots are held weakly, so results converted on access do not keep every screenshot alive
+  // for the whole export. A screenshot shared by several results stays alive while any of them is.
+  NSMapTable<UIImage *, NSString *> *screenshotFileNames = [[NSMapTable alloc]
+      initWithKeyOptions:NSPointerFunctionsWeakMemory | NSPointerFunctionsObjectPointerPersonality
+            valueOptions:NSPointerFunctionsStrongMemory
+                capacity:0];
+  NSUInteger screenshotCount = 0;
+  // Errors are kept in a strong variable, so they outlive the autorelease pool they are created in.
+  NSError *exportError = nil;
+  BOOL succeeded = YES;
+  BOOL isFirstRecord = YES;
+  NSUInteger scanCount = results.count;
+  for (NSUInteger scanIndex = 0; succeeded && scanIndex < scanCount; scanIndex++) {
+    @autoreleasepool {
+      GTXHierarchyResultCollection *result = results[scanIndex];
+      NSString *screenshotFileName = [screenshotFileNames objectForKey:result.screenshot];
+      if (screenshotFileName == nil) {
+        // Not derived from screenshotFileNames, whose count decreases as screenshots are released.
+        screenshotFileName =
+            [NSString stringWithFormat:@"screenshot_%lu.png", (unsigned long)screenshotCount];
+        screenshotCount++;
+        [screenshotFileNames setObject:screenshotFileName forKey:result.screenshot];
+        NSURL *screenshotURL =
+            [screenshotDirectoryURL URLByAppendingPathComponent:screenshotFileName];
+        if (screenshotURL != nil &&
+            ![UIImagePNGRepresentation(result.screenshot) writeToURL:screenshotURL
+                                                             options:0
+                                                               error:&exportError]) {
+          succeeded = NO;
+          continue;
+        }
+      }
+      // Each scan's records are encoded and written together, so memory use does not grow with
+      // the number of scans.
+      NSMutableData *data = [[NSMutableData alloc] init];
+      for (GTXElementResultCollection *elementResult in result.elementResults) {
+        for (GTXCheckResult *checkResult in elementResult.checkResults) {
+          NSDictionary<NSString *, id> *record =
+              isSARIF ? [self gscx_SARIFResultWithScanIndex:scanIndex
+                                                     result:result
+                                              elementResult:elementResult
+                                                checkResult:checkResult
+                                         screenshotFileName:screenshotFileName]
+                      : [self gscx_recordWithScanIndex:scanIndex
+                                         elementResult:elementResult
+                                           checkResult:checkResult
+                                    screenshotFileName:screenshotFileName];
+          NSData *json = [NSJSONSerialization dataWithJSONObject:record
+                                                         options:NSJSONWritingSortedKeys
+                                                           error:&exportError];
+          if (json == nil) {
+            succeeded = NO;
+            break;
+          }
+          if (isSARIF && !isFirstRecord) {
+            [data appendBytes:"," length:1];
+          }
+          [data appendData:json];
+          if (!isSARIF) {
+            [data appendBytes:"\n" length:1];
+          }
+          isFirstRecord = NO;
+        }
+        if (!succeeded) {
+          break;
+        }
+      }
+      succeeded = succeeded && [self gscx_writeData:data
+                                       toFileHandle:fileHandle
+                                              error:&exportError];
+    }
+  }
+  if (!succeeded) {
+    if (error != NULL) {
+      *error = exportError;
+    }
+    return NO;
+  }
+  if (isSARIF) {
+    NSData *epilogue = [@"]}]}\n" dataUsingEncoding:NSUTF8StringEncoding];
+    return [self gscx_writeData:epilogue toFileHandle:fileHandle error:error];
+  }
+  return YES;
+}
+
+/**
+ * Constructs a JSON Lines record.
+ *
+ * @param scanIndex The index of the scan containing the check result.
+ * @param elementResult The element failing the check.
+ * @param checkResult The failing check.
+ * @param screenshotFileName The file name of the scan's screenshot.
+ * @return A JSON object describing the check result.
+ */
++ (NSDictionary<NSString *, id> *)
+    gscx_recordWithScanIndex:(NSUInteger)scanIndex
+               elementResult:(GTXElementResultCollection *)elementResult
+                 checkResult:(GTXCheckResult *)checkResult
+          screenshotFileName:(NSString *)screenshotFileName {
+  GTXElementReference *elementReference = elementResult.elementReference;
+  CGRect frame = elementReference.accessibilityFrame;
+  return @{
+    kGSCXReportExporterScanIndexKey : @(scanIndex),
+    kGSCXReportExporterCheckNameKey : checkResult.checkName,
+    kGSCXReportExporterErrorDescriptionKey : checkResult.errorDescription ?: [NSNull null],
+    kGSCXReportExporterElementDescriptionKey : elementReference.elementDescription
+        ?: [NSNull null],
+    kGSCXReportExporterElementClassKey : NSStringFromClass(elementReference.elementClass)
+        ?: [NSNull null],
+    kGSCXReportExporterAccessibilityLabelKey : elementReference.accessibilityLabel
+        ?: [NSNull null],
+    kGSCXReportExporterAccessibilityIdentifierKey : elementReference.accessibilityIdentifier
+        ?: [NSNull null],
+    kGSCXReportExporterFrameKey : [self gscx_JSONObjectWithRect:frame],
+    kGSCXReportExporterScreenshotKey : screenshotFileName,
+  };
+}
+
+/**
+ * Constructs a SARIF result object. The element's frame is reported both in screen coordinates, in
+ * the result's properties, and as a rectangle on the screenshot attachment, in the screenshot's
+ * pixel coordinates, which SARIF uses for images.
+ *
+ * @param scanIndex The index of the scan containing the check result.
+ * @param result The scan containing the check result.
+ * @param elementResult The element failing the check.
+ * @param checkResult The failing check.
+ * @param screenshotFileName The file name of the scan's screenshot.
+ * @return A SARIF result object describing the check result.
+ */
++ (NSDictionary<NSString *, id> *)
+    gscx_SARIFResultWithScanIndex:(NSUInteger)scanIndex
+                           result:(GTXHierarchyResultCollection *)result
+                    elementResult:(GTXElementResultCollection *)elementResult
+                      checkResult:(GTXCheckResult *)checkResult
+               screenshotFileName:(NSString *)screenshotFileName {
+  NSDictionary<NSString *, id> *record = [self gscx_recordWithScanIndex:scanIndex
+                                                          elementResult:elementResult
+                                                            checkResult:checkResult
+                                                     screenshotFileName:screenshotFileName];
+  CGRect screenshotFrame = result.gscx_screenshotFrame;
+  CGRect frame = CGRectOffset(elementResult.elementReference.accessibilityFrame,
+                              -CGRectGetMinX(screenshotFrame), -CGRectGetMinY(screenshotFrame));
+  // Frames are in points, but the exported screenshot is in pixels.
+  CGFloat scale = result.screenshot.scale > 0.0 ? result.screenshot.scale : 1.0;
+  frame = CGRectApplyAffineTransform(frame, CGAffineTransformMakeScale(scale, scale));
+  NSString *message =
+      checkResult.errorDescription ?: elementResult.elementReference.elementDescription;
+  return @{
+    @"ruleId" : checkResult.checkName,
+    @"level" : @"warning",
+    @"message" : @{@"text" : message ?: checkResult.checkName},
+    @"locations" : @[ @{
+      @"logicalLocations" : @[ @{
+        @"name" : elementResult.elementReference.elementDescription ?: @"",
+        @"kind" : @"element",
+      } ]
+    } ],
+    @"attachments" : @[ @{
+      @"description" : @{@"text" : @"Screenshot"},
+      @"artifactLocation" : @{@"uri" : screenshotFileName},
+      @"rectangles" : @[ @{
+        @"top" : @(CGRectGetMinY(frame)),
+        @"left" : @(CGRectGetMinX(frame)),
+        @"bottom" : @(CGRectGetMaxY(frame)),
+        @"right" : @(CGRectGetMaxX(frame)),
+      } ],
+    } ],
+    @"properties" : record,
+  };
+}
+
+/**
+ * @return The start of a SARIF log, up to the opening bracket of its results array.
+ */
++ (NSData *)gscx_SARIFPrologue {
+  NSDictionary<NSString *, id> *tool = @{
+    @"driver" : @{
+      @"name" : kGSCXReportExporterSARIFToolName,
+      @"informationUri" : kGSCXReportExporterSARIFToolURI,
+    }
+  };
+  NSData *toolJSON = [NSJSONSerialization dataWithJSONObject:tool
+                                                     options:NSJSONWritingSortedKeys
+                                                       error:nil];
+  // Results are streamed, so the log is written without the end of its results array and the
+  // objects containing it.
+  NSString *prologue = [NSString
+      stringWithFormat:@"{\"$schema\":\"%@\",\"version\":\"%@\",\"runs\":[{\"tool\":%@,"
+                       @"\"results\":[",
+                       kGSCXReportExporterSARIFSchema, kGSCXReportExporterSARIFVersion,
+                       [[NSString alloc] initWithData:toolJSON encoding:NSUTF8StringEncoding]];
+  return [prologue dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+/**
+ * @param rect A rectangle.
+ * @return A JSON object describing @c rect.
+ */
++ (NSDictionary<NSString *, NSNumber *> *)gscx_JSONObjectWithRect:(CGRect)rect {
+  return @{
+    @"x" : @(rect.origin.x),
+    @"y" : @(rect.origin.y),
+    @"width" : @(rect.size.width),
+    @"height" : @(rect.size.height),
+  };
+}
+
+/**
+ * Writes @c data to @c fileHandle, converting write exceptions on older systems to errors.
+ *
+ * @param data The data to write.
+ * @param fileHandle The file handle to write to.
+ * @param error Set if the write fails.
+ * @return @c YES if the data was written, @c NO otherwise.
+ */
++ (BOOL)gscx_writeData:(NSData *)data
+          toFileHandle:(NSFileHandle *)fileHandle
+                 error:(NSError **)error {
+  if (@available(iOS 13.0, *)) {
+    return [fileHandle writeData:data error:error];
+  }
+  @try {
+    [fileHandle writeData:data];
+  } @catch (NSException *exception) {
+    if (error != NULL) {
+      *error = [NSError errorWithDomain:NSCocoaErrorDomain
+                                   code:NSFileWriteUnknownError
+                               userInfo:@{NSLocalizedDescriptionKey : exception.reason ?: @""}];
+    }
+    return NO;
+  }
+  return YES;
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -16,6 +16,8 @@
 
 #import "GSCXRingViewArranger.h"
 
+#import "GTXHierarchyResultCollection+GSCXScreenshot.h"
+
 NS_ASSUME_NONNULL_BEGIN
 
 @interface GSCXRingViewArranger ()
@@ -87,8 +89,7 @@ NS_ASSUME_NONNULL_BEGIN
       [elementResults addObject:self.result.elementResults[i]];
     }
   }
-  return [[GTXHierarchyResultCollection alloc] initWithElementResults:elementResults
-                                                           screenshot:self.result.screenshot];
+  return [self.result gscx_resultWithElementResults:elementResults];
 }
 
 - (UIImage *)imageByAddingRingViewsToSuperview:(UIView *)superview
@@ -0,0 +1,45 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Requests that a scan in progress stops early. A scan checks its token between elements, so it
+ * stops once the element being checked when @c cancel is called has been checked. Tokens can be
+ * cancelled from any thread, and cannot be reset.
+ */
+@interface GSCXScanCancellationToken : NSObject
+
+/**
+ * @c YES if @c cancel has been called, @c NO otherwise.
+ */
+@property(assign, atomic, readonly, getter=isCancelled) BOOL cancelled;
+
+/**
+ * Constructs a @c GSCXScanCancellationToken instance that has not been cancelled.
+ */
++ (instancetype)token;
+
+/**
+ * Requests that scans using this token stop. Calling this more than once has no further effect.
+ */
+- (void)cancel;
+
+@end
+
+NS_ASSUME_NONNULL_END
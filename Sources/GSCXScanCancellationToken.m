@@ -0,0 +1,42 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXScanCancellationToken.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface GSCXScanCancellationToken ()
+
+/**
+ * Redeclared so @c cancel can set it through the atomic accessor.
+ */
+@property(assign, atomic, getter=isCancelled) BOOL cancelled;
+
+@end
+
+@implementation GSCXScanCancellationToken
+
++ (instancetype)token {
+  return [[GSCXScanCancellationToken alloc] init];
+}
+
+- (void)cancel {
+  self.cancelled = YES;
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
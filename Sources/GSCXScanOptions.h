@@ -0,0 +1,107 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+#import "GSCXScanCancellationToken.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Chooses which elements of a hierarchy a scan checks.
+ *
+ * @param elements Every element in the hierarchy, in the order they are checked.
+ * @return The elements to check, in the same order.
+ */
+typedef NSArray *_Nonnull (^GSCXScanElementSampler)(NSArray *elements);
+
+/**
+ * Configures a single call to @c GSCXScanner.scanRootViews:options:. The default options produce
+ * the same result as @c GSCXScanner.scanRootViews:.
+ */
+@interface GSCXScanOptions : NSObject <NSCopying>
+
+/**
+ * Stops the scan when cancelled. Optional. Defaults to @c nil.
+ */
+@property(strong, nonatomic, nullable) GSCXScanCancellationToken *cancellationToken;
+
+/**
+ * The names of checks that are not run in this scan to limit its cost. The result of the scan
+ * lists the throttled checks that were active in
+ * @c GTXHierarchyResultCollection.gscx_throttledCheckNames. Defaults to an empty set.
+ */
+@property(copy, nonatomic) NSSet<NSString *> *throttledCheckNames;
+
+/**
+ * @c YES if the time each check takes is measured and recorded in the scanner's
+ * @c checkCostModel, @c NO otherwise. Checks are then evaluated one at a time, which is slightly
+ * slower. Defaults to @c NO.
+ */
+@property(assign, nonatomic) BOOL measuresCheckCosts;
+
+/**
+ * @c YES if each element is checked by the checks with the lowest estimated cost in the scanner's
+ * @c checkCostModel first, @c NO if checks are evaluated in the order they were registered. Checks
+ * that have not been measured are evaluated first. Combined with @c maximumFailuresPerElement or
+ * @c blockingCheckNames, this finds the first issues on each element as cheaply as possible.
+ * Defaults to @c NO.
+ */
+@property(assign, nonatomic) BOOL ordersChecksByCost;
+
+/**
+ * If greater than 0, no further checks are evaluated on an element once it has failed this many.
+ * The result is then a subset of the full result: each element with issues is reported, but not
+ * necessarily with all of them. Defaults to 0, meaning every check is evaluated on every element.
+ */
+@property(assign, nonatomic) NSUInteger maximumFailuresPerElement;
+
+/**
+ * The names of checks whose failure stops further checks from being evaluated on the failing
+ * element. Like @c maximumFailuresPerElement, the result is then a subset of the full result.
+ * Defaults to an empty set.
+ */
+@property(copy, nonatomic) NSSet<NSString *> *blockingCheckNames;
+
+/**
+ * @c YES if checks conforming to @c GSCXSnapshotChecking are evaluated on snapshots of every
+ * element in parallel across all available cores before the other checks run, @c NO if every
+ * check is evaluated serially on the main thread. The result is identical either way, provided
+ * snapshot checks agree with their @c check:error: implementations. Defaults to @c NO.
+ */
+@property(assign, nonatomic) BOOL evaluatesSnapshotChecksInParallel;
+
+/**
+ * If non-nil, only the elements it returns are checked, such as a sample chosen by a
+ * @c GSCXElementSampler. The result then only contains issues of the sampled elements. Defaults to
+ * @c nil, meaning every element is checked.
+ */
+@property(copy, nonatomic, nullable) GSCXScanElementSampler elementSampler;
+
+/**
+ * @return Options producing the same result as @c GSCXScanner.scanRootViews:.
+ */
++ (instancetype)defaultOptions;
+
+/**
+ * @return @c YES if these options require checks to be evaluated one at a time, @c NO if the scan
+ *  can check every element in a single call to @c GTXToolKit.
+ */
+- (BOOL)requiresCheckEvaluation;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,58 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXScanOptions.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@implementation GSCXScanOptions
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _throttledCheckNames = [NSSet set];
+    _blockingCheckNames = [NSSet set];
+  }
+  return self;
+}
+
++ (instancetype)defaultOptions {
+  return [[GSCXScanOptions alloc] init];
+}
+
+- (id)copyWithZone:(nullable NSZone *)zone {
+  GSCXScanOptions *options = [[GSCXScanOptions alloc] init];
+  options.cancellationToken = self.cancellationToken;
+  options.throttledCheckNames = self.throttledCheckNames;
+  options.measuresCheckCosts = self.measuresCheckCosts;
+  options.ordersChecksByCost = self.ordersChecksByCost;
+  options.maximumFailuresPerElement = self.maximumFailuresPerElement;
+  options.blockingCheckNames = self.blockingCheckNames;
+  options.evaluatesSnapshotChecksInParallel = self.evaluatesSnapshotChecksInParallel;
+  options.elementSampler = self.elementSampler;
+  return options;
+}
+
+- (BOOL)requiresCheckEvaluation {
+  return self.cancellationToken != nil || self.throttledCheckNames.count > 0 ||
+         self.measuresCheckCosts || self.ordersChecksByCost || self.maximumFailuresPerElement > 0 ||
+         self.blockingCheckNames.count > 0 || self.evaluatesSnapshotChecksInParallel ||
+         self.elementSampler != nil;
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
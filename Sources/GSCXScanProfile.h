@@ -0,0 +1,64 @@
+//
+// Copyright 2018 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Measurements taken during a single scan, to help tune scan performance.
+ */
+@interface GSCXScanProfile : NSObject
+
+/**
+ * The time, in seconds, the scan took, from when it began checking elements to when its result
+ * was constructed.
+ */
+@property(assign, nonatomic, readonly) NSTimeInterval duration;
+
+/**
+ * The number of attribute reads answered by the scan's @c GSCXAttributeCache.
+ */
+@property(assign, nonatomic, readonly) NSUInteger attributeCacheHitCount;
+
+/**
+ * The number of attribute reads the scan's @c GSCXAttributeCache had to query the element for.
+ */
+@property(assign, nonatomic, readonly) NSUInteger attributeCacheMissCount;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Initializes a @c GSCXScanProfile instance.
+ *
+ * @param duration The time, in seconds, the scan took.
+ * @param attributeCacheHitCount The number of attribute reads answered by the cache.
+ * @param attributeCacheMissCount The number of attribute reads that queried the element.
+ * @return An initialized @c GSCXScanProfile instance.
+ */
+- (instancetype)initWithDuration:(NSTimeInterval)duration
+          attributeCacheHitCount:(NSUInteger)attributeCacheHitCount
+         attributeCacheMissCount:(NSUInteger)attributeCacheMissCount NS_DESIGNATED_INITIALIZER;
+
+/**
+ * @return The fraction of attribute reads answered by the cache, between 0 and 1, or 0 if no
+ *  attributes were read.
+ */
+- (double)attributeCacheHitRate;
+
+@end
+
+NS_ASSUME_NONNULL_END
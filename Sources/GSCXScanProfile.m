@@ -0,0 +1,45 @@
+//
+// Copyright 2018 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXScanProfile.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@implementation GSCXScanProfile
+
+- (instancetype)initWithDuration:(NSTimeInterval)duration
+          attributeCacheHitCount:(NSUInteger)attributeCacheHitCount
+         attributeCacheMissCount:(NSUInteger)attributeCacheMissCount {
+  self = [super init];
+  if (self) {
+    _duration = duration;
+    _attributeCacheHitCount = attributeCacheHitCount;
+    _attributeCacheMissCount = attributeCacheMissCount;
+  }
+  return self;
+}
+
+- (double)attributeCacheHitRate {
+  NSUInteger readCount = self.attributeCacheHitCount + self.attributeCacheMissCount;
+  if (readCount == 0) {
+    return 0.0;
+  }
+  return (double)self.attributeCacheHitCount / readCount;
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
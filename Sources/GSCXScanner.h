@@ -18,7 +18,17 @@
 #import <UIKit/UIKit.h>
 
 #import "GSCXAnalytics.h"
+#import "GSCXBaseline.h"
+#import "GSCXCheckCostModel.h"
+#import "GSCXCheckProfile.h"
+#import "GSCXExclusion.h"
+#import "GSCXScanCancellationToken.h"
+#import "GSCXScanOptions.h"
+#import "GSCXScanProfile.h"
 #import "GSCXScannerDelegate.h"
+#import "GSCXScreenshotCapturePolicy.h"
+#import "GSCXSlicedScan.h"
+#import "GTXHierarchyResultCollection+GSCXCompleteness.h"
 
 // All GTXiLib imports are grouped here to help with OSS release script which replaces the below
 // with GTXiLib framework import.
@@ -41,6 +51,66 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property(strong, nonatomic, nullable, readonly) GTXHierarchyResultCollection *lastScanResult;
 
+/**
+ * Measurements taken during the most recent call to @c scanRootViews: or one of its variants, or
+ * @c nil if no such scan has been performed yet. Set before the delegate is notified that the scan
+ * finished.
+ */
+@property(strong, nonatomic, nullable, readonly) GSCXScanProfile *lastScanProfile;
+
+/**
+ * Determines how the screenshot of each scan is captured. Defaults to
+ * @c GSCXScreenshotCapturePolicy.defaultPolicy, which captures the whole screen at full
+ * resolution.
+ */
+@property(copy, nonatomic) GSCXScreenshotCapturePolicy *screenshotCapturePolicy;
+
+/**
+ * Known issues that are not reported. Issues in the baseline are removed before results are
+ * constructed, so they never cause screenshots to be captured or retained. Optional. If @c nil, all
+ * issues are reported.
+ */
+@property(strong, nonatomic, nullable) GSCXBaseline *baseline;
+
+/**
+ * The exclusions added with @c addExclusion:, in the order they were added.
+ */
+@property(copy, nonatomic, readonly) NSArray<GSCXExclusion *> *exclusions;
+
+/**
+ * The profiles added with @c addProfile:, in the order they were added.
+ */
+@property(copy, nonatomic, readonly) NSArray<GSCXCheckProfile *> *profiles;
+
+/**
+ * The name of the profile whose checks and excludeLists are used by @c scanRootViews:. If @c nil,
+ * the checks and excludeLists registered with this instance are used instead. Must be @c nil or
+ * the name of a profile in @c profiles. Each profile's toolkit is built when it is added, so
+ * switching profiles is constant time. Defaults to @c nil.
+ */
+@property(copy, nonatomic, nullable) NSString *activeProfileName;
+
+/**
+ * The maximum number of seconds a call to @c scanRootViews: or
+ * @c scanRootViews:cancellationToken: spends checking elements. Once exceeded, the scan stops after
+ * the element being checked, returns a partial result marked with
+ * @c GTXHierarchyResultCollection.gscx_isIncomplete, and reports the slowest check to the delegate
+ * and @c GSCXAnalytics. Defaults to 0, meaning scans are never stopped early.
+ */
+@property(assign, nonatomic) NSTimeInterval watchdogTimeout;
+
+/**
+ * Estimates how long each check takes per element. Updated by every scan that evaluates checks one
+ * at a time, such as scans with @c GSCXScanOptions.measuresCheckCosts set or a watchdog.
+ */
+@property(strong, nonatomic, readonly) GSCXCheckCostModel *checkCostModel;
+
+/**
+ * The checks the next scan will run: those of the active profile, or the registered checks if no
+ * profile is active.
+ */
+@property(copy, nonatomic, readonly) NSArray<id<GTXChecking>> *activeChecks;
+
 /**
  * Constructs a GSCXScanner object.
  */
@@ -68,6 +138,56 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (GTXHierarchyResultCollection *)scanRootViews:(NSArray<UIView *> *)rootViews;
 
+/**
+ * Scans the view hierarchy like @c scanRootViews:, but stops after the element being checked when
+ * @c cancellationToken is cancelled or @c watchdogTimeout is exceeded. Equivalent to
+ * @c scanRootViews:options: with only @c GSCXScanOptions.cancellationToken set.
+ *
+ * @param rootViews An array of views to check for accessibility issues. Must not be empty.
+ * @param cancellationToken Stops the scan when cancelled. Optional.
+ * @return A @c GTXHierarchyResultCollection object containing the issues found in the scan.
+ */
+- (GTXHierarchyResultCollection *)scanRootViews:(NSArray<UIView *> *)rootViews
+                              cancellationToken:
+                                  (nullable GSCXScanCancellationToken *)cancellationToken;
+
+/**
+ * Scans the view hierarchy like @c scanRootViews:, configured by @c options. If the scan is
+ * cancelled or @c watchdogTimeout is exceeded, it stops after the element being checked, returns
+ * the issues found so far in a result marked with
+ * @c GTXHierarchyResultCollection.gscx_isIncomplete, and reports the slowest check to the delegate
+ * and @c GSCXAnalytics. Unless @c options are the defaults and there is no watchdog, checks are
+ * evaluated one at a time so they can be controlled and timed, which is slightly slower.
+ *
+ * @param rootViews An array of views to check for accessibility issues. Must not be empty.
+ * @param options Configures the scan.
+ * @return A @c GTXHierarchyResultCollection object containing the issues found in the scan.
+ */
+- (GTXHierarchyResultCollection *)scanRootViews:(NSArray<UIView *> *)rootViews
+                                        options:(GSCXScanOptions *)options;
+
+/**
+ * Scans the view hierarchy like @c scanRootViews:, but checks elements in slices performed on
+ * successive frames, each lasting at most @c timeBudget seconds, so the main thread is never
+ * blocked for a whole scan. The checks, excludeLists and profile active when this method is called
+ * are used for the whole scan. If the hierarchy changes structurally before the scan completes,
+ * the scan is invalidated rather than reporting a mix of two screens. Beginning another scan,
+ * sliced or not, invalidates a sliced scan in progress. @c lastScanResult is only set, and the
+ * delegate only notified of the result, if the scan completes.
+ *
+ * @param rootViews An array of views to check for accessibility issues. Must not be empty.
+ * @param timeBudget The maximum number of seconds each slice spends checking elements. 0.004 is a
+ *  suitable value, leaving most of a 60Hz frame for the application.
+ * @param completion Invoked on the main thread when the scan ends, with the result of the scan, or
+ *  @c nil if it was invalidated.
+ * @return The scan in progress. Can be used to invalidate the scan.
+ */
+- (GSCXSlicedScan *)beginSlicedScanOfRootViews:(NSArray<UIView *> *)rootViews
+                                    timeBudget:(NSTimeInterval)timeBudget
+                                    completion:
+                                        (void (^)(GTXHierarchyResultCollection *_Nullable result))
+                                            completion;
+
 /**
  * Registers the given check to be executed on all elements this instance is used
  * on.
@@ -99,6 +219,51 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)deregisterExcludeList:(id<GTXExcludeListing>)excludeList;
 
+/**
+ * Applies many registrations and deregistrations of checks and excludeLists at once. The
+ * underlying toolkit is updated at most once, after @c updates returns, instead of after each
+ * change. Toolkits for recently used configurations are cached, so returning to a previous set of
+ * checks and excludeLists does not rebuild the toolkit. Batch updates may be nested. The toolkit is
+ * updated when the outermost batch update completes.
+ *
+ * @param updates Registers and deregisters checks and excludeLists. Invoked synchronously.
+ */
+- (void)performBatchUpdates:(void(NS_NOESCAPE ^)(void))updates;
+
+/**
+ * Skips the part of the view hierarchy matched by @c exclusion in all subsequent scans. Prefer this
+ * to @c registerExcludeList: for excluding views, subtrees, classes or windows. All exclusions are
+ * compiled into hash lookups before each scan, so their cost does not grow with the number of
+ * checks or the depth of the hierarchy. Adding an exclusion that was already added does nothing.
+ *
+ * @param exclusion The exclusion to add.
+ */
+- (void)addExclusion:(GSCXExclusion *)exclusion;
+
+/**
+ * Stops skipping the part of the view hierarchy matched by @c exclusion. If @c exclusion was not
+ * added, does nothing.
+ *
+ * @param exclusion The exclusion to remove.
+ */
+- (void)removeExclusion:(GSCXExclusion *)exclusion;
+
+/**
+ * Adds @c profile to @c profiles and builds its toolkit. Exclusions added with @c addExclusion:
+ * apply to every profile. Replaces any profile with the same name.
+ *
+ * @param profile The profile to add.
+ */
+- (void)addProfile:(GSCXCheckProfile *)profile;
+
+/**
+ * Removes the profile named @c name from @c profiles. If it is the active profile,
+ * @c activeProfileName is reset to @c nil. If no profile is named @c name, does nothing.
+ *
+ * @param name The name of the profile to remove.
+ */
+- (void)removeProfileNamed:(NSString *)name;
+
 @end
 
 NS_ASSUME_NONNULL_END
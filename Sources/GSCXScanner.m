@@ -16,13 +16,44 @@
 
 #import "GSCXScanner.h"
 
+#import <QuartzCore/QuartzCore.h>
+
+#import "GSCXAttributeCache.h"
+#import "GSCXCheckEvaluator.h"
 #import <GTXiLib/GTXiLib.h>
 NS_ASSUME_NONNULL_BEGIN
 
+/**
+ * The maximum number of toolkits cached for previously used configurations of checks and
+ * excludeLists.
+ */
+static const NSUInteger kGSCXScannerToolkitCacheCountLimit = 8;
+
 @interface GSCXScanner () {
   GTXToolKit *_toolkit;
 }
 
+/**
+ * The configuration @c _toolkit was built with, as returned by @c gscx_configurationKey.
+ */
+@property(strong, nonatomic) NSSet *toolkitConfigurationKey;
+
+/**
+ * Toolkits built for previous configurations, keyed by configuration, so returning to a previous
+ * configuration does not rebuild the toolkit.
+ */
+@property(strong, nonatomic) NSCache<NSSet *, GTXToolKit *> *toolkitCache;
+
+/**
+ * The number of @c performBatchUpdates: calls in progress.
+ */
+@property(assign, nonatomic) NSUInteger batchUpdateDepth;
+
+/**
+ * @c YES if checks or excludeLists changed during the current batch update, @c NO otherwise.
+ */
+@property(assign, nonatomic) BOOL needsToolkitUpdate;
+
 /**
  * The checks used by @c _toolkit to check elements. Must be stored here so the toolkit can be
  * re-instantiated when checks are added or removed.
@@ -35,6 +66,41 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property(strong, nonatomic) NSMutableSet<id<GTXExcludeListing>> *excludeLists;
 
+/**
+ * Compiles the exclusions added with @c addExclusion:. Always registered with @c _toolkit, so
+ * adding and removing exclusions does not re-instantiate the toolkit.
+ */
+@property(strong, nonatomic) GSCXExclusionIndex *exclusionIndex;
+
+/**
+ * The profiles added with @c addProfile:, in the order they were added.
+ */
+@property(strong, nonatomic) NSMutableArray<GSCXCheckProfile *> *mutableProfiles;
+
+/**
+ * The toolkit built for each profile in @c mutableProfiles, keyed by profile name.
+ */
+@property(strong, nonatomic) NSMutableDictionary<NSString *, GTXToolKit *> *profileToolkits;
+
+/**
+ * The sliced scan in progress, or @c nil if there is none. @c exclusionIndex stays prepared for
+ * its root views until it ends.
+ */
+@property(strong, nonatomic, nullable) GSCXSlicedScan *slicedScan;
+
+/**
+ * Evaluates the registered checks one at a time. Built when first needed, and discarded whenever
+ * @c _toolkit changes.
+ */
+@property(strong, nonatomic, nullable) GSCXCheckEvaluator *registeredChecksEvaluator;
+
+/**
+ * Evaluates the checks of each profile one at a time, keyed by profile name. Built when first
+ * needed.
+ */
+@property(strong, nonatomic)
+    NSMutableDictionary<NSString *, GSCXCheckEvaluator *> *profileEvaluators;
+
 @end
 
 @implementation GSCXScanner
@@ -45,6 +111,17 @@ NS_ASSUME_NONNULL_BEGIN
     _toolkit = [GTXToolKit toolkitWithNoChecks];
     _checks = [[NSMutableDictionary alloc] init];
     _excludeLists = [[NSMutableSet alloc] init];
+    _exclusionIndex = [[GSCXExclusionIndex alloc] init];
+    _mutableProfiles = [[NSMutableArray alloc] init];
+    _profileToolkits = [[NSMutableDictionary alloc] init];
+    _profileEvaluators = [[NSMutableDictionary alloc] init];
+    [_toolkit registerExcludeList:_exclusionIndex];
+    _toolkitConfigurationKey = [NSSet set];
+    _toolkitCache = [[NSCache alloc] init];
+    _toolkitCache.countLimit = kGSCXScannerToolkitCacheCountLimit;
+    [_toolkitCache setObject:_toolkit forKey:_toolkitConfigurationKey];
+    _screenshotCapturePolicy = [GSCXScreenshotCapturePolicy defaultPolicy];
+    _checkCostModel = [[GSCXCheckCostModel alloc] init];
   }
   return self;
 }
@@ -56,70 +133,579 @@ NS_ASSUME_NONNULL_BEGIN
 + (instancetype)scannerWithChecks:(NSArray<id<GTXChecking>> *)checks
                      excludeLists:(NSArray<id<GTXExcludeListing>> *)excludeLists {
   GSCXScanner *scanner = [GSCXScanner scanner];
-  for (id<GTXChecking> check in checks) {
-    [scanner registerCheck:check];
-  }
-  for (id<GTXExcludeListing> excludeList in excludeLists) {
-    [scanner registerExcludeList:excludeList];
-  }
+  [scanner performBatchUpdates:^{
+    for (id<GTXChecking> check in checks) {
+      [scanner registerCheck:check];
+    }
+    for (id<GTXExcludeListing> excludeList in excludeLists) {
+      [scanner registerExcludeList:excludeList];
+    }
+  }];
   return scanner;
 }
 
 - (GTXHierarchyResultCollection *)scanRootViews:(NSArray<UIView *> *)rootViews {
+  return [self scanRootViews:rootViews cancellationToken:nil];
+}
+
+- (GTXHierarchyResultCollection *)scanRootViews:(NSArray<UIView *> *)rootViews
+                              cancellationToken:
+                                  (nullable GSCXScanCancellationToken *)cancellationToken {
+  GSCXScanOptions *options = [GSCXScanOptions defaultOptions];
+  options.cancellationToken = cancellationToken;
+  return [self scanRootViews:rootViews options:options];
+}
+
+- (GTXHierarchyResultCollection *)scanRootViews:(NSArray<UIView *> *)rootViews
+                                        options:(GSCXScanOptions *)options {
   GTX_ASSERT(rootViews.count > 0, @"rootViews cannot be empty.");
+  [self.slicedScan invalidate];
   if ([self.delegate respondsToSelector:@selector(scannerWillBeginScan:)]) {
     [self.delegate scannerWillBeginScan:self];
   }
-  GTXResult *gtxResult = [_toolkit resultFromCheckingAllElementsFromRootElements:rootViews];
-  NSArray<NSError *> *errors = gtxResult.errorsFound;
-  if (errors.count) {
-    [GSCXAnalytics invokeAnalyticsEvent:GSCXAnalyticsEventErrorsFound count:errors.count];
+  CFTimeInterval start = CACurrentMediaTime();
+  [self.exclusionIndex prepareWithRootViews:rootViews];
+  // Every check reading attributes through the current cache shares them until the scan ends. A
+  // check may start a nested scan, so the outer scan's cache is restored rather than cleared.
+  GSCXAttributeCache *previousAttributeCache = [GSCXAttributeCache currentCache];
+  GSCXAttributeCache *attributeCache = [[GSCXAttributeCache alloc] init];
+  [GSCXAttributeCache setCurrentCache:attributeCache];
+  GTXHierarchyResultCollection *result;
+  if (![options requiresCheckEvaluation] && self.watchdogTimeout <= 0) {
+    GTXResult *gtxResult =
+        [[self gscx_activeToolkit] resultFromCheckingAllElementsFromRootElements:rootViews];
+    result = [self gscx_resultWithErrors:gtxResult.errorsFound rootViews:rootViews];
   } else {
-    [GSCXAnalytics invokeAnalyticsEvent:GSCXAnalyticsEventScanPerformed count:1];
+    result = [self gscx_guardedResultFromCheckingRootViews:rootViews options:options];
   }
-  _lastScanResult = [[GTXHierarchyResultCollection alloc] initWithErrors:gtxResult.errorsFound
-                                                               rootViews:rootViews];
-  if ([self.delegate respondsToSelector:@selector(scanner:didFinishScanWithResult:)]) {
-    [self.delegate scanner:self didFinishScanWithResult:self.lastScanResult];
+  [GSCXAttributeCache setCurrentCache:previousAttributeCache];
+  [self.exclusionIndex reset];
+  _lastScanProfile =
+      [[GSCXScanProfile alloc] initWithDuration:CACurrentMediaTime() - start
+                         attributeCacheHitCount:attributeCache.hitCount
+                        attributeCacheMissCount:attributeCache.missCount];
+  return [self gscx_publishResult:result];
+}
+
+- (NSArray<id<GTXChecking>> *)activeChecks {
+  return [self gscx_activeEvaluator].checks;
+}
+
+- (GSCXSlicedScan *)beginSlicedScanOfRootViews:(NSArray<UIView *> *)rootViews
+                                    timeBudget:(NSTimeInterval)timeBudget
+                                    completion:
+                                        (void (^)(GTXHierarchyResultCollection *_Nullable result))
+                                            completion {
+  GTX_ASSERT(rootViews.count > 0, @"rootViews cannot be empty.");
+  [self.slicedScan invalidate];
+  if ([self.delegate respondsToSelector:@selector(scannerWillBeginScan:)]) {
+    [self.delegate scannerWillBeginScan:self];
   }
-  return _lastScanResult;
+  [self.exclusionIndex prepareWithRootViews:rootViews];
+  __weak __typeof__(self) weakSelf = self;
+  GSCXSlicedScan *slicedScan = [[GSCXSlicedScan alloc]
+      initWithToolkit:[self gscx_activeToolkit]
+            rootViews:rootViews
+           timeBudget:timeBudget
+           completion:^(GSCXSlicedScan *scan, NSArray<NSError *> *_Nullable errors) {
+             __typeof__(self) strongSelf = weakSelf;
+             if (strongSelf == nil) {
+               completion(nil);
+               return;
+             }
+             if (strongSelf.slicedScan == scan) {
+               strongSelf.slicedScan = nil;
+               [strongSelf.exclusionIndex reset];
+             }
+             GTXHierarchyResultCollection *result = nil;
+             if (errors != nil) {
+               result = [strongSelf
+                   gscx_publishResult:[strongSelf gscx_resultWithErrors:errors
+                                                              rootViews:scan.rootViews]];
+             }
+             completion(result);
+           }];
+  self.slicedScan = slicedScan;
+  [slicedScan start];
+  return slicedScan;
 }
 
 - (void)registerCheck:(id<GTXChecking>)check {
-  [_toolkit registerCheck:check];
+  id<GTXChecking> existingCheck = self.checks[[check name]];
+  if (existingCheck == check) {
+    return;
+  }
   self.checks[[check name]] = check;
+  // Replacing a check with the same name cannot be done in place.
+  [self gscx_updateToolkitWithAddedCheck:(existingCheck ? nil : check) addedExcludeList:nil];
 }
 
 - (void)deregisterCheck:(id<GTXChecking>)check {
+  if (self.checks[[check name]] == nil) {
+    return;
+  }
   [self.checks removeObjectForKey:[check name]];
-  [self gscx_reinitializeToolkit];
+  [self gscx_updateToolkitWithAddedCheck:nil addedExcludeList:nil];
 }
 
 - (void)registerExcludeList:(id<GTXExcludeListing>)excludeList {
-  [_toolkit registerExcludeList:excludeList];
+  if ([self.excludeLists containsObject:excludeList]) {
+    return;
+  }
   [self.excludeLists addObject:excludeList];
+  [self gscx_updateToolkitWithAddedCheck:nil addedExcludeList:excludeList];
 }
 
 - (void)deregisterExcludeList:(id<GTXExcludeListing>)excludeList {
+  if (![self.excludeLists containsObject:excludeList]) {
+    return;
+  }
   [self.excludeLists removeObject:excludeList];
-  [self gscx_reinitializeToolkit];
+  [self gscx_updateToolkitWithAddedCheck:nil addedExcludeList:nil];
+}
+
+- (void)performBatchUpdates:(void(NS_NOESCAPE ^)(void))updates {
+  self.batchUpdateDepth++;
+  updates();
+  self.batchUpdateDepth--;
+  if (self.batchUpdateDepth == 0 && self.needsToolkitUpdate) {
+    self.needsToolkitUpdate = NO;
+    [self gscx_updateToolkitWithAddedCheck:nil addedExcludeList:nil];
+  }
+}
+
+- (NSArray<GSCXExclusion *> *)exclusions {
+  return self.exclusionIndex.exclusions;
+}
+
+- (void)addExclusion:(GSCXExclusion *)exclusion {
+  [self.exclusionIndex addExclusion:exclusion];
+}
+
+- (void)removeExclusion:(GSCXExclusion *)exclusion {
+  [self.exclusionIndex removeExclusion:exclusion];
+}
+
+- (NSArray<GSCXCheckProfile *> *)profiles {
+  return [self.mutableProfiles copy];
+}
+
+- (void)setActiveProfileName:(nullable NSString *)activeProfileName {
+  GTX_ASSERT(activeProfileName == nil || self.profileToolkits[activeProfileName] != nil,
+             @"No profile named %@.", activeProfileName);
+  _activeProfileName = [activeProfileName copy];
+}
+
+- (void)addProfile:(GSCXCheckProfile *)profile {
+  NSUInteger existingIndex = [self gscx_indexOfProfileNamed:profile.name];
+  if (existingIndex == NSNotFound) {
+    [self.mutableProfiles addObject:profile];
+  } else {
+    self.mutableProfiles[existingIndex] = profile;
+  }
+  GTXToolKit *toolkit = [GTXToolKit toolkitWithNoChecks];
+  [toolkit registerExcludeList:self.exclusionIndex];
+  for (id<GTXChecking> check in profile.checks) {
+    [toolkit registerCheck:check];
+  }
+  for (id<GTXExcludeListing> excludeList in profile.excludeLists) {
+    [toolkit registerExcludeList:excludeList];
+  }
+  self.profileToolkits[profile.name] = toolkit;
+  [self.profileEvaluators removeObjectForKey:profile.name];
+}
+
+- (void)removeProfileNamed:(NSString *)name {
+  NSUInteger index = [self gscx_indexOfProfileNamed:name];
+  if (index == NSNotFound) {
+    return;
+  }
+  [self.mutableProfiles removeObjectAtIndex:index];
+  [self.profileToolkits removeObjectForKey:name];
+  [self.profileEvaluators removeObjectForKey:name];
+  if ([self.activeProfileName isEqualToString:name]) {
+    self.activeProfileName = nil;
+  }
 }
 
 #pragma mark - Private
 
 /**
- * Constructs a new @c GSCXToolKit instance with the current checks and excludeLists. @c _toolkit is
- * guaranteed to have all the checks and excludeLists registered when it is assigned.
+ * @return The toolkit of the active profile, or the toolkit of the registered checks and
+ *  excludeLists if no profile is active.
+ */
+- (GTXToolKit *)gscx_activeToolkit {
+  if (self.activeProfileName != nil) {
+    return self.profileToolkits[self.activeProfileName];
+  }
+  return _toolkit;
+}
+
+/**
+ * @return Evaluates the checks of the active profile one at a time, or the registered checks if no
+ *  profile is active.
+ */
+- (GSCXCheckEvaluator *)gscx_activeEvaluator {
+  NSString *profileName = self.activeProfileName;
+  if (profileName == nil) {
+    if (self.registeredChecksEvaluator == nil) {
+      NSMutableArray<id<GTXExcludeListing>> *excludeLists =
+          [NSMutableArray arrayWithObject:self.exclusionIndex];
+      [excludeLists addObjectsFromArray:[self.excludeLists allObjects]];
+      self.registeredChecksEvaluator =
+          [[GSCXCheckEvaluator alloc] initWithChecks:[self.checks allValues]
+                                        excludeLists:excludeLists];
+    }
+    return self.registeredChecksEvaluator;
+  }
+  GSCXCheckEvaluator *evaluator = self.profileEvaluators[profileName];
+  if (evaluator == nil) {
+    GSCXCheckProfile *profile = self.mutableProfiles[[self gscx_indexOfProfileNamed:profileName]];
+    NSMutableArray<id<GTXExcludeListing>> *excludeLists =
+        [NSMutableArray arrayWithObject:self.exclusionIndex];
+    [excludeLists addObjectsFromArray:profile.excludeLists];
+    evaluator = [[GSCXCheckEvaluator alloc] initWithChecks:profile.checks
+                                              excludeLists:excludeLists];
+    self.profileEvaluators[profileName] = evaluator;
+  }
+  return evaluator;
+}
+
+/**
+ * Checks the elements of @c rootViews one check at a time, skipping throttled checks and stopping
+ * between elements if the scan is cancelled or @c watchdogTimeout is exceeded. Elements excluded by
+ * @c exclusionIndex are skipped before any check runs on them. Only checks the elements chosen by
+ * @c options.elementSampler, if there is one. Checks are evaluated in the order
+ * selected by @c options, and stop on each element when @c options says it has failed enough. If
+ * @c options allows it, snapshot checks are first evaluated on every element in parallel, and only
+ * re-evaluated serially on elements whose snapshot failed, so errors are reported in element order
+ * exactly as if every check ran serially. Records the time each evaluated check took in
+ * @c checkCostModel. If the scan stops early, reports the check that spent the most time to the
+ * delegate and analytics.
+ *
+ * @param rootViews The root views to scan.
+ * @param options Configures the scan.
+ * @return The result of the scan, marked incomplete if it stopped early.
+ */
+- (GTXHierarchyResultCollection *)
+    gscx_guardedResultFromCheckingRootViews:(NSArray<UIView *> *)rootViews
+                                    options:(GSCXScanOptions *)options {
+  GSCXCheckEvaluator *evaluator = [self gscx_activeEvaluator];
+  NSUInteger checkCount = evaluator.checks.count;
+  NSMutableArray<NSNumber *> *evaluatedCheckIndexes = [[NSMutableArray alloc] init];
+  NSMutableArray<NSString *> *throttledCheckNames = [[NSMutableArray alloc] init];
+  for (NSUInteger i = 0; i < checkCount; i++) {
+    NSString *checkName = [evaluator.checks[i] name];
+    if ([options.throttledCheckNames containsObject:checkName]) {
+      [throttledCheckNames addObject:checkName];
+    } else {
+      [evaluatedCheckIndexes addObject:@(i)];
+    }
+  }
+  if (options.ordersChecksByCost) {
+    GSCXCheckCostModel *costModel = self.checkCostModel;
+    [evaluatedCheckIndexes
+        sortWithOptions:NSSortStable
+        usingComparator:^NSComparisonResult(NSNumber *index1, NSNumber *index2) {
+          NSString *checkName1 = [evaluator.checks[[index1 unsignedIntegerValue]] name];
+          NSString *checkName2 = [evaluator.checks[[index2 unsignedIntegerValue]] name];
+          return [@([costModel costPerElementForCheckNamed:checkName1])
+              compare:@([costModel costPerElementForCheckNamed:checkName2])];
+        }];
+  }
+  NSUInteger maximumFailures =
+      options.maximumFailuresPerElement > 0 ? options.maximumFailuresPerElement : NSUIntegerMax;
+  NSMutableIndexSet *blockingCheckIndexes = [[NSMutableIndexSet alloc] init];
+  for (NSUInteger i = 0; i < checkCount; i++) {
+    if ([options.blockingCheckNames containsObject:[evaluator.checks[i] name]]) {
+      [blockingCheckIndexes addIndex:i];
+    }
+  }
+  NS_VALID_UNTIL_END_OF_SCOPE NSMutableData *checkDurationsData =
+      [NSMutableData dataWithLength:checkCount * sizeof(CFTimeInterval)];
+  CFTimeInterval *checkDurations = (CFTimeInterval *)checkDurationsData.mutableBytes;
+  NS_VALID_UNTIL_END_OF_SCOPE NSMutableData *checkEvaluationCountsData =
+      [NSMutableData dataWithLength:checkCount * sizeof(NSUInteger)];
+  NSUInteger *checkEvaluationCounts = (NSUInteger *)checkEvaluationCountsData.mutableBytes;
+  CFTimeInterval deadline =
+      self.watchdogTimeout > 0 ? CACurrentMediaTime() + self.watchdogTimeout : INFINITY;
+  GSCXScanCancellationToken *cancellationToken = options.cancellationToken;
+  NSMutableArray<GTXElementResultCollection *> *elementResults = [[NSMutableArray alloc] init];
+  NSMutableArray<NSError *> *elementErrors = [[NSMutableArray alloc] init];
+  NSUInteger checkedElementCount = 0;
+  BOOL isCancelled = NO;
+  BOOL isTimedOut = NO;
+  GTXAccessibilityTree *tree = [[GTXAccessibilityTree alloc] initWithRootElements:rootViews];
+  id<NSFastEnumeration> elements = tree;
+  NSArray *sampledElements;
+  if (options.elementSampler != nil) {
+    sampledElements = options.elementSampler([tree allObjects]);
+    elements = sampledElements;
+  }
+  NSMutableIndexSet *snapshotCheckIndexes = [[NSMutableIndexSet alloc] init];
+  if (options.evaluatesSnapshotChecksInParallel) {
+    for (NSNumber *checkIndex in evaluatedCheckIndexes) {
+      NSUInteger i = [checkIndex unsignedIntegerValue];
+      if ([evaluator.checks[i] conformsToProtocol:@protocol(GSCXSnapshotChecking)]) {
+        [snapshotCheckIndexes addIndex:i];
+      }
+    }
+  }
+  GSCXSnapshotEvaluation *snapshotEvaluation;
+  if (snapshotCheckIndexes.count > 0) {
+    // Excluded elements are removed up front, so every element of allElements is checked in order
+    // and checkedElementCount is the index of the current element in snapshotEvaluation.
+    NSMutableArray *allElements = [[NSMutableArray alloc] init];
+    for (id element in sampledElements ?: [tree allObjects]) {
+      if (![self.exclusionIndex isElementExcluded:element]) {
+        [allElements addObject:element];
+      }
+    }
+    elements = allElements;
+    snapshotEvaluation = [evaluator
+        evaluateSnapshotChecksAtIndexes:snapshotCheckIndexes
+                             onElements:allElements
+                             shouldStop:^BOOL {
+                               return cancellationToken.isCancelled ||
+                                      CACurrentMediaTime() >= deadline;
+                             }];
+    [snapshotCheckIndexes enumerateIndexesUsingBlock:^(NSUInteger i, BOOL *stop) {
+      checkDurations[i] += [snapshotEvaluation durationOfCheckAtIndex:i];
+      checkEvaluationCounts[i] += [snapshotEvaluation evaluationCountOfCheckAtIndex:i];
+    }];
+  }
+  for (id element in elements) {
+    isCancelled = cancellationToken.isCancelled;
+    isTimedOut = CACurrentMediaTime() >= deadline;
+    if (isCancelled || isTimedOut) {
+      break;
+    }
+    if ([self.exclusionIndex isElementExcluded:element]) {
+      continue;
+    }
+    [elementErrors removeAllObjects];
+    BOOL isSnapshotEvaluated = [snapshotEvaluation isElementEvaluatedAtIndex:checkedElementCount];
+    for (NSNumber *checkIndex in evaluatedCheckIndexes) {
+      NSUInteger i = [checkIndex unsignedIntegerValue];
+      NSError *error;
+      if (isSnapshotEvaluated && [snapshotCheckIndexes containsIndex:i]) {
+        if ([snapshotEvaluation elementAtIndex:checkedElementCount failedCheckAtIndex:i]) {
+          // Produces the same error as the serial path, and applies the excludeLists.
+          error = [evaluator errorForElement:element checkAtIndex:i];
+        }
+      } else {
+        CFTimeInterval start = CACurrentMediaTime();
+        error = [evaluator errorForElement:element checkAtIndex:i];
+        checkDurations[i] += CACurrentMediaTime() - start;
+        checkEvaluationCounts[i]++;
+      }
+      if (error == nil) {
+        continue;
+      }
+      [elementErrors addObject:error];
+      if (elementErrors.count >= maximumFailures || [blockingCheckIndexes containsIndex:i]) {
+        break;
+      }
+    }
+    if (elementErrors.count > 0) {
+      [elementResults addObject:[GSCXCheckEvaluator elementResultWithErrors:elementErrors]];
+    }
+    checkedElementCount++;
+  }
+  NSMutableDictionary<NSString *, NSNumber *> *measuredDurations =
+      [[NSMutableDictionary alloc] init];
+  NSMutableDictionary<NSString *, NSNumber *> *evaluationCounts =
+      [[NSMutableDictionary alloc] init];
+  for (NSNumber *checkIndex in evaluatedCheckIndexes) {
+    NSUInteger i = [checkIndex unsignedIntegerValue];
+    NSString *checkName = [evaluator.checks[i] name];
+    measuredDurations[checkName] = @(checkDurations[i]);
+    // Short-circuited checks are not evaluated on every element.
+    evaluationCounts[checkName] = @(checkEvaluationCounts[i]);
+  }
+  [self.checkCostModel recordCheckDurations:measuredDurations
+                           evaluationCounts:evaluationCounts
+                               elementCount:checkedElementCount];
+  GTXHierarchyResultCollection *result = [self gscx_resultWithElementResults:elementResults
+                                                                   rootViews:rootViews];
+  result.gscx_throttledCheckNames = throttledCheckNames;
+  if (!isCancelled && !isTimedOut) {
+    return result;
+  }
+  result.gscx_incomplete = YES;
+  NSString *slowestCheckName;
+  CFTimeInterval slowestCheckDuration = -1.0;
+  for (NSNumber *checkIndex in evaluatedCheckIndexes) {
+    NSUInteger i = [checkIndex unsignedIntegerValue];
+    if (checkDurations[i] > slowestCheckDuration) {
+      slowestCheckDuration = checkDurations[i];
+      slowestCheckName = [evaluator.checks[i] name];
+    }
+  }
+  GSCXScanInterruptionReason reason =
+      isCancelled ? GSCXScanInterruptionReasonCancelled : GSCXScanInterruptionReasonTimedOut;
+  GSCXAnalyticsEvent event =
+      isCancelled ? GSCXAnalyticsEventScanCancelled : GSCXAnalyticsEventScanTimedOut;
+  [GSCXAnalytics invokeAnalyticsEvent:event count:checkedElementCount];
+  if ([self.delegate respondsToSelector:@selector(scanner:
+                                            didInterruptScanWithReason:slowestCheckName:)]) {
+    [self.delegate scanner:self
+        didInterruptScanWithReason:reason
+                  slowestCheckName:slowestCheckName];
+  }
+  return result;
+}
+
+/**
+ * Removes the issues in @c baseline from the issues found by a scan, reports the remaining issues
+ * to analytics, and constructs the scan's result.
+ *
+ * @param errors The errors found by the scan.
+ * @param rootViews The root views that were scanned.
+ * @return The result of the scan.
+ */
+- (GTXHierarchyResultCollection *)gscx_resultWithErrors:(NSArray<NSError *> *)errors
+                                              rootViews:(NSArray<UIView *> *)rootViews {
+  if (self.baseline.count > 0) {
+    NSMutableArray<GTXElementResultCollection *> *elementResults =
+        [[NSMutableArray alloc] initWithCapacity:errors.count];
+    for (NSError *error in errors) {
+      [elementResults addObject:[[GTXElementResultCollection alloc] initWithError:error]];
+    }
+    return [self gscx_resultWithElementResults:elementResults rootViews:rootViews];
+  }
+  [self gscx_reportIssueCount:errors.count];
+  return [self.screenshotCapturePolicy resultWithErrors:errors rootViews:rootViews];
+}
+
+/**
+ * Removes the issues in @c baseline from the issues found by a scan, reports the remaining issues
+ * to analytics, and constructs the scan's result.
+ *
+ * @param elementResults The issues found by the scan.
+ * @param rootViews The root views that were scanned.
+ * @return The result of the scan.
+ */
+- (GTXHierarchyResultCollection *)
+    gscx_resultWithElementResults:(NSArray<GTXElementResultCollection *> *)elementResults
+                        rootViews:(NSArray<UIView *> *)rootViews {
+  if (self.baseline.count > 0) {
+    elementResults = [self.baseline elementResultsByRemovingBaselineIssues:elementResults];
+  }
+  // Baseline issues are known and not reported, so they are not counted either.
+  [self gscx_reportIssueCount:elementResults.count];
+  return [self.screenshotCapturePolicy resultWithElementResults:elementResults
+                                                      rootViews:rootViews];
+}
+
+/**
+ * Reports the outcome of a scan to analytics.
+ *
+ * @param issueCount The number of elements with issues found by the scan.
+ */
+- (void)gscx_reportIssueCount:(NSUInteger)issueCount {
+  if (issueCount) {
+    [GSCXAnalytics invokeAnalyticsEvent:GSCXAnalyticsEventErrorsFound count:issueCount];
+  } else {
+    [GSCXAnalytics invokeAnalyticsEvent:GSCXAnalyticsEventScanPerformed count:1];
+  }
+}
+
+/**
+ * Sets @c lastScanResult to @c result and notifies the delegate that the scan finished.
+ *
+ * @param result The result of the scan.
+ * @return @c result.
+ */
+- (GTXHierarchyResultCollection *)gscx_publishResult:(GTXHierarchyResultCollection *)result {
+  _lastScanResult = result;
+  if ([self.delegate respondsToSelector:@selector(scanner:didFinishScanWithResult:)]) {
+    [self.delegate scanner:self didFinishScanWithResult:result];
+  }
+  return result;
+}
+
+/**
+ * @param name The name of a profile.
+ * @return The index of the profile named @c name in @c mutableProfiles, or @c NSNotFound if there
+ *  is no such profile.
+ */
+- (NSUInteger)gscx_indexOfProfileNamed:(NSString *)name {
+  return [self.mutableProfiles
+      indexOfObjectPassingTest:^BOOL(GSCXCheckProfile *profile, NSUInteger idx, BOOL *stop) {
+        return [profile.name isEqualToString:name];
+      }];
+}
+
+/**
+ * Points @c _toolkit at a toolkit with the current checks and excludeLists. Reuses a cached
+ * toolkit if this configuration was used before. Otherwise, if the configuration only differs by
+ * one addition and no sliced scan is in progress, the addition is registered with the current
+ * toolkit in place. Otherwise, a new toolkit is built. Does nothing during a batch update except
+ * mark the toolkit as needing an update.
+ *
+ * @param check The check that was just registered, if it was the only change. Optional.
+ * @param excludeList The excludeList that was just registered, if it was the only change.
+ *  Optional.
+ */
+- (void)gscx_updateToolkitWithAddedCheck:(nullable id<GTXChecking>)check
+                        addedExcludeList:(nullable id<GTXExcludeListing>)excludeList {
+  if (self.batchUpdateDepth > 0) {
+    self.needsToolkitUpdate = YES;
+    return;
+  }
+  NSSet *configurationKey = [self gscx_configurationKey];
+  if ([configurationKey isEqualToSet:self.toolkitConfigurationKey]) {
+    return;
+  }
+  GTXToolKit *toolkit = [self.toolkitCache objectForKey:configurationKey];
+  // A sliced scan in progress keeps using the current toolkit, so it must not be mutated.
+  BOOL canMutateToolkit = (check != nil || excludeList != nil) && self.slicedScan == nil;
+  if (toolkit == nil && canMutateToolkit) {
+    // The current toolkit no longer represents its old configuration once it is mutated.
+    [self.toolkitCache removeObjectForKey:self.toolkitConfigurationKey];
+    toolkit = _toolkit;
+    if (check != nil) {
+      [toolkit registerCheck:check];
+    } else {
+      [toolkit registerExcludeList:excludeList];
+    }
+    [self.toolkitCache setObject:toolkit forKey:configurationKey];
+  } else if (toolkit == nil) {
+    toolkit = [self gscx_newToolkit];
+    [self.toolkitCache setObject:toolkit forKey:configurationKey];
+  }
+  _toolkit = toolkit;
+  self.toolkitConfigurationKey = configurationKey;
+  self.registeredChecksEvaluator = nil;
+}
+
+/**
+ * @return A key identifying the current checks and excludeLists. Toolkits retain their checks and
+ *  excludeLists, so objects in a cached configuration are never deallocated and replaced by
+ *  different objects that compare equal.
  */
-- (void)gscx_reinitializeToolkit {
+- (NSSet *)gscx_configurationKey {
+  NSMutableSet *configurationKey = [NSMutableSet setWithArray:[self.checks allValues]];
+  [configurationKey unionSet:self.excludeLists];
+  return configurationKey;
+}
+
+/**
+ * Constructs a new @c GTXToolKit instance with the current checks and excludeLists.
+ *
+ * @return The new toolkit.
+ */
+- (GTXToolKit *)gscx_newToolkit {
   GTXToolKit *toolkit = [GTXToolKit toolkitWithNoChecks];
+  [toolkit registerExcludeList:self.exclusionIndex];
   for (NSString *name in self.checks) {
     [toolkit registerCheck:self.checks[name]];
   }
   for (id<GTXExcludeListing> excludeList in self.excludeLists) {
     [toolkit registerExcludeList:excludeList];
   }
-  _toolkit = toolkit;
+  return toolkit;
 }
 
 @end
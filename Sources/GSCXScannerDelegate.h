@@ -21,6 +21,21 @@ NS_ASSUME_NONNULL_BEGIN
 
 @class GSCXScanner;
 
+/**
+ * The reasons a scan can stop before checking every element.
+ */
+typedef NS_ENUM(NSInteger, GSCXScanInterruptionReason) {
+  /**
+   * The scan's cancellation token was cancelled.
+   */
+  GSCXScanInterruptionReasonCancelled,
+
+  /**
+   * The scan exceeded the scanner's watchdog timeout.
+   */
+  GSCXScanInterruptionReasonTimedOut,
+};
+
 /**
  * Allows objects to hook into a scan's lifecycle and perform custom functionality.
  */
@@ -44,6 +59,19 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)scanner:(GSCXScanner *)scanner
     didFinishScanWithResult:(GTXHierarchyResultCollection *)scanResult;
 
+/**
+ * Called when a scan stops before checking every element, before
+ * @c scanner:didFinishScanWithResult: is called with the partial result.
+ *
+ * @param scanner The scanner object performing the scan.
+ * @param reason Why the scan stopped.
+ * @param checkName The name of the check that spent the most time checking elements during the
+ *  scan, or @c nil if no check ran.
+ */
+- (void)scanner:(GSCXScanner *)scanner
+    didInterruptScanWithReason:(GSCXScanInterruptionReason)reason
+              slowestCheckName:(nullable NSString *)checkName;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -24,11 +24,28 @@ NS_ASSUME_NONNULL_BEGIN
 @interface GSCXScannerIssueExpandableTableViewCell : UITableViewCell
 
 /**
- * Displays suggestions in a column. The owner is responsible for adding and removing subviews from
- * @c suggestionStack.
+ * Displays suggestions in a column. Use @c setLabelTexts: to populate @c suggestionStack, so that
+ * labels are reused across configurations of this cell.
  */
 @property(strong, nonatomic) UIStackView *suggestionStack;
 
+/**
+ * Displays one label for each string in @c texts in @c suggestionStack, in order. Labels from
+ * previous configurations of this cell are reused. New labels are only created if this cell has
+ * never displayed as many strings before. Unused labels are hidden.
+ *
+ * @param texts The text of each label to display.
+ */
+- (void)setLabelTexts:(NSArray<NSString *> *)texts;
+
+/**
+ * Sets the text color of all labels in @c suggestionStack, including hidden labels, without
+ * changing their text or layout.
+ *
+ * @param textColor The new text color.
+ */
+- (void)setLabelTextColor:(UIColor *)textColor;
+
 @end
 
 NS_ASSUME_NONNULL_END
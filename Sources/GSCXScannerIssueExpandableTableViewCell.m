@@ -39,6 +39,17 @@ static const CGFloat kGSCXScannerIssueExpandableTableViewCellVerticalSpacing = 8
  */
 @property(assign, nonatomic, getter=hasAddedConstraints) BOOL addedConstraints;
 
+/**
+ * All labels ever added to @c suggestionStack, in order. Labels beyond the number of texts
+ * currently displayed are hidden, not removed.
+ */
+@property(strong, nonatomic) NSMutableArray<UILabel *> *labels;
+
+/**
+ * The text color of labels in @c suggestionStack. Defaults to @c whiteColor.
+ */
+@property(strong, nonatomic) UIColor *labelTextColor;
+
 @end
 
 @implementation GSCXScannerIssueExpandableTableViewCell
@@ -51,10 +62,39 @@ static const CGFloat kGSCXScannerIssueExpandableTableViewCellVerticalSpacing = 8
     _suggestionStack.axis = UILayoutConstraintAxisVertical;
     _suggestionStack.translatesAutoresizingMaskIntoConstraints = NO;
     _suggestionStack.spacing = kGSCXScannerIssueExpandableTableViewCellVerticalSpacing;
+    _labels = [[NSMutableArray alloc] init];
+    _labelTextColor = [UIColor whiteColor];
   }
   return self;
 }
 
+- (void)setLabelTexts:(NSArray<NSString *> *)texts {
+  while (self.labels.count < texts.count) {
+    UILabel *label = [[UILabel alloc] init];
+    label.numberOfLines = 0;
+    label.font = [UIFont preferredFontForTextStyle:UIFontTextStyleSubheadline];
+    label.adjustsFontForContentSizeCategory = YES;
+    label.textColor = self.labelTextColor;
+    [self.labels addObject:label];
+    [self.suggestionStack addArrangedSubview:label];
+  }
+  for (NSUInteger i = 0; i < self.labels.count; i++) {
+    UILabel *label = self.labels[i];
+    BOOL isUsed = i < texts.count;
+    label.text = isUsed ? texts[i] : nil;
+    // Hidden arranged subviews do not take up space in a stack view, so there is no need to remove
+    // them.
+    label.hidden = !isUsed;
+  }
+}
+
+- (void)setLabelTextColor:(UIColor *)textColor {
+  _labelTextColor = textColor;
+  for (UILabel *label in self.labels) {
+    label.textColor = textColor;
+  }
+}
+
 - (void)updateConstraints {
   [super updateConstraints];
   if (self.hasAddedConstraints) {
@@ -66,6 +66,23 @@ static NSString *const kGSCXScannerIssueExpandableTableViewDelegateIncorrectHead
  */
 @property(strong, nonatomic) UIColor *backgroundColor;
 
+/**
+ * The heights of cells that have been displayed, keyed by the row they represent. Rows are held
+ * weakly, so the heights of rows no longer in @c sections are discarded.
+ */
+@property(strong, nonatomic)
+    NSMapTable<GSCXScannerIssueTableViewRow *, NSNumber *> *rowHeights;
+
+/**
+ * The content size category @c rowHeights were measured in.
+ */
+@property(copy, nonatomic, nullable) UIContentSizeCategory rowHeightsContentSizeCategory;
+
+/**
+ * The width of the table view when @c rowHeights were measured.
+ */
+@property(assign, nonatomic) CGFloat rowHeightsTableViewWidth;
+
 @end
 
 @implementation GSCXScannerIssueExpandableTableViewDelegate
@@ -79,6 +96,7 @@ static NSString *const kGSCXScannerIssueExpandableTableViewDelegateIncorrectHead
     _selectionBlock = selectionBlock;
     _textColor = [UIColor whiteColor];
     _backgroundColor = [UIColor blackColor];
+    _rowHeights = [NSMapTable weakToStrongObjectsMapTable];
   }
   return self;
 }
@@ -99,13 +117,7 @@ static NSString *const kGSCXScannerIssueExpandableTableViewDelegateIncorrectHead
     GTX_ASSERT([cell isKindOfClass:[GSCXScannerIssueExpandableTableViewCell class]],
                kGSCXScannerIssueExpandableTableViewDelegateIncorrectCellClassError);
     cell.backgroundColor = self.backgroundColor;
-    for (UIView *subview in cell.suggestionStack.arrangedSubviews) {
-      if (![subview isKindOfClass:[UILabel class]]) {
-        continue;
-      }
-      UILabel *label = (UILabel *)subview;
-      label.textColor = self.textColor;
-    }
+    [cell setLabelTextColor:self.textColor];
   }
   for (NSInteger i = 0; i < [self numberOfSectionsInTableView:tableView]; i++) {
     GSCXScannerIssueExpandableTableViewHeader *header =
@@ -137,12 +149,22 @@ static NSString *const kGSCXScannerIssueExpandableTableViewDelegateIncorrectHead
   cell.accessibilityIdentifier = [GSCXScannerIssueExpandableTableViewDelegate
       gscx_accessibilityIdentifierForRowAtIndexPath:indexPath];
   cell.backgroundColor = self.backgroundColor;
-  GSCXScannerIssueTableViewRow *row = self.sections[indexPath.section].rows[indexPath.row];
-  [self gscx_addSuggestionsToCell:cell fromRow:row];
+  [cell setLabelTextColor:self.textColor];
+  GSCXScannerIssueTableViewRow *row =
+      [self.sections[indexPath.section] rowAtIndex:(NSUInteger)indexPath.row];
+  [cell setLabelTexts:[GSCXScannerIssueExpandableTableViewDelegate gscx_labelTextsForRow:row]];
   [cell setNeedsUpdateConstraints];
   return cell;
 }
 
+- (CGFloat)tableView:(UITableView *)tableView heightForRowAtIndexPath:(NSIndexPath *)indexPath {
+  [self gscx_invalidateRowHeightsIfNeededForTableView:tableView];
+  GSCXScannerIssueTableViewRow *row =
+      [self.sections[indexPath.section] rowAtIndex:(NSUInteger)indexPath.row];
+  NSNumber *cachedHeight = [self.rowHeights objectForKey:row];
+  return cachedHeight == nil ? UITableViewAutomaticDimension : [cachedHeight doubleValue];
+}
+
 - (CGFloat)tableView:(UITableView *)tableView heightForHeaderInSection:(NSInteger)section {
   return kGSCXMinimumTouchTargetSize;
 }
@@ -180,10 +202,19 @@ static NSString *const kGSCXScannerIssueExpandableTableViewDelegateIncorrectHead
 }
 
 - (void)tableView:(UITableView *)tableView didSelectRowAtIndexPath:(NSIndexPath *)indexPath {
-  GSCXScannerIssueTableViewRow *row = self.sections[indexPath.section].rows[indexPath.row];
+  GSCXScannerIssueTableViewRow *row =
+      [self.sections[indexPath.section] rowAtIndex:(NSUInteger)indexPath.row];
   self.selectionBlock(row.originalResult, row.originalElementIndex);
 }
 
+- (void)tableView:(UITableView *)tableView
+      willDisplayCell:(UITableViewCell *)cell
+    forRowAtIndexPath:(NSIndexPath *)indexPath {
+  GSCXScannerIssueTableViewRow *row =
+      [self.sections[indexPath.section] rowAtIndex:(NSUInteger)indexPath.row];
+  [self.rowHeights setObject:@(CGRectGetHeight(cell.bounds)) forKey:row];
+}
+
 - (void)tableView:(UITableView *)tableView
     willDisplayHeaderView:(UIView *)view
                forSection:(NSInteger)section {
@@ -198,41 +229,57 @@ static NSString *const kGSCXScannerIssueExpandableTableViewDelegateIncorrectHead
 #pragma mark - Private
 
 /**
- * Adds a label to @c cell.suggestionStack with @c text if @c text is not nil.
+ * Removes all cached row heights if the content size category or width of @c tableView changed
+ * since the heights were cached.
  *
- * @param text The text to add to @c cell, if it exists.
- * @param cell The cell to add the text to.
+ * @param tableView The table view displaying the rows.
  */
-- (void)gscx_addLabelWithTextIfNonnull:(nullable NSString *)text
-                                toCell:(GSCXScannerIssueExpandableTableViewCell *)cell {
-  if (text == nil) {
+- (void)gscx_invalidateRowHeightsIfNeededForTableView:(UITableView *)tableView {
+  UIContentSizeCategory category = tableView.traitCollection.preferredContentSizeCategory;
+  CGFloat width = CGRectGetWidth(tableView.bounds);
+  if ([category isEqualToString:self.rowHeightsContentSizeCategory] &&
+      width == self.rowHeightsTableViewWidth) {
     return;
   }
-  UILabel *label = [[UILabel alloc] init];
-  label.text = text;
-  label.numberOfLines = 0;
-  label.font = [UIFont preferredFontForTextStyle:UIFontTextStyleSubheadline];
-  label.textColor = self.textColor;
-  [cell.suggestionStack addArrangedSubview:label];
+  [self.rowHeights removeAllObjects];
+  self.rowHeightsContentSizeCategory = category;
+  self.rowHeightsTableViewWidth = width;
 }
 
 /**
- * Adds text describing each suggestion in @c row to @c cell. Removes previous suggestions, if any.
+ * Returns the text of each label displayed in a cell representing @c row.
  *
- * @param cell The cell to add labels to.
- * @param row The row representing @c cell.
+ * @param row The row represented by the cell.
+ * @return The row's title, subtitle, and the title and contents of each suggestion, in that order.
+ *  Missing values are skipped.
  */
-- (void)gscx_addSuggestionsToCell:(GSCXScannerIssueExpandableTableViewCell *)cell
-                          fromRow:(GSCXScannerIssueTableViewRow *)row {
-  for (UIView *subview in cell.suggestionStack.subviews) {
-    [subview removeFromSuperview];
-  }
-  [self gscx_addLabelWithTextIfNonnull:row.rowTitle toCell:cell];
-  [self gscx_addLabelWithTextIfNonnull:row.rowSubtitle toCell:cell];
++ (NSArray<NSString *> *)gscx_labelTextsForRow:(GSCXScannerIssueTableViewRow *)row {
+  NSMutableArray<NSString *> *texts =
+      [[NSMutableArray alloc] initWithCapacity:2 + 2 * [row numberOfSuggestions]];
+  [GSCXScannerIssueExpandableTableViewDelegate gscx_addTextIfNonnull:row.rowTitle toArray:texts];
+  [GSCXScannerIssueExpandableTableViewDelegate gscx_addTextIfNonnull:row.rowSubtitle
+                                                             toArray:texts];
   for (NSUInteger i = 0; i < [row.suggestionTitles count]; i++) {
-    [self gscx_addLabelWithTextIfNonnull:row.suggestionTitles[i] toCell:cell];
-    [self gscx_addLabelWithTextIfNonnull:row.suggestionContents[i] toCell:cell];
+    [GSCXScannerIssueExpandableTableViewDelegate gscx_addTextIfNonnull:row.suggestionTitles[i]
+                                                               toArray:texts];
+    [GSCXScannerIssueExpandableTableViewDelegate gscx_addTextIfNonnull:row.suggestionContents[i]
+                                                               toArray:texts];
+  }
+  return texts;
+}
+
+/**
+ * Adds @c text to @c texts if @c text is not nil.
+ *
+ * @param text The text to add, if it exists.
+ * @param texts The array to add @c text to.
+ */
++ (void)gscx_addTextIfNonnull:(nullable NSString *)text
+                      toArray:(NSMutableArray<NSString *> *)texts {
+  if (text == nil) {
+    return;
   }
+  [texts addObject:text];
 }
 
 /**
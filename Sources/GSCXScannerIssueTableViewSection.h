@@ -20,6 +20,15 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+/**
+ * Creates the row at @c rowIndex in a lazily populated @c GSCXScannerIssueTableViewSection.
+ *
+ * @param rowIndex The index of the row to create.
+ * @return The row at @c rowIndex.
+ */
+typedef GSCXScannerIssueTableViewRow *_Nonnull (^GSCXScannerIssueTableViewRowProvider)(
+    NSUInteger rowIndex);
+
 /**
  * A section in the list view. Encapsulates a list of related issues.
  */
@@ -36,7 +45,8 @@ NS_ASSUME_NONNULL_BEGIN
 @property(copy, nonatomic, nullable, readonly) NSString *subtitle;
 
 /**
- * The rows in this section. When expanded, these rows are displayed beneath this section.
+ * The rows in this section. When expanded, these rows are displayed beneath this section. For
+ * lazily populated sections, accessing this property creates every row. Prefer @c rowAtIndex:.
  */
 @property(copy, nonatomic, readonly) NSArray<GSCXScannerIssueTableViewRow *> *rows;
 
@@ -60,6 +70,33 @@ NS_ASSUME_NONNULL_BEGIN
                      subtitle:(nullable NSString *)subtitle
                          rows:(NSArray<GSCXScannerIssueTableViewRow *> *)rows;
 
+/**
+ * Initializes a lazily populated @c GSCXScannerIssueTableViewSection instance. Rows are not created
+ * until they are requested, so the cost of constructing a section does not depend on the number of
+ * rows it contains. Each row is created at most once.
+ *
+ * @param title The title of this section.
+ * @param subtitle Optional. The subtitle of this section.
+ * @param numberOfRows The number of rows in this section.
+ * @param numberOfSuggestions The total number of suggestions across all rows.
+ * @param rowProvider Invoked on the main thread to create the row at a given index.
+ * @return An initialized @c GSCXScannerIssueTableViewSection instance.
+ */
+- (instancetype)initWithTitle:(NSString *)title
+                     subtitle:(nullable NSString *)subtitle
+                 numberOfRows:(NSUInteger)numberOfRows
+          numberOfSuggestions:(NSUInteger)numberOfSuggestions
+                  rowProvider:(GSCXScannerIssueTableViewRowProvider)rowProvider;
+
+/**
+ * Returns the row at @c index, creating it if this section is lazily populated and the row has not
+ * been created yet. Fails with an assertion if @c index is out of bounds.
+ *
+ * @param index The index of the row.
+ * @return The row at @c index.
+ */
+- (GSCXScannerIssueTableViewRow *)rowAtIndex:(NSUInteger)index;
+
 /**
  * @return The number of rows in this section. A single row may represent multiple suggestions.
  */
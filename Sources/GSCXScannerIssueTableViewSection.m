@@ -18,8 +18,36 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+@interface GSCXScannerIssueTableViewSection ()
+
+/**
+ * Creates rows on demand. @c nil if this section was initialized with all its rows.
+ */
+@property(copy, nonatomic, nullable) GSCXScannerIssueTableViewRowProvider rowProvider;
+
+/**
+ * Rows created by @c rowProvider so far, keyed by row index. @c nil if this section was
+ * initialized with all its rows.
+ */
+@property(strong, nonatomic, nullable)
+    NSMutableDictionary<NSNumber *, GSCXScannerIssueTableViewRow *> *createdRows;
+
+/**
+ * The number of rows in a lazily populated section.
+ */
+@property(assign, nonatomic) NSUInteger lazyNumberOfRows;
+
+/**
+ * The total number of suggestions in a lazily populated section.
+ */
+@property(assign, nonatomic) NSUInteger lazyNumberOfSuggestions;
+
+@end
+
 @implementation GSCXScannerIssueTableViewSection
 
+@synthesize rows = _rows;
+
 - (instancetype)initWithTitle:(NSString *)title
                      subtitle:(nullable NSString *)subtitle
                          rows:(NSArray<GSCXScannerIssueTableViewRow *> *)rows {
@@ -32,13 +60,62 @@ NS_ASSUME_NONNULL_BEGIN
   return self;
 }
 
+- (instancetype)initWithTitle:(NSString *)title
+                     subtitle:(nullable NSString *)subtitle
+                 numberOfRows:(NSUInteger)numberOfRows
+          numberOfSuggestions:(NSUInteger)numberOfSuggestions
+                  rowProvider:(GSCXScannerIssueTableViewRowProvider)rowProvider {
+  self = [super init];
+  if (self) {
+    _title = [title copy];
+    _subtitle = [subtitle copy];
+    _rowProvider = [rowProvider copy];
+    _createdRows = [[NSMutableDictionary alloc] init];
+    _lazyNumberOfRows = numberOfRows;
+    _lazyNumberOfSuggestions = numberOfSuggestions;
+  }
+  return self;
+}
+
+- (NSArray<GSCXScannerIssueTableViewRow *> *)rows {
+  if (self.rowProvider == nil) {
+    return _rows;
+  }
+  NSMutableArray<GSCXScannerIssueTableViewRow *> *rows =
+      [[NSMutableArray alloc] initWithCapacity:self.lazyNumberOfRows];
+  for (NSUInteger i = 0; i < self.lazyNumberOfRows; i++) {
+    [rows addObject:[self rowAtIndex:i]];
+  }
+  return rows;
+}
+
+- (GSCXScannerIssueTableViewRow *)rowAtIndex:(NSUInteger)index {
+  GTX_ASSERT(index < [self numberOfRows], @"Row index %lu is out of bounds.",
+             (unsigned long)index);
+  if (self.rowProvider == nil) {
+    return _rows[index];
+  }
+  GSCXScannerIssueTableViewRow *row = self.createdRows[@(index)];
+  if (row == nil) {
+    row = self.rowProvider(index);
+    self.createdRows[@(index)] = row;
+  }
+  return row;
+}
+
 - (NSUInteger)numberOfRows {
-  return self.rows.count;
+  if (self.rowProvider != nil) {
+    return self.lazyNumberOfRows;
+  }
+  return _rows.count;
 }
 
 - (NSUInteger)numberOfSuggestions {
+  if (self.rowProvider != nil) {
+    return self.lazyNumberOfSuggestions;
+  }
   NSUInteger count = 0;
-  for (GSCXScannerIssueTableViewRow *row in self.rows) {
+  for (GSCXScannerIssueTableViewRow *row in _rows) {
     count += [row numberOfSuggestions];
   }
   return count;
@@ -60,6 +60,45 @@ FOUNDATION_EXTERN NSString *const kGSCXScannerOverlayDismissButtonText;
  */
 FOUNDATION_EXTERN NSString *const kGSCXNoIssuesDismissButtonText;
 
+/**
+ * The title of the button that presents the results of the last journaled continuous scan.
+ */
+FOUNDATION_EXTERN NSString *const kGSCXOpenLastSessionTitle;
+
+/**
+ * The accessibility identifier of the button that presents the results of the last journaled
+ * continuous scan.
+ */
+FOUNDATION_EXTERN NSString *const kGSCXOpenLastSessionAccessibilityIdentifier;
+
+/**
+ * The title of the button that writes a baseline containing the issues of the last continuous
+ * scan.
+ */
+FOUNDATION_EXTERN NSString *const kGSCXSaveBaselineTitle;
+
+/**
+ * The accessibility identifier of the button that writes a baseline containing the issues of the
+ * last continuous scan.
+ */
+FOUNDATION_EXTERN NSString *const kGSCXSaveBaselineAccessibilityIdentifier;
+
+/**
+ * The title of the button that compares the issues of the last two journaled continuous scans.
+ */
+FOUNDATION_EXTERN NSString *const kGSCXCompareSessionsTitle;
+
+/**
+ * The accessibility identifier of the button that compares the issues of the last two journaled
+ * continuous scans.
+ */
+FOUNDATION_EXTERN NSString *const kGSCXCompareSessionsAccessibilityIdentifier;
+
+/**
+ * The accessibility identifier of the button that switches the scanner to its next check profile.
+ */
+FOUNDATION_EXTERN NSString *const kGSCXCheckProfileAccessibilityIdentifier;
+
 /**
  * The corner radius of the rounded corners of the settings button.
  */
@@ -103,6 +142,12 @@ FOUNDATION_EXTERN const CGFloat kGSCXSettingsCornerRadius;
  */
 @property(strong, nonatomic) id<GSCXSharingDelegate> sharingDelegate;
 
+/**
+ * @c YES if reports of continuous scans only contain the first occurrence of each unique issue.
+ * Defaults to @c NO.
+ */
+@property(assign, nonatomic) BOOL sharesDeduplicatedIssues;
+
 - (instancetype)initWithNibName:(nullable NSString *)nibName
                          bundle:(nullable NSBundle *)bundle NS_UNAVAILABLE;
 
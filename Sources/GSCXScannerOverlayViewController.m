@@ -16,10 +16,14 @@
 
 #import "GSCXScannerOverlayViewController.h"
 
+#import <QuartzCore/QuartzCore.h>
 #import <WebKit/WebKit.h>
 
+#import "GSCXContinuousScannerListTabBarUtils.h"
+#import "GSCXContinuousScannerListTabBarViewController.h"
 #import "GSCXContinuousScannerResultViewController.h"
 #import "GSCXContinuousScannerScreenshotViewController.h"
+#import "GSCXMappedSession.h"
 #import "GSCXMasterScheduler.h"
 #import "GSCXOverlayViewArranger.h"
 #import "GSCXReport.h"
@@ -30,6 +34,8 @@
 #import "GSCXScannerSettingsItemConfiguring.h"
 #import "GSCXScannerSettingsTableViewCell.h"
 #import "GSCXScannerSettingsViewController.h"
+#import "GSCXSessionDiff.h"
+#import "GSCXSessionJournal.h"
 #import "GSCXTouchActivitySource.h"
 #import "UIView+GSCXAppearance.h"
 #import "UIViewController+GSCXAppearance.h"
@@ -78,6 +84,24 @@ static NSString *const kGSCXNoScreenshotAlertTitle = @"No Screenshot";
 static NSString *const kGSCXNoScreenshotAlertMessage =
     @"Accessibility issues were found, but no screenshot could be generated.";
 
+/**
+ * The title of the alert shown when fewer than two continuous scan sessions are available to
+ * compare.
+ */
+static NSString *const kGSCXNoSessionsToCompareAlertTitle = @"Nothing to Compare";
+
+/**
+ * The message of the alert shown when fewer than two continuous scan sessions are available to
+ * compare.
+ */
+static NSString *const kGSCXNoSessionsToCompareAlertMessage =
+    @"At least two journaled continuous scans are required to compare sessions.";
+
+/**
+ * The title of the alert shown when a continuous scan session to compare cannot be read.
+ */
+static NSString *const kGSCXUnreadableSessionAlertTitle = @"Cannot Read Session";
+
 /**
  * The title of the alert shown when accessibility is not enabled.
  */
@@ -99,6 +123,55 @@ static NSString *const kGSCXAccessibilityNotEnabledAlertMessage =
 
 NSString *const kGSCXNoIssuesDismissButtonText = @"Ok";
 
+NSString *const kGSCXOpenLastSessionTitle = @"Open Last Continuous Scan";
+
+NSString *const kGSCXOpenLastSessionAccessibilityIdentifier =
+    @"kGSCXOpenLastSessionAccessibilityIdentifier";
+
+NSString *const kGSCXSaveBaselineTitle = @"Save Baseline From Last Continuous Scan";
+
+NSString *const kGSCXSaveBaselineAccessibilityIdentifier =
+    @"kGSCXSaveBaselineAccessibilityIdentifier";
+
+NSString *const kGSCXCompareSessionsTitle = @"Compare Last Two Continuous Scans";
+
+NSString *const kGSCXCompareSessionsAccessibilityIdentifier =
+    @"kGSCXCompareSessionsAccessibilityIdentifier";
+
+NSString *const kGSCXCheckProfileAccessibilityIdentifier =
+    @"kGSCXCheckProfileAccessibilityIdentifier";
+
+/**
+ * The format of the title of the button that switches the scanner to its next check profile. The
+ * argument is the name of the active profile.
+ */
+static NSString *const kGSCXCheckProfileTitleFormat = @"Check Profile: %@";
+
+/**
+ * The name displayed for the scanner's registered checks when no check profile is active.
+ */
+static NSString *const kGSCXRegisteredChecksProfileName = @"Registered Checks";
+
+/**
+ * The title of the tab listing issues only found in the later of two compared sessions.
+ */
+static NSString *const kGSCXSessionDiffAddedTabBarItemTitle = @"Added";
+
+/**
+ * The title of the tab listing issues only found in the earlier of two compared sessions.
+ */
+static NSString *const kGSCXSessionDiffRemovedTabBarItemTitle = @"Removed";
+
+/**
+ * The title of the tab listing issues found in both compared sessions.
+ */
+static NSString *const kGSCXSessionDiffUnchangedTabBarItemTitle = @"Unchanged";
+
+/**
+ * The title of the page comparing two sessions.
+ */
+static NSString *const kGSCXSessionDiffPageTitle = @"Session Comparison";
+
 const CGFloat kGSCXSettingsCornerRadius = 4.0;
 
 /**
@@ -143,6 +216,24 @@ static NSString *const kGSCXSettingsButtonTitleContinuousScanningInactive = @"Sc
 @property(strong, nonatomic)
     NSMutableArray<GSCXScannerSettingsViewController *> *settingsControllers;
 
+/**
+ * The session comparison currently presented, if any.
+ */
+@property(strong, nonatomic, nullable) GSCXSessionDiff *presentedSessionDiff;
+
+/**
+ * Presents @c presentedSessionDiff, with one tab per kind of change in the order of
+ * @c GSCXSessionDiffChange.
+ */
+@property(weak, nonatomic, nullable) UITabBarController *sessionDiffController;
+
+/**
+ * The number of sessions journaled in @c continuousScanner.sessionJournalDirectoryURL, counted on a
+ * background queue so the settings page does not list the directory on the main thread. Updated
+ * when @c continuousScanner is set and whenever continuous scanning stops.
+ */
+@property(assign, nonatomic) NSUInteger journaledSessionCount;
+
 /**
  * Presents an alert telling users that zero accessibility issues were found in the last scan.
  */
@@ -234,6 +325,11 @@ static NSString *const kGSCXSettingsButtonTitleContinuousScanningInactive = @"Sc
       self.settingsButtonArranger.rotateAccessibilityActions;
 }
 
+- (void)setContinuousScanner:(nullable GSCXContinuousScanner *)continuousScanner {
+  _continuousScanner = continuousScanner;
+  [self gscx_updateJournaledSessionCount];
+}
+
 - (void)viewDidAppear:(BOOL)animated {
   [super viewDidAppear:animated];
 
@@ -285,6 +381,13 @@ static NSString *const kGSCXSettingsButtonTitleContinuousScanningInactive = @"Sc
                                         target:self
                                         action:@selector(gscx_performScanButtonPressed:)
                        accessibilityIdentifier:kGSCXPerformScanAccessibilityIdentifier]];
+  if (self.scanner.profiles.count > 0) {
+    [items addObject:[GSCXScannerSettingsItem
+                             buttonItemWithTitle:[self gscx_checkProfileTitle]
+                                          target:self
+                                          action:@selector(gscx_selectNextCheckProfile:)
+                         accessibilityIdentifier:kGSCXCheckProfileAccessibilityIdentifier]];
+  }
   // Allowing continuous scans while in the continuous scans results page causes a poor user
   // experience. Only allow manual scanning while in results pages.
   if ([self.resultsWindowCoordinator presentedWindowCount] == 0) {
@@ -295,6 +398,28 @@ static NSString *const kGSCXSettingsButtonTitleContinuousScanningInactive = @"Sc
                                  target:self
                                  action:@selector(gscx_startContinuousScanningFromSettingsPage)
                 accessibilityIdentifier:kGSCXSettingsContinuousScanButtonAccessibilityIdentifier]];
+    NSUInteger sessionCount = self.journaledSessionCount;
+    if (sessionCount > 0) {
+      [items addObject:[GSCXScannerSettingsItem
+                               buttonItemWithTitle:kGSCXOpenLastSessionTitle
+                                            target:self
+                                            action:@selector(gscx_openLastSessionFromSettingsPage)
+                           accessibilityIdentifier:kGSCXOpenLastSessionAccessibilityIdentifier]];
+    }
+    if (sessionCount > 1) {
+      [items addObject:[GSCXScannerSettingsItem
+                               buttonItemWithTitle:kGSCXCompareSessionsTitle
+                                            target:self
+                                            action:@selector(gscx_compareSessionsFromSettingsPage)
+                           accessibilityIdentifier:kGSCXCompareSessionsAccessibilityIdentifier]];
+    }
+    if (self.continuousScanner.scanResults.count > 0) {
+      [items addObject:[GSCXScannerSettingsItem
+                               buttonItemWithTitle:kGSCXSaveBaselineTitle
+                                            target:self
+                                            action:@selector(gscx_saveBaselineFromSettingsPage)
+                           accessibilityIdentifier:kGSCXSaveBaselineAccessibilityIdentifier]];
+    }
   }
   GSCXScannerSettingsViewController *settingsController =
       [[GSCXScannerSettingsViewController alloc] initWithInitialFrame:self.settingsButtonBlur.frame
@@ -339,17 +464,7 @@ static NSString *const kGSCXSettingsButtonTitleContinuousScanningInactive = @"Sc
 }
 
 - (void)gscx_presentNoIssuesFoundAlert {
-  UIAlertController *alert =
-      [UIAlertController alertControllerWithTitle:kGSCXNoIssuesAlertTitle
-                                          message:kGSCXNoIssuesAlertMessage
-                                   preferredStyle:UIAlertControllerStyleAlert];
-  id<GSCXResultsWindowCoordinating> resultsWindowCoordinator = self.resultsWindowCoordinator;
-  [alert addAction:[UIAlertAction actionWithTitle:kGSCXNoIssuesDismissButtonText
-                                            style:UIAlertActionStyleCancel
-                                          handler:^(UIAlertAction *action) {
-                                            [resultsWindowCoordinator dismissResultsWindow];
-                                          }]];
-  [self presentViewController:alert animated:YES completion:nil];
+  [self gscx_presentAlertWithTitle:kGSCXNoIssuesAlertTitle message:kGSCXNoIssuesAlertMessage];
 }
 
 - (void)gscx_presentScreenshotControllerForScanResult:(GTXHierarchyResultCollection *)result {
@@ -399,6 +514,7 @@ static NSString *const kGSCXSettingsButtonTitleContinuousScanningInactive = @"Sc
 }
 
 - (void)gscx_dismissResultsWindow:(nullable id)sender {
+  self.presentedSessionDiff = nil;
   [self dismissViewControllerAnimated:YES completion:nil];
 }
 
@@ -436,14 +552,247 @@ static NSString *const kGSCXSettingsButtonTitleContinuousScanningInactive = @"Sc
   }];
 }
 
+/**
+ * Dismisses the settings page and presents the results of the most recent journaled continuous
+ * scan session, which may have been interrupted by the application terminating. The session is
+ * read on a background queue.
+ */
+- (void)gscx_openLastSessionFromSettingsPage {
+  NSURL *sessionDirectoryURL = self.continuousScanner.sessionJournalDirectoryURL;
+  __weak __typeof__(self) weakSelf = self;
+  [self gscx_dismissSettingsControllerWithCompletion:^{
+    CFTimeInterval requestTime = CACurrentMediaTime();
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^{
+      NSURL *sessionURL = [GSCXSessionJournal latestSessionInDirectory:sessionDirectoryURL];
+      // Results are decoded as they are displayed, so long sessions open without loading them.
+      NSArray<GTXHierarchyResultCollection *> *results =
+          sessionURL ? [[GSCXMappedSession sessionAtURL:sessionURL error:nil] results] : nil;
+      dispatch_async(dispatch_get_main_queue(), ^{
+        __typeof__(self) strongSelf = weakSelf;
+        if (strongSelf == nil) {
+          return;
+        }
+        if (results.count == 0) {
+          [strongSelf gscx_presentNoIssuesFoundAlert];
+          return;
+        }
+        [strongSelf gscx_presentContinuousScanResults:results requestedAtTime:requestTime];
+      });
+    });
+  }];
+}
+
+/**
+ * Dismisses the settings page and presents the issues added, removed and unchanged between the
+ * last two journaled continuous scan sessions, such as sessions of two builds of the application.
+ * The sessions are read and compared on a background queue.
+ */
+- (void)gscx_compareSessionsFromSettingsPage {
+  NSURL *sessionDirectoryURL = self.continuousScanner.sessionJournalDirectoryURL;
+  __weak __typeof__(self) weakSelf = self;
+  [self gscx_dismissSettingsControllerWithCompletion:^{
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^{
+      NSArray<NSURL *> *sessionURLs =
+          sessionDirectoryURL ? [GSCXSessionJournal sessionsInDirectory:sessionDirectoryURL] : nil;
+      if (sessionURLs.count < 2) {
+        dispatch_async(dispatch_get_main_queue(), ^{
+          [weakSelf gscx_presentAlertWithTitle:kGSCXNoSessionsToCompareAlertTitle
+                                       message:kGSCXNoSessionsToCompareAlertMessage];
+        });
+        return;
+      }
+      NSError *error;
+      GSCXMappedSession *baseSession =
+          [GSCXMappedSession sessionAtURL:sessionURLs[sessionURLs.count - 2] error:&error];
+      GSCXMappedSession *comparedSession = nil;
+      if (baseSession != nil) {
+        comparedSession = [GSCXMappedSession sessionAtURL:sessionURLs[sessionURLs.count - 1]
+                                                    error:&error];
+      }
+      if (comparedSession == nil) {
+        // Comparing against an empty session would report every issue as added or removed.
+        NSString *message = error.localizedDescription ?: @"";
+        dispatch_async(dispatch_get_main_queue(), ^{
+          [weakSelf gscx_presentAlertWithTitle:kGSCXUnreadableSessionAlertTitle message:message];
+        });
+        return;
+      }
+      GSCXSessionDiff *diff = [GSCXSessionDiff diffWithBaseResults:[baseSession results]
+                                                   comparedResults:[comparedSession results]];
+      NSArray<NSString *> *titles = @[
+        kGSCXSessionDiffAddedTabBarItemTitle, kGSCXSessionDiffRemovedTabBarItemTitle,
+        kGSCXSessionDiffUnchangedTabBarItemTitle
+      ];
+      NSMutableArray<GSCXContinuousScannerListTabBarItem *> *items =
+          [[NSMutableArray alloc] init];
+      for (GSCXSessionDiffChange change = GSCXSessionDiffChangeAdded;
+           change <= GSCXSessionDiffChangeUnchanged; change++) {
+        NSArray<GSCXUniqueIssue *> *issues = [diff issuesWithChange:change];
+        NSString *title = [NSString stringWithFormat:@"%@ (%lu)", titles[(NSUInteger)change],
+                                                     (unsigned long)issues.count];
+        NSArray<GTXHierarchyResultCollection *> *results =
+            [diff resultsContainingIssuesWithChange:change];
+        NSArray<GSCXScannerIssueTableViewSection *> *sections =
+            [GSCXContinuousScannerListTabBarUtils
+                sectionsWithUniqueIssuesByScreenIndex:[diff issuesByScreenIndexWithChange:change]
+                                            inResults:results];
+        [items addObject:[[GSCXContinuousScannerListTabBarItem alloc] initWithSections:sections
+                                                                                  title:title]];
+      }
+      dispatch_async(dispatch_get_main_queue(), ^{
+        [weakSelf gscx_presentSessionDiff:diff items:items];
+      });
+    });
+  }];
+}
+
+/**
+ * Presents a list of the issues in @c diff, grouped by screen, with one tab per kind of change.
+ *
+ * @param diff The comparison to present.
+ * @param items The tab bar items displaying the issues in @c diff.
+ */
+- (void)gscx_presentSessionDiff:(GSCXSessionDiff *)diff
+                          items:(NSArray<GSCXContinuousScannerListTabBarItem *> *)items {
+  GSCXContinuousScannerListTabBarViewController *tabBarController =
+      [[GSCXContinuousScannerListTabBarViewController alloc] initWithItems:items];
+  [self gscx_updateNavigationItemForResultsViewController:tabBarController];
+  tabBarController.navigationItem.title = kGSCXSessionDiffPageTitle;
+  tabBarController.navigationItem.rightBarButtonItem =
+      [[UIBarButtonItem alloc] initWithBarButtonSystemItem:UIBarButtonSystemItemAction
+                                                    target:self
+                                                    action:@selector(gscx_shareSessionDiff:)];
+  self.presentedSessionDiff = diff;
+  self.sessionDiffController = tabBarController;
+  UINavigationController *navigationController =
+      [[UINavigationController alloc] initWithRootViewController:tabBarController];
+  navigationController.modalPresentationStyle = UIModalPresentationFullScreen;
+  navigationController.navigationBar.translucent = NO;
+  [self presentViewController:navigationController animated:YES completion:nil];
+}
+
+/**
+ * Shares a report of the kind of change displayed in the selected tab of the session comparison.
+ *
+ * @param sender The object initiating the share.
+ */
+- (void)gscx_shareSessionDiff:(id)sender {
+  UITabBarController *tabBarController = self.sessionDiffController;
+  GSCXSessionDiff *diff = self.presentedSessionDiff;
+  if (tabBarController == nil || diff == nil) {
+    return;
+  }
+  GSCXSessionDiffChange change = (GSCXSessionDiffChange)tabBarController.selectedIndex;
+  GSCXReport *report = [[GSCXReport alloc] initWithSessionDiff:diff change:change];
+  [self.sharingDelegate shareReport:report inViewController:tabBarController completion:nil];
+}
+
+/**
+ * Dismisses the settings page and writes a baseline containing the current baseline and the issues
+ * of the last continuous scan to @c GSCXBaseline.defaultURL, then presents an alert describing
+ * where it was written.
+ */
+- (void)gscx_saveBaselineFromSettingsPage {
+  GSCXBaseline *baseline =
+      self.scanner.baseline ?: [[GSCXBaseline alloc] initWithFingerprints:[NSSet set]];
+  NSArray<GTXHierarchyResultCollection *> *results = self.continuousScanner.scanResults;
+  __weak __typeof__(self) weakSelf = self;
+  [self gscx_dismissSettingsControllerWithCompletion:^{
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^{
+      GSCXBaseline *newBaseline = [baseline baselineByAddingResults:results];
+      NSURL *url = [GSCXBaseline defaultURL];
+      NSError *error;
+      BOOL written = [newBaseline writeToURL:url error:&error];
+      NSString *message =
+          written ? [NSString stringWithFormat:@"Saved %lu issues to %@.",
+                                               (unsigned long)newBaseline.count, url.path]
+                  : error.localizedDescription;
+      dispatch_async(dispatch_get_main_queue(), ^{
+        [weakSelf gscx_presentAlertWithTitle:kGSCXSaveBaselineTitle message:message];
+      });
+    });
+  }];
+}
+
+/**
+ * Makes the scanner's next check profile active, wrapping around to its registered checks after
+ * the last profile, and updates the title of @c sender to match.
+ *
+ * @param sender The button that was pressed.
+ */
+- (void)gscx_selectNextCheckProfile:(UIButton *)sender {
+  NSArray<GSCXCheckProfile *> *profiles = self.scanner.profiles;
+  NSString *activeProfileName = self.scanner.activeProfileName;
+  NSUInteger activeIndex = [profiles
+      indexOfObjectPassingTest:^BOOL(GSCXCheckProfile *profile, NSUInteger idx, BOOL *stop) {
+        return [profile.name isEqualToString:activeProfileName];
+      }];
+  // The registered checks come before the first profile, so NSNotFound advances to the first.
+  NSUInteger nextIndex = (activeIndex == NSNotFound) ? 0 : activeIndex + 1;
+  self.scanner.activeProfileName = (nextIndex < profiles.count) ? profiles[nextIndex].name : nil;
+  NSAttributedString *currentTitle = [sender attributedTitleForState:UIControlStateNormal];
+  NSDictionary<NSAttributedStringKey, id> *attributes =
+      currentTitle.length > 0 ? [currentTitle attributesAtIndex:0 effectiveRange:NULL] : nil;
+  NSAttributedString *title =
+      [[NSAttributedString alloc] initWithString:[self gscx_checkProfileTitle]
+                                      attributes:attributes];
+  [sender setAttributedTitle:title forState:UIControlStateNormal];
+}
+
+/**
+ * @return The title of the button that switches the scanner to its next check profile.
+ */
+- (NSString *)gscx_checkProfileTitle {
+  NSString *profileName = self.scanner.activeProfileName ?: kGSCXRegisteredChecksProfileName;
+  return [NSString stringWithFormat:kGSCXCheckProfileTitleFormat, profileName];
+}
+
+/**
+ * Presents an alert with a single button dismissing it.
+ *
+ * @param title The title of the alert.
+ * @param message The message of the alert.
+ */
+- (void)gscx_presentAlertWithTitle:(NSString *)title message:(NSString *)message {
+  UIAlertController *alert =
+      [UIAlertController alertControllerWithTitle:title
+                                          message:message
+                                   preferredStyle:UIAlertControllerStyleAlert];
+  id<GSCXResultsWindowCoordinating> resultsWindowCoordinator = self.resultsWindowCoordinator;
+  [alert addAction:[UIAlertAction actionWithTitle:kGSCXNoIssuesDismissButtonText
+                                            style:UIAlertActionStyleCancel
+                                          handler:^(UIAlertAction *action) {
+                                            [resultsWindowCoordinator dismissResultsWindow];
+                                          }]];
+  [self presentViewController:alert animated:YES completion:nil];
+}
+
 /**
  * Presents a report of all continuous scan results.
+ *
+ * @param requestTime The time, as returned by @c CACurrentMediaTime, at which the user requested
+ *  the results. Used to measure the latency until the results are displayed.
+ */
+- (void)gscx_presentContinuousScanResultsRequestedAtTime:(CFTimeInterval)requestTime {
+  [self gscx_presentContinuousScanResults:self.continuousScanner.scanResults
+                          requestedAtTime:requestTime];
+}
+
+/**
+ * Presents a report of @c results.
+ *
+ * @param results The continuous scan results to present.
+ * @param requestTime The time, as returned by @c CACurrentMediaTime, at which the user requested
+ *  the results. Used to measure the latency until the results are displayed.
  */
-- (void)gscx_presentContinuousScanResults {
+- (void)gscx_presentContinuousScanResults:(NSArray<GTXHierarchyResultCollection *> *)results
+                          requestedAtTime:(CFTimeInterval)requestTime {
   GSCXContinuousScannerScreenshotViewController *viewController =
       [[GSCXContinuousScannerScreenshotViewController alloc]
-          initWithScannerResults:self.continuousScanner.scanResults
+          initWithScannerResults:results
                  sharingDelegate:self.sharingDelegate];
+  viewController.presentationRequestTime = requestTime;
+  viewController.sharesDeduplicatedIssues = self.sharesDeduplicatedIssues;
   [self gscx_updateNavigationItemForResultsViewController:viewController];
   UINavigationController *navigationController =
       [[UINavigationController alloc] initWithRootViewController:viewController];
@@ -479,13 +828,34 @@ static NSString *const kGSCXSettingsButtonTitleContinuousScanningInactive = @"Sc
  */
 - (void)gscx_stopContinuousScanningAndPresentResults {
   GTX_ASSERT([self.continuousScanner isScanning], @"Cannot stop scanning while not scanning.");
+  CFTimeInterval requestTime = CACurrentMediaTime();
   [self gscx_setSettingsAttributedTitleToText:kGSCXSettingsButtonTitleContinuousScanningInactive];
   [self.continuousScanner stopScanning];
+  [self gscx_updateJournaledSessionCount];
   if ([self.continuousScanner issueCount] == 0) {
     [self gscx_presentNoIssuesFoundAlert];
     return;
   }
-  [self gscx_presentContinuousScanResults];
+  [self gscx_presentContinuousScanResultsRequestedAtTime:requestTime];
+}
+
+/**
+ * Counts the sessions journaled by @c continuousScanner on a background queue, then updates
+ * @c journaledSessionCount on the main queue.
+ */
+- (void)gscx_updateJournaledSessionCount {
+  NSURL *sessionDirectoryURL = self.continuousScanner.sessionJournalDirectoryURL;
+  if (sessionDirectoryURL == nil) {
+    self.journaledSessionCount = 0;
+    return;
+  }
+  __weak __typeof__(self) weakSelf = self;
+  dispatch_async(dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+    NSUInteger sessionCount = [GSCXSessionJournal sessionsInDirectory:sessionDirectoryURL].count;
+    dispatch_async(dispatch_get_main_queue(), ^{
+      weakSelf.journaledSessionCount = sessionCount;
+    });
+  });
 }
 
 /**
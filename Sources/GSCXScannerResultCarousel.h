@@ -58,6 +58,22 @@ typedef void (^GSCXCarouselBlock)(NSUInteger index, GTXHierarchyResultCollection
 - (instancetype)initWithResults:(NSArray<GTXHierarchyResultCollection *> *)results
                  selectionBlock:(GSCXCarouselBlock)selectionBlock;
 
+/**
+ * Initializes a @c GSCXScannerResultCarousel displaying the first @c displayedResultCount of
+ * @c results. @c results is not copied. Results are only accessed when their cells are displayed,
+ * and items are sized with @c gscx_screenshotSizeOfResultAtIndex:, so results that are decoded on
+ * access are not loaded until they are scrolled into view.
+ *
+ * @param results The results to display. Must not be mutated while the carousel exists.
+ * @param displayedResultCount The number of results displayed initially. Must be at least 1 and at
+ *  most the number of results.
+ * @param selectionBlock A callback invoked when the selected result changes.
+ * @return An initialized @c GSCXScannerResultCarousel instance.
+ */
+- (instancetype)initWithResults:(NSArray<GTXHierarchyResultCollection *> *)results
+           displayedResultCount:(NSUInteger)displayedResultCount
+                 selectionBlock:(GSCXCarouselBlock)selectionBlock;
+
 /**
  * Changes the selected scan result to the result at @c index. Does not invoke @c selectionBlock.
  * The caller is responsible for updating any state.
@@ -67,6 +83,20 @@ typedef void (^GSCXCarouselBlock)(NSUInteger index, GTXHierarchyResultCollection
  */
 - (void)focusResultAtIndex:(NSUInteger)index animated:(BOOL)animated;
 
+/**
+ * Displays the first @c count results, adding items for results that were not displayed yet. Lets
+ * the owner display the first results immediately and populate the rest of the carousel
+ * incrementally. Does nothing if @c count results are already displayed.
+ *
+ * @param count The number of results to display. Clamped to the number of results.
+ */
+- (void)displayResultsUpToCount:(NSUInteger)count;
+
+/**
+ * @return The number of results currently displayed in the carousel.
+ */
+- (NSUInteger)resultCount;
+
 /**
  * Lays out carousel elements that are not automatically set by AutoLayout. It is the responsibility
  * of this object's owner to call @c layout in either @c layoutSubviews or @c viewDidLayoutSubviews.
@@ -19,6 +19,7 @@
 #import "GSCXRingView.h"
 #import "GSCXScannerResultCarouselCollectionViewCell.h"
 #import "GSCXScannerResultCarouselView.h"
+#import "NSArray+GSCXResults.h"
 #import "NSLayoutConstraint+GSCXUtilities.h"
 #import <GTXiLib/GTXiLib.h>
 /**
@@ -47,10 +48,15 @@ NS_ASSUME_NONNULL_BEGIN
 @property(strong, nonatomic) UICollectionViewFlowLayout *layout;
 
 /**
- * The scan results to be displayed.
+ * The scan results to be displayed. Only the first @c displayedResultCount are displayed.
  */
 @property(strong, nonatomic, readonly) NSArray<GTXHierarchyResultCollection *> *results;
 
+/**
+ * The number of results in @c results currently displayed.
+ */
+@property(assign, nonatomic) NSUInteger displayedResultCount;
+
 /**
  * The index of the currently selected scan. Defaults to 0.
  */
@@ -67,9 +73,20 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (instancetype)initWithResults:(NSArray<GTXHierarchyResultCollection *> *)results
                  selectionBlock:(GSCXCarouselBlock)selectionBlock {
+  return [self initWithResults:results
+          displayedResultCount:results.count
+                selectionBlock:selectionBlock];
+}
+
+- (instancetype)initWithResults:(NSArray<GTXHierarchyResultCollection *> *)results
+           displayedResultCount:(NSUInteger)displayedResultCount
+                 selectionBlock:(GSCXCarouselBlock)selectionBlock {
+  GTX_ASSERT(displayedResultCount > 0 && displayedResultCount <= results.count,
+             @"displayedResultCount is out of range.");
   self = [super init];
   if (self != nil) {
     _results = results;
+    _displayedResultCount = displayedResultCount;
     _selectionBlock = selectionBlock;
     _layout = [[UICollectionViewFlowLayout alloc] init];
     _layout.scrollDirection = UICollectionViewScrollDirectionHorizontal;
@@ -100,7 +117,8 @@ NS_ASSUME_NONNULL_BEGIN
             }
             incrementBlock:^(id sender) {
               __typeof__(self) strongSelf = weakSelf;
-              if (strongSelf == nil || strongSelf.selectedIndex == strongSelf.results.count - 1) {
+              if (strongSelf == nil ||
+                  strongSelf.selectedIndex + 1 >= strongSelf.displayedResultCount) {
                 return;
               }
               [strongSelf focusResultAtIndex:strongSelf.selectedIndex + 1 animated:YES];
@@ -124,6 +142,33 @@ NS_ASSUME_NONNULL_BEGIN
   _selectedIndex = index;
 }
 
+- (void)displayResultsUpToCount:(NSUInteger)count {
+  count = MIN(count, self.results.count);
+  if (count <= self.displayedResultCount) {
+    return;
+  }
+  NSUInteger firstIndex = self.displayedResultCount;
+  self.displayedResultCount = count;
+  if (self.carouselView.window == nil) {
+    // The collection view has not necessarily loaded its data yet, so incremental updates could be
+    // inconsistent with its internal state.
+    [self.carouselView reloadData];
+    return;
+  }
+  NSMutableArray<NSIndexPath *> *indexPaths =
+      [NSMutableArray arrayWithCapacity:count - firstIndex];
+  for (NSUInteger i = firstIndex; i < count; i++) {
+    [indexPaths addObject:[NSIndexPath indexPathForItem:(NSInteger)i inSection:0]];
+  }
+  [UIView performWithoutAnimation:^{
+    [self.carouselView insertItemsAtIndexPaths:indexPaths];
+  }];
+}
+
+- (NSUInteger)resultCount {
+  return self.displayedResultCount;
+}
+
 - (void)layoutSubviews {
   self.carouselAccessibilityElement.accessibilityFrame =
       [self.carouselView.superview convertRect:self.carouselView.frame
@@ -156,14 +201,16 @@ NS_ASSUME_NONNULL_BEGIN
                     layout:(UICollectionViewLayout *)collectionViewLayout
     sizeForItemAtIndexPath:(NSIndexPath *)indexPath {
   CGFloat height = collectionView.frame.size.height - 2.0 * kVerticalSpacing;
-  UIImage *screenshot = self.results[indexPath.row].screenshot;
-  CGFloat aspectRatio = screenshot.size.width / screenshot.size.height;
+  // Flow layouts size every item, so only the size is read, not the screenshot.
+  CGSize screenshotSize =
+      [self.results gscx_screenshotSizeOfResultAtIndex:(NSUInteger)indexPath.row];
+  CGFloat aspectRatio = screenshotSize.width / screenshotSize.height;
   return CGSizeMake(aspectRatio * height, height);
 }
 
 - (NSInteger)collectionView:(UICollectionView *)collectionView
      numberOfItemsInSection:(NSInteger)section {
-  return self.results.count;
+  return (NSInteger)self.displayedResultCount;
 }
 
 #pragma mark - UICollectionViewDelegate
@@ -190,7 +237,7 @@ NS_ASSUME_NONNULL_BEGIN
 #pragma mark - Private
 
 - (void)gscx_setAccessibilityOfCarouselForResultAtIndex:(NSUInteger)index {
-  GTX_ASSERT(index < self.results.count, @"index must be within bounds");
+  GTX_ASSERT(index < self.displayedResultCount, @"index must be within bounds");
   self.carouselAccessibilityElement.accessibilityLabel = [NSString
       stringWithFormat:@"%lu issues", (unsigned long)[self.results[index] checkResultCount]];
   self.carouselAccessibilityElement.accessibilityValue =
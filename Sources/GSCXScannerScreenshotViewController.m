@@ -22,6 +22,7 @@
 #import "GSCXReport.h"
 #import "GSCXRingView.h"
 #import "GSCXRingViewArranger.h"
+#import "GTXHierarchyResultCollection+GSCXScreenshot.h"
 #import "NSLayoutConstraint+GSCXUtilities.h"
 #import "UIViewController+GSCXAppearance.h"
 
@@ -210,8 +211,7 @@ static const CGFloat kGSCXScannerScreenshotPadding = 0.0;
 
 - (void)gscx_addRingsToScreenshot:(UIView *)screenshot {
   [self.ringViewArranger removeRingViewsFromSuperview];
-  CGRect originalCoordinates = CGRectMake(0, 0, self.scanResult.screenshot.size.width,
-                                          self.scanResult.screenshot.size.height);
+  CGRect originalCoordinates = self.scanResult.gscx_screenshotFrame;
   [self.ringViewArranger addRingViewsToSuperview:screenshot fromCoordinates:originalCoordinates];
   [self.ringViewArranger addAccessibilityAttributesToRingViews];
   for (GSCXRingView *ringView in self.ringViewArranger.ringViews) {
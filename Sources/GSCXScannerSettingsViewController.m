@@ -105,7 +105,7 @@ static NSString *const kGSCXScannerSettingsTableViewCellReuseIdentifier = @"sett
  * Prevents @c scanner from scanning the table view or its descendants. This prevents the scanner
  * from scanning the table view during an animation, which produces false positives.
  */
-@property(strong, nonatomic, nullable) id<GTXExcludeListing> tableViewHierarchyExcludeList;
+@property(strong, nonatomic, nullable) GSCXExclusion *tableViewHierarchyExclusion;
 
 /**
  * Animates any view hierarchy changes that occur in @c animations using the default duration and
@@ -180,7 +180,7 @@ static NSString *const kGSCXScannerSettingsTableViewCellReuseIdentifier = @"sett
 }
 
 - (void)animateInWithCompletion:(nullable void (^)(BOOL))completion {
-  [self gscx_registerExcludeListForTableViewHierarchy];
+  [self gscx_addExclusionForTableViewHierarchy];
   __weak __typeof__(self) weakSelf = self;
   // clang-format off
   // Disabling autoformatting because the autoformatter places self and gscx_animate: on separate
@@ -196,7 +196,7 @@ static NSString *const kGSCXScannerSettingsTableViewCellReuseIdentifier = @"sett
       weakSelf.tableView.alpha = 1.0;
     }
         completion:^(BOOL finished) {
-      [weakSelf gscx_deregisterExcludeListForTableViewHierarchy];
+      [weakSelf gscx_removeExclusionForTableViewHierarchy];
       if (completion) {
         completion(finished);
       }
@@ -206,7 +206,7 @@ static NSString *const kGSCXScannerSettingsTableViewCellReuseIdentifier = @"sett
 }
 
 - (void)animateOutWithCompletion:(nullable void (^)(BOOL))completion {
-  [self gscx_registerExcludeListForTableViewHierarchy];
+  [self gscx_addExclusionForTableViewHierarchy];
   __weak __typeof__(self) weakSelf = self;
   // clang-format off
   [self gscx_animate:^(void) {
@@ -219,7 +219,7 @@ static NSString *const kGSCXScannerSettingsTableViewCellReuseIdentifier = @"sett
       [NSLayoutConstraint activateConstraints:strongSelf.initialConstraints];
     }
         completion:^(BOOL finished) {
-      [weakSelf gscx_deregisterExcludeListForTableViewHierarchy];
+      [weakSelf gscx_removeExclusionForTableViewHierarchy];
       if (completion) {
         completion(finished);
       }
@@ -371,40 +371,22 @@ static NSString *const kGSCXScannerSettingsTableViewCellReuseIdentifier = @"sett
   }
 }
 
-- (void)gscx_registerExcludeListForTableViewHierarchy {
-  UITableView *tableView = self.tableView;
-  self.tableViewHierarchyExcludeList =
-      [GTXExcludeListBlock excludeListWithBlock:^BOOL(id element, NSString *checkName) {
-        if ([element respondsToSelector:@selector(accessibilityContainer)]) {
-          // UIAccessibilityElement instances do not have a superview method, but UITableView uses
-          // subclasses of UIAccessibilityElement to represent some things which the scanner flags
-          // incorrectly. In those cases, the UITableView is the accessibility container, so
-          // checking for that excludeLists only the elements in the settings table view. Other
-          // table views are unaffected.
-          if ([element accessibilityContainer] == tableView) {
-            return YES;
-          }
-        }
-        if (![element respondsToSelector:@selector(superview)]) {
-          // The following algorithm will crash if the element does not respond to superview. Only
-          // UIView instances can be descendants of the table view, so an element that does not
-          // respond to superview is guaranteed not to be in the hierarchy.
-          return NO;
-        }
-        while (element != nil) {
-          if (element == tableView) {
-            return YES;
-          }
-          element = [element superview];
-        }
-        return NO;
-      }];
-  [self.scanner registerExcludeList:self.tableViewHierarchyExcludeList];
+- (void)gscx_addExclusionForTableViewHierarchy {
+  if (self.tableViewHierarchyExclusion != nil) {
+    return;
+  }
+  // UITableView represents some of its content with accessibility elements that are not views.
+  // Their accessibility container is in the table view's subtree, so they are also excluded.
+  self.tableViewHierarchyExclusion =
+      [GSCXExclusion exclusionWithSubtreeRootedAtView:self.tableView];
+  [self.scanner addExclusion:self.tableViewHierarchyExclusion];
 }
 
-- (void)gscx_deregisterExcludeListForTableViewHierarchy {
-  [self.scanner deregisterExcludeList:self.tableViewHierarchyExcludeList];
-  self.tableViewHierarchyExcludeList = nil;
+- (void)gscx_removeExclusionForTableViewHierarchy {
+  if (self.tableViewHierarchyExclusion != nil) {
+    [self.scanner removeExclusion:self.tableViewHierarchyExclusion];
+  }
+  self.tableViewHierarchyExclusion = nil;
 }
 
 @end
@@ -0,0 +1,61 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+#import "GSCXScreenFingerprint.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * The default minimum similarity for a fingerprint to join an existing screen.
+ */
+FOUNDATION_EXTERN const CGFloat kGSCXScreenClustererDefaultSimilarityThreshold;
+
+/**
+ * Incrementally groups screen fingerprints into screens. Each fingerprint joins the first existing
+ * screen whose representative fingerprint is similar enough, or starts a new screen.
+ */
+@interface GSCXScreenClusterer : NSObject
+
+/**
+ * The minimum value of @c similarityToFingerprint: for a fingerprint to join an existing screen.
+ * Defaults to @c kGSCXScreenClustererDefaultSimilarityThreshold.
+ */
+@property(assign, nonatomic) CGFloat similarityThreshold;
+
+/**
+ * Returns the index of the screen @c fingerprint belongs to, creating a new screen if it is not
+ * similar to any existing screen. Screens are indexed in the order they were first seen.
+ *
+ * @param fingerprint The fingerprint to cluster.
+ * @return The index of the screen containing @c fingerprint.
+ */
+- (NSUInteger)screenIndexForFingerprint:(GSCXScreenFingerprint *)fingerprint;
+
+/**
+ * @return The number of distinct screens seen so far.
+ */
+- (NSUInteger)screenCount;
+
+/**
+ * Removes all screens.
+ */
+- (void)reset;
+
+@end
+
+NS_ASSUME_NONNULL_END
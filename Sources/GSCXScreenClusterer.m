@@ -0,0 +1,82 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXScreenClusterer.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+const CGFloat kGSCXScreenClustererDefaultSimilarityThreshold = 0.8;
+
+@interface GSCXScreenClusterer ()
+
+/**
+ * The first fingerprint seen for each screen, indexed by screen index.
+ */
+@property(strong, nonatomic) NSMutableArray<GSCXScreenFingerprint *> *representatives;
+
+/**
+ * The screen indices of all representatives with a given view controller signature. Only
+ * representatives with the same signature can be similar, so only they are compared.
+ */
+@property(strong, nonatomic)
+    NSMutableDictionary<NSString *, NSMutableArray<NSNumber *> *> *screenIndicesBySignature;
+
+@end
+
+@implementation GSCXScreenClusterer
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _similarityThreshold = kGSCXScreenClustererDefaultSimilarityThreshold;
+    _representatives = [[NSMutableArray alloc] init];
+    _screenIndicesBySignature = [[NSMutableDictionary alloc] init];
+  }
+  return self;
+}
+
+- (NSUInteger)screenIndexForFingerprint:(GSCXScreenFingerprint *)fingerprint {
+  NSMutableArray<NSNumber *> *candidates =
+      self.screenIndicesBySignature[fingerprint.viewControllerSignature];
+  for (NSNumber *screenIndex in candidates) {
+    GSCXScreenFingerprint *representative =
+        self.representatives[[screenIndex unsignedIntegerValue]];
+    if ([representative similarityToFingerprint:fingerprint] >= self.similarityThreshold) {
+      return [screenIndex unsignedIntegerValue];
+    }
+  }
+  NSUInteger screenIndex = self.representatives.count;
+  [self.representatives addObject:fingerprint];
+  if (candidates == nil) {
+    candidates = [[NSMutableArray alloc] init];
+    self.screenIndicesBySignature[fingerprint.viewControllerSignature] = candidates;
+  }
+  [candidates addObject:@(screenIndex)];
+  return screenIndex;
+}
+
+- (NSUInteger)screenCount {
+  return self.representatives.count;
+}
+
+- (void)reset {
+  [self.representatives removeAllObjects];
+  [self.screenIndicesBySignature removeAllObjects];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
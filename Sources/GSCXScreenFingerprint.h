@@ -0,0 +1,89 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import <GTXiLib/GTXiLib.h>
+#import <UIKit/UIKit.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * A structural signature of the screen displayed by a view hierarchy. Two hierarchies showing the
+ * same screen in slightly different states, such as with different text or a different number of
+ * table view cells, produce similar fingerprints. Fingerprints are cheap to compute compared to a
+ * scan, so they can be used to decide whether a scan is necessary.
+ */
+@interface GSCXScreenFingerprint : NSObject
+
+/**
+ * The class names of the visible view controllers, from the root view controller to the most
+ * deeply nested child, joined into a single string. Screens with different view controllers are
+ * always considered different.
+ */
+@property(copy, nonatomic, readonly) NSString *viewControllerSignature;
+
+/**
+ * Coarse tokens describing the shape of the view hierarchy near its roots. Each token combines a
+ * view's depth and class. Counts are deliberately excluded so repeated content does not change the
+ * shape.
+ */
+@property(copy, nonatomic, readonly) NSSet<NSString *> *shapeTokens;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Initializes a @c GSCXScreenFingerprint instance with the given components.
+ *
+ * @param viewControllerSignature The class names of the visible view controllers.
+ * @param shapeTokens Tokens describing the shape of the view hierarchy.
+ * @return An initialized @c GSCXScreenFingerprint instance.
+ */
+- (instancetype)initWithViewControllerSignature:(NSString *)viewControllerSignature
+                                    shapeTokens:(NSSet<NSString *> *)shapeTokens
+    NS_DESIGNATED_INITIALIZER;
+
+/**
+ * Computes the fingerprint of the screen displayed by @c rootViews.
+ *
+ * @param rootViews The root views of the hierarchy, usually windows.
+ * @return The fingerprint of the screen displayed by @c rootViews.
+ */
++ (instancetype)fingerprintWithRootViews:(NSArray<UIView *> *)rootViews;
+
+/**
+ * Computes the fingerprint of the screen a scan result was produced from, for results whose view
+ * hierarchy is no longer available, such as those read from a session journal. Only the elements
+ * with issues are known, so the fingerprint has an empty view controller signature and one shape
+ * token per element class and accessibility identifier. It is only comparable to other
+ * fingerprints computed from element results.
+ *
+ * @param elementResults The element results of the scan result.
+ * @return The fingerprint of the screen the scan result was produced from.
+ */
++ (instancetype)fingerprintWithElementResults:
+    (NSArray<GTXElementResultCollection *> *)elementResults;
+
+/**
+ * Computes how similar this fingerprint is to @c fingerprint.
+ *
+ * @param fingerprint The fingerprint to compare to.
+ * @return 0 if the view controller signatures differ. Otherwise, the Jaccard similarity of the
+ *  shape tokens, between 0 and 1 inclusive. 1 if both fingerprints have no shape tokens.
+ */
+- (CGFloat)similarityToFingerprint:(GSCXScreenFingerprint *)fingerprint;
+
+@end
+
+NS_ASSUME_NONNULL_END
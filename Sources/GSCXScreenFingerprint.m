@@ -0,0 +1,171 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXScreenFingerprint.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * The maximum depth, relative to a root view, of views contributing shape tokens. Deeper views
+ * usually represent content, not screen structure, and visiting them would make fingerprints as
+ * expensive as scans.
+ */
+static const NSUInteger kGSCXScreenFingerprintMaximumShapeDepth = 6;
+
+/**
+ * Separates view controller class names in @c viewControllerSignature.
+ */
+static NSString *const kGSCXScreenFingerprintViewControllerSeparator = @">";
+
+@implementation GSCXScreenFingerprint
+
+- (instancetype)initWithViewControllerSignature:(NSString *)viewControllerSignature
+                                    shapeTokens:(NSSet<NSString *> *)shapeTokens {
+  self = [super init];
+  if (self) {
+    _viewControllerSignature = [viewControllerSignature copy];
+    _shapeTokens = [shapeTokens copy];
+  }
+  return self;
+}
+
++ (instancetype)fingerprintWithRootViews:(NSArray<UIView *> *)rootViews {
+  NSMutableArray<NSString *> *viewControllerClasses = [[NSMutableArray alloc] init];
+  NSMutableSet<NSString *> *shapeTokens = [[NSMutableSet alloc] init];
+  for (UIView *rootView in rootViews) {
+    UIViewController *rootViewController =
+        [GSCXScreenFingerprint gscx_viewControllerOfView:rootView];
+    if (rootViewController != nil) {
+      [GSCXScreenFingerprint gscx_addVisibleViewControllerClassesOf:rootViewController
+                                                            toArray:viewControllerClasses];
+    }
+    [GSCXScreenFingerprint gscx_addShapeTokensOfView:rootView depth:0 toSet:shapeTokens];
+  }
+  NSString *signature = [viewControllerClasses
+      componentsJoinedByString:kGSCXScreenFingerprintViewControllerSeparator];
+  return [[GSCXScreenFingerprint alloc] initWithViewControllerSignature:signature
+                                                            shapeTokens:shapeTokens];
+}
+
++ (instancetype)fingerprintWithElementResults:
+    (NSArray<GTXElementResultCollection *> *)elementResults {
+  NSMutableSet<NSString *> *shapeTokens = [[NSMutableSet alloc] init];
+  for (GTXElementResultCollection *elementResult in elementResults) {
+    GTXElementReference *elementReference = elementResult.elementReference;
+    NSString *className = NSStringFromClass(elementReference.elementClass);
+    NSString *identifier = elementReference.accessibilityIdentifier;
+    if (identifier.length > 0) {
+      [shapeTokens addObject:[NSString stringWithFormat:@"%@#%@", className, identifier]];
+    } else {
+      [shapeTokens addObject:className];
+    }
+  }
+  return [[GSCXScreenFingerprint alloc] initWithViewControllerSignature:@""
+                                                            shapeTokens:shapeTokens];
+}
+
+- (CGFloat)similarityToFingerprint:(GSCXScreenFingerprint *)fingerprint {
+  if (![self.viewControllerSignature isEqualToString:fingerprint.viewControllerSignature]) {
+    return 0.0;
+  }
+  NSMutableSet<NSString *> *unionTokens = [self.shapeTokens mutableCopy];
+  [unionTokens unionSet:fingerprint.shapeTokens];
+  if (unionTokens.count == 0) {
+    return 1.0;
+  }
+  NSMutableSet<NSString *> *intersectionTokens = [self.shapeTokens mutableCopy];
+  [intersectionTokens intersectSet:fingerprint.shapeTokens];
+  return (CGFloat)intersectionTokens.count / (CGFloat)unionTokens.count;
+}
+
+- (BOOL)isEqual:(id)object {
+  if (![object isKindOfClass:[GSCXScreenFingerprint class]]) {
+    return NO;
+  }
+  GSCXScreenFingerprint *fingerprint = (GSCXScreenFingerprint *)object;
+  return [self.viewControllerSignature isEqualToString:fingerprint.viewControllerSignature] &&
+         [self.shapeTokens isEqualToSet:fingerprint.shapeTokens];
+}
+
+- (NSUInteger)hash {
+  return [self.viewControllerSignature hash] ^ self.shapeTokens.count;
+}
+
+#pragma mark - Private
+
+/**
+ * Returns the root view controller of @c view if it is a window, or the view controller owning
+ * @c view otherwise.
+ *
+ * @param view The view to find the view controller of.
+ * @return The view controller associated with @c view, or @c nil if there is none.
+ */
++ (nullable UIViewController *)gscx_viewControllerOfView:(UIView *)view {
+  if ([view isKindOfClass:[UIWindow class]]) {
+    return ((UIWindow *)view).rootViewController;
+  }
+  UIResponder *responder = view.nextResponder;
+  while (responder != nil && ![responder isKindOfClass:[UIViewController class]]) {
+    responder = responder.nextResponder;
+  }
+  return (UIViewController *)responder;
+}
+
+/**
+ * Adds the class names of @c viewController and all its visible descendants to @c classes, in
+ * depth first order. Presented view controllers are treated as descendants.
+ *
+ * @param viewController The view controller to add the classes of.
+ * @param classes The array to add class names to.
+ */
++ (void)gscx_addVisibleViewControllerClassesOf:(UIViewController *)viewController
+                                       toArray:(NSMutableArray<NSString *> *)classes {
+  [classes addObject:NSStringFromClass([viewController class])];
+  for (UIViewController *child in viewController.childViewControllers) {
+    if (child.isViewLoaded && child.view.window != nil && !child.view.hidden) {
+      [GSCXScreenFingerprint gscx_addVisibleViewControllerClassesOf:child toArray:classes];
+    }
+  }
+  UIViewController *presented = viewController.presentedViewController;
+  if (presented != nil && presented.presentingViewController == viewController) {
+    [GSCXScreenFingerprint gscx_addVisibleViewControllerClassesOf:presented toArray:classes];
+  }
+}
+
+/**
+ * Adds a token for @c view and each of its visible descendants up to
+ * @c kGSCXScreenFingerprintMaximumShapeDepth to @c tokens.
+ *
+ * @param view The view to add tokens for.
+ * @param depth The depth of @c view relative to the root view.
+ * @param tokens The set to add tokens to.
+ */
++ (void)gscx_addShapeTokensOfView:(UIView *)view
+                            depth:(NSUInteger)depth
+                            toSet:(NSMutableSet<NSString *> *)tokens {
+  if (view.hidden || depth > kGSCXScreenFingerprintMaximumShapeDepth) {
+    return;
+  }
+  [tokens addObject:[NSString stringWithFormat:@"%lu:%@", (unsigned long)depth,
+                                               NSStringFromClass([view class])]];
+  for (UIView *subview in view.subviews) {
+    [GSCXScreenFingerprint gscx_addShapeTokensOfView:subview depth:depth + 1 toSet:tokens];
+  }
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,101 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * The default number of screens @c GSCXScreenScanQuota tracks before evicting the least recently
+ * seen screen.
+ */
+FOUNDATION_EXTERN const NSUInteger kGSCXScreenScanQuotaDefaultCapacity;
+
+/**
+ * Limits how many times the same screen is scanned within a time window. Tracks recently seen
+ * screens in a least recently used table, so memory use is bounded no matter how many screens an
+ * application has.
+ */
+@interface GSCXScreenScanQuota : NSObject
+
+/**
+ * The maximum number of scans allowed per screen within @c timeWindow.
+ */
+@property(assign, nonatomic, readonly) NSUInteger maximumScansPerScreen;
+
+/**
+ * The length of the window, in seconds, in which at most @c maximumScansPerScreen scans of a screen
+ * are allowed. The window starts at the first allowed scan of a screen.
+ */
+@property(assign, nonatomic, readonly) NSTimeInterval timeWindow;
+
+/**
+ * The maximum number of screens tracked at once.
+ */
+@property(assign, nonatomic, readonly) NSUInteger capacity;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Initializes a @c GSCXScreenScanQuota instance. Fails with an assertion if
+ * @c maximumScansPerScreen or @c capacity is 0.
+ *
+ * @param maximumScansPerScreen The maximum number of scans allowed per screen within
+ *  @c timeWindow.
+ * @param timeWindow The length of the window, in seconds.
+ * @param capacity The maximum number of screens tracked at once.
+ * @return An initialized @c GSCXScreenScanQuota instance.
+ */
+- (instancetype)initWithMaximumScansPerScreen:(NSUInteger)maximumScansPerScreen
+                                   timeWindow:(NSTimeInterval)timeWindow
+                                     capacity:(NSUInteger)capacity NS_DESIGNATED_INITIALIZER;
+
+/**
+ * Constructs a @c GSCXScreenScanQuota instance with capacity
+ * @c kGSCXScreenScanQuotaDefaultCapacity.
+ *
+ * @param maximumScansPerScreen The maximum number of scans allowed per screen within
+ *  @c timeWindow.
+ * @param timeWindow The length of the window, in seconds.
+ * @return A constructed @c GSCXScreenScanQuota instance.
+ */
++ (instancetype)quotaWithMaximumScansPerScreen:(NSUInteger)maximumScansPerScreen
+                                    timeWindow:(NSTimeInterval)timeWindow;
+
+/**
+ * Determines if the screen at @c screenIndex may be scanned at @c time. If so, the scan is counted
+ * against the screen's quota.
+ *
+ * @param screenIndex Identifies the screen, as returned by @c GSCXScreenClusterer.
+ * @param time The current time, in seconds. Must be monotonically non-decreasing between calls.
+ * @return @c YES if the screen has not reached its quota and the scan should proceed, @c NO if the
+ *  scan should be skipped.
+ */
+- (BOOL)shouldScanScreenAtIndex:(NSUInteger)screenIndex time:(NSTimeInterval)time;
+
+/**
+ * Forgets all screens.
+ */
+- (void)reset;
+
+/**
+ * @return The number of screens currently tracked.
+ */
+- (NSUInteger)trackedScreenCount;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,132 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXScreenScanQuota.h"
+
+#import <GTXiLib/GTXiLib.h>
+NS_ASSUME_NONNULL_BEGIN
+
+const NSUInteger kGSCXScreenScanQuotaDefaultCapacity = 64;
+
+/**
+ * The scans of a single screen in its current window.
+ */
+@interface GSCXScreenScanQuotaEntry : NSObject
+
+/**
+ * The number of scans allowed in the current window.
+ */
+@property(assign, nonatomic) NSUInteger scanCount;
+
+/**
+ * The time the current window started.
+ */
+@property(assign, nonatomic) NSTimeInterval windowStartTime;
+
+@end
+
+@implementation GSCXScreenScanQuotaEntry
+@end
+
+@interface GSCXScreenScanQuota ()
+
+/**
+ * The tracked screens, keyed by screen index.
+ */
+@property(strong, nonatomic)
+    NSMutableDictionary<NSNumber *, GSCXScreenScanQuotaEntry *> *entriesByScreenIndex;
+
+/**
+ * The tracked screen indices, from least recently seen to most recently seen.
+ */
+@property(strong, nonatomic) NSMutableArray<NSNumber *> *recencyOrder;
+
+@end
+
+@implementation GSCXScreenScanQuota
+
+- (instancetype)initWithMaximumScansPerScreen:(NSUInteger)maximumScansPerScreen
+                                   timeWindow:(NSTimeInterval)timeWindow
+                                     capacity:(NSUInteger)capacity {
+  GTX_ASSERT(maximumScansPerScreen > 0, @"maximumScansPerScreen must be positive.");
+  GTX_ASSERT(capacity > 0, @"capacity must be positive.");
+  self = [super init];
+  if (self) {
+    _maximumScansPerScreen = maximumScansPerScreen;
+    _timeWindow = timeWindow;
+    _capacity = capacity;
+    _entriesByScreenIndex = [[NSMutableDictionary alloc] init];
+    _recencyOrder = [[NSMutableArray alloc] init];
+  }
+  return self;
+}
+
++ (instancetype)quotaWithMaximumScansPerScreen:(NSUInteger)maximumScansPerScreen
+                                    timeWindow:(NSTimeInterval)timeWindow {
+  return [[GSCXScreenScanQuota alloc]
+      initWithMaximumScansPerScreen:maximumScansPerScreen
+                         timeWindow:timeWindow
+                           capacity:kGSCXScreenScanQuotaDefaultCapacity];
+}
+
+- (BOOL)shouldScanScreenAtIndex:(NSUInteger)screenIndex time:(NSTimeInterval)time {
+  NSNumber *key = @(screenIndex);
+  GSCXScreenScanQuotaEntry *entry = self.entriesByScreenIndex[key];
+  if (entry == nil) {
+    entry = [[GSCXScreenScanQuotaEntry alloc] init];
+    entry.windowStartTime = time;
+    self.entriesByScreenIndex[key] = entry;
+    [self gscx_evictIfNeeded];
+  } else {
+    // The tracked set is small, so a linear scan is cheaper than maintaining a linked list.
+    [self.recencyOrder removeObject:key];
+  }
+  [self.recencyOrder addObject:key];
+  if (time - entry.windowStartTime >= self.timeWindow) {
+    entry.windowStartTime = time;
+    entry.scanCount = 0;
+  }
+  if (entry.scanCount >= self.maximumScansPerScreen) {
+    return NO;
+  }
+  entry.scanCount++;
+  return YES;
+}
+
+- (void)reset {
+  [self.entriesByScreenIndex removeAllObjects];
+  [self.recencyOrder removeAllObjects];
+}
+
+- (NSUInteger)trackedScreenCount {
+  return self.entriesByScreenIndex.count;
+}
+
+#pragma mark - Private
+
+/**
+ * Removes the least recently seen screens until at most @c capacity screens are tracked.
+ */
+- (void)gscx_evictIfNeeded {
+  while (self.entriesByScreenIndex.count > self.capacity && self.recencyOrder.count > 0) {
+    [self.entriesByScreenIndex removeObjectForKey:self.recencyOrder[0]];
+    [self.recencyOrder removeObjectAtIndex:0];
+  }
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
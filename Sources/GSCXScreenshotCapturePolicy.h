@@ -0,0 +1,96 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import <UIKit/UIKit.h>
+
+#import <GTXiLib/GTXiLib.h>
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * The default margin, in points, added around flagged elements when a screenshot is cropped.
+ */
+FOUNDATION_EXTERN const CGFloat kGSCXScreenshotCapturePolicyDefaultCropMargin;
+
+/**
+ * Determines how @c GSCXScanner captures the screenshot of each scan. Full resolution screenshots
+ * of the whole screen are the most expensive part of a scan on 3x devices, and are wasted for scans
+ * that find no issues. The default policy captures the whole screen at the screen's scale, like
+ * GTXiLib does.
+ */
+@interface GSCXScreenshotCapturePolicy : NSObject <NSCopying>
+
+/**
+ * @c YES if no screenshot is captured for scans without issues. Such results hold a small blank
+ * placeholder image with the screen's aspect ratio instead. Defaults to @c NO.
+ */
+@property(assign, nonatomic) BOOL skipsCaptureWithoutIssues;
+
+/**
+ * The scale factor screenshots are captured at. 0 means the scale of the screen. Screenshot sizes
+ * in points are the same at every scale. Defaults to 0.
+ */
+@property(assign, nonatomic) CGFloat scale;
+
+/**
+ * @c YES if screenshots only cover the union of the accessibility frames of flagged elements,
+ * outset by @c cropMargin and clipped to the screen. The captured rectangle is stored in the
+ * result's @c gscx_screenshotFrame. Defaults to @c NO.
+ */
+@property(assign, nonatomic) BOOL cropsToIssues;
+
+/**
+ * The margin, in points, added around flagged elements when @c cropsToIssues is @c YES. Defaults
+ * to @c kGSCXScreenshotCapturePolicyDefaultCropMargin.
+ */
+@property(assign, nonatomic) CGFloat cropMargin;
+
+/**
+ * @return A policy capturing full screenshots at the screen's scale.
+ */
++ (instancetype)defaultPolicy;
+
+/**
+ * @return @c YES if this policy captures the same screenshots as GTXiLib, @c NO otherwise.
+ */
+- (BOOL)isDefault;
+
+/**
+ * Constructs a result containing @c errors and a screenshot of @c rootViews captured according to
+ * this policy. Must be called on the main thread.
+ *
+ * @param errors The errors found when checking @c rootViews.
+ * @param rootViews The views that were checked. Must not be empty.
+ * @return A result containing @c errors.
+ */
+- (GTXHierarchyResultCollection *)resultWithErrors:(NSArray<NSError *> *)errors
+                                         rootViews:(NSArray<UIView *> *)rootViews;
+
+/**
+ * Constructs a result containing @c elementResults and a screenshot of @c rootViews captured
+ * according to this policy. Used when results are filtered before the result is constructed. Must
+ * be called on the main thread.
+ *
+ * @param elementResults The element results found when checking @c rootViews.
+ * @param rootViews The views that were checked. Must not be empty.
+ * @return A result containing @c elementResults.
+ */
+- (GTXHierarchyResultCollection *)resultWithElementResults:
+                                      (NSArray<GTXElementResultCollection *> *)elementResults
+                                                 rootViews:(NSArray<UIView *> *)rootViews;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,183 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXScreenshotCapturePolicy.h"
+
+#import "GTXHierarchyResultCollection+GSCXScreenshot.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+const CGFloat kGSCXScreenshotCapturePolicyDefaultCropMargin = 16.0;
+
+/**
+ * The scale factor of placeholder images used when a capture is skipped. Small enough that the
+ * placeholder costs almost no memory, large enough to keep the screen's aspect ratio.
+ */
+static const CGFloat kGSCXScreenshotCapturePolicyPlaceholderScale = 0.05;
+
+@implementation GSCXScreenshotCapturePolicy
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _skipsCaptureWithoutIssues = NO;
+    _scale = 0.0;
+    _cropsToIssues = NO;
+    _cropMargin = kGSCXScreenshotCapturePolicyDefaultCropMargin;
+  }
+  return self;
+}
+
++ (instancetype)defaultPolicy {
+  return [[GSCXScreenshotCapturePolicy alloc] init];
+}
+
+- (id)copyWithZone:(nullable NSZone *)zone {
+  GSCXScreenshotCapturePolicy *policy = [[GSCXScreenshotCapturePolicy alloc] init];
+  policy.skipsCaptureWithoutIssues = self.skipsCaptureWithoutIssues;
+  policy.scale = self.scale;
+  policy.cropsToIssues = self.cropsToIssues;
+  policy.cropMargin = self.cropMargin;
+  return policy;
+}
+
+- (BOOL)isDefault {
+  return !self.skipsCaptureWithoutIssues && self.scale == 0.0 && !self.cropsToIssues;
+}
+
+- (GTXHierarchyResultCollection *)resultWithErrors:(NSArray<NSError *> *)errors
+                                         rootViews:(NSArray<UIView *> *)rootViews {
+  GTX_ASSERT(rootViews.count > 0, @"rootViews cannot be empty.");
+  if ([self isDefault]) {
+    return [[GTXHierarchyResultCollection alloc] initWithErrors:errors rootViews:rootViews];
+  }
+  NSMutableArray<GTXElementResultCollection *> *elementResults =
+      [[NSMutableArray alloc] initWithCapacity:errors.count];
+  for (NSError *error in errors) {
+    [elementResults addObject:[[GTXElementResultCollection alloc] initWithError:error]];
+  }
+  return [self resultWithElementResults:elementResults rootViews:rootViews];
+}
+
+- (GTXHierarchyResultCollection *)resultWithElementResults:
+                                      (NSArray<GTXElementResultCollection *> *)elementResults
+                                                 rootViews:(NSArray<UIView *> *)rootViews {
+  GTX_ASSERT(rootViews.count > 0, @"rootViews cannot be empty.");
+  UIScreen *screen = rootViews[0].window.screen ?: [UIScreen mainScreen];
+  CGRect captureFrame = screen.bounds;
+  UIImage *screenshot;
+  if (elementResults.count == 0 && self.skipsCaptureWithoutIssues) {
+    screenshot = [GSCXScreenshotCapturePolicy gscx_placeholderImageWithSize:captureFrame.size];
+  } else {
+    if (self.cropsToIssues && elementResults.count > 0) {
+      captureFrame = [self gscx_cropFrameForElementResults:elementResults
+                                               screenBounds:screen.bounds];
+    }
+    screenshot = [self gscx_screenshotOfRootViews:rootViews
+                                           screen:screen
+                                     captureFrame:captureFrame];
+  }
+  GTXHierarchyResultCollection *result =
+      [[GTXHierarchyResultCollection alloc] initWithElementResults:elementResults
+                                                        screenshot:screenshot];
+  result.gscx_screenshotFrame = captureFrame;
+  return result;
+}
+
+#pragma mark - Private
+
+/**
+ * Computes the rectangle covering all flagged elements, outset by @c cropMargin.
+ *
+ * @param elementResults The flagged elements.
+ * @param screenBounds The bounds of the screen the elements are on.
+ * @return The union of the elements' accessibility frames outset by @c cropMargin, clipped to
+ *  @c screenBounds and aligned to whole points. @c screenBounds if the union is empty.
+ */
+- (CGRect)gscx_cropFrameForElementResults:
+              (NSArray<GTXElementResultCollection *> *)elementResults
+                              screenBounds:(CGRect)screenBounds {
+  CGRect unionFrame = CGRectNull;
+  for (GTXElementResultCollection *elementResult in elementResults) {
+    unionFrame = CGRectUnion(unionFrame, elementResult.elementReference.accessibilityFrame);
+  }
+  CGRect cropFrame = CGRectIntersection(
+      CGRectIntegral(CGRectInset(unionFrame, -self.cropMargin, -self.cropMargin)), screenBounds);
+  if (CGRectIsNull(cropFrame) || CGRectIsEmpty(cropFrame)) {
+    return screenBounds;
+  }
+  return cropFrame;
+}
+
+/**
+ * Draws @c rootViews into an image covering @c captureFrame.
+ *
+ * @param rootViews The views to draw.
+ * @param screen The screen @c rootViews are displayed on.
+ * @param captureFrame The rectangle, in screen coordinates, to capture.
+ * @return An image of @c captureFrame at this policy's scale.
+ */
+- (UIImage *)gscx_screenshotOfRootViews:(NSArray<UIView *> *)rootViews
+                                 screen:(UIScreen *)screen
+                           captureFrame:(CGRect)captureFrame {
+  UIGraphicsImageRendererFormat *format = [UIGraphicsImageRendererFormat preferredFormat];
+  format.scale = self.scale > 0.0 ? self.scale : screen.scale;
+  format.opaque = YES;
+  UIGraphicsImageRenderer *renderer =
+      [[UIGraphicsImageRenderer alloc] initWithSize:captureFrame.size format:format];
+  return [renderer imageWithActions:^(UIGraphicsImageRendererContext *rendererContext) {
+    for (UIView *rootView in rootViews) {
+      CGRect frame = [rootView convertRect:rootView.bounds
+                         toCoordinateSpace:screen.coordinateSpace];
+      frame = CGRectOffset(frame, -CGRectGetMinX(captureFrame), -CGRectGetMinY(captureFrame));
+      [rootView drawViewHierarchyInRect:frame afterScreenUpdates:NO];
+    }
+  }];
+}
+
+/**
+ * Returns a blank image with @c size in points but very few pixels. Placeholders of the same size
+ * are shared.
+ *
+ * @param size The size of the placeholder, in points.
+ * @return A blank image of @c size.
+ */
++ (UIImage *)gscx_placeholderImageWithSize:(CGSize)size {
+  static NSCache<NSValue *, UIImage *> *placeholders;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    placeholders = [[NSCache alloc] init];
+  });
+  NSValue *key = [NSValue valueWithCGSize:size];
+  UIImage *placeholder = [placeholders objectForKey:key];
+  if (placeholder == nil) {
+    UIGraphicsImageRendererFormat *format = [UIGraphicsImageRendererFormat preferredFormat];
+    format.scale = kGSCXScreenshotCapturePolicyPlaceholderScale;
+    format.opaque = YES;
+    UIGraphicsImageRenderer *renderer = [[UIGraphicsImageRenderer alloc] initWithSize:size
+                                                                               format:format];
+    placeholder = [renderer imageWithActions:^(UIGraphicsImageRendererContext *rendererContext) {
+      [[UIColor blackColor] setFill];
+      [rendererContext fillRect:CGRectMake(0, 0, size.width, size.height)];
+    }];
+    [placeholders setObject:placeholder forKey:key];
+  }
+  return placeholder;
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,81 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import <UIKit/UIKit.h>
+
+#import <GTXiLib/GTXiLib.h>
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * The default maximum Hamming distance between the perceptual hashes of two screenshots considered
+ * the same.
+ */
+FOUNDATION_EXTERN const NSUInteger kGSCXScreenshotDeduplicatorDefaultMaximumHammingDistance;
+
+/**
+ * Invoked when a @c GSCXScreenshotDeduplicator instance has finished processing a result.
+ *
+ * @param result The original result if its screenshot is distinct from all retained screenshots.
+ *  Otherwise, an equivalent result sharing the matching retained screenshot.
+ */
+typedef void (^GSCXScreenshotDeduplicatorCompletionBlock)(GTXHierarchyResultCollection *result);
+
+/**
+ * Lets scan results with visually identical screenshots share a single image. Some applications
+ * change small parts of the screen, like timestamps or spinners, between every scan, so their view
+ * hierarchies differ even though the screenshots look the same. This object computes a perceptual
+ * difference hash (dHash) of each screenshot on a background queue. If a retained screenshot's hash
+ * is within @c maximumHammingDistance and the results have identical issues, the new result is
+ * rebuilt around the retained screenshot so only one copy is kept in memory. Screenshots are
+ * held weakly, so only screenshots still used by a result are shared, and the deduplicator never
+ * keeps one alive on its own.
+ */
+@interface GSCXScreenshotDeduplicator : NSObject
+
+/**
+ * The maximum number of differing bits between the hashes of two screenshots considered the same.
+ * Defaults to @c kGSCXScreenshotDeduplicatorDefaultMaximumHammingDistance.
+ */
+@property(assign, nonatomic) NSUInteger maximumHammingDistance;
+
+/**
+ * Hashes the screenshot of @c result on a background queue and compares it to retained
+ * screenshots. Invokes @c completion on the main queue.
+ *
+ * @param result The result whose screenshot should be deduplicated.
+ * @param completion Invoked on the main queue with the deduplicated result.
+ */
+- (void)deduplicateResult:(GTXHierarchyResultCollection *)result
+               completion:(GSCXScreenshotDeduplicatorCompletionBlock)completion;
+
+/**
+ * Forgets all retained screenshots. Results already being processed are compared against the
+ * screenshots retained after this call.
+ */
+- (void)reset;
+
+/**
+ * Computes the 64 bit difference hash of @c image. The image is downsampled to 9 by 8 grayscale
+ * pixels. Each bit is set if a pixel is brighter than its right neighbor.
+ *
+ * @param image The image to hash.
+ * @return The difference hash of @c image.
+ */
++ (uint64_t)differenceHashOfImage:(UIImage *)image;
+
+@end
+
+NS_ASSUME_NONNULL_END
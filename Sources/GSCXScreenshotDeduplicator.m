@@ -0,0 +1,238 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXScreenshotDeduplicator.h"
+
+#import "GSCXIssueDeduplicator.h"
+#import "GTXHierarchyResultCollection+GSCXCompleteness.h"
+#import "GTXHierarchyResultCollection+GSCXScreenshot.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+const NSUInteger kGSCXScreenshotDeduplicatorDefaultMaximumHammingDistance = 4;
+
+/**
+ * The width, in pixels, of the downsampled image a difference hash is computed from. One more than
+ * the height, so each row yields 8 comparisons.
+ */
+static const size_t kGSCXDifferenceHashWidth = 9;
+
+/**
+ * The height, in pixels, of the downsampled image a difference hash is computed from.
+ */
+static const size_t kGSCXDifferenceHashHeight = 8;
+
+/**
+ * The maximum number of screenshots tracked for comparison. The oldest are discarded first.
+ */
+static const NSUInteger kGSCXScreenshotDeduplicatorCapacity = 128;
+
+/**
+ * A screenshot tracked for comparison with later screenshots. Only the image is held weakly, so
+ * screenshots are released once no result uses them.
+ */
+@interface GSCXRetainedScreenshot : NSObject
+
+/**
+ * The difference hash of @c image.
+ */
+@property(assign, nonatomic) uint64_t differenceHash;
+
+/**
+ * The keys of all issues in the result @c image was captured for.
+ */
+@property(copy, nonatomic) NSSet<NSString *> *issueKeys;
+
+/**
+ * The tracked screenshot, or @c nil if every result using it has been released.
+ */
+@property(weak, nonatomic, nullable) UIImage *image;
+
+/**
+ * The size of @c image.
+ */
+@property(assign, nonatomic) CGSize imageSize;
+
+/**
+ * The rectangle, in screen coordinates, captured by @c image.
+ */
+@property(assign, nonatomic) CGRect imageFrame;
+
+@end
+
+@implementation GSCXRetainedScreenshot
+@end
+
+@interface GSCXScreenshotDeduplicator ()
+
+/**
+ * Serializes hashing and access to @c retainedScreenshots.
+ */
+@property(strong, nonatomic) dispatch_queue_t hashingQueue;
+
+/**
+ * The screenshots retained for comparison, from oldest to newest. Only accessed on
+ * @c hashingQueue.
+ */
+@property(strong, nonatomic) NSMutableArray<GSCXRetainedScreenshot *> *retainedScreenshots;
+
+@end
+
+@implementation GSCXScreenshotDeduplicator
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _maximumHammingDistance = kGSCXScreenshotDeduplicatorDefaultMaximumHammingDistance;
+    _hashingQueue = dispatch_queue_create("com.google.gscxscanner.screenshotdeduplicator",
+                                          DISPATCH_QUEUE_SERIAL);
+    _retainedScreenshots = [[NSMutableArray alloc] init];
+  }
+  return self;
+}
+
+- (void)deduplicateResult:(GTXHierarchyResultCollection *)result
+               completion:(GSCXScreenshotDeduplicatorCompletionBlock)completion {
+  NSUInteger maximumHammingDistance = self.maximumHammingDistance;
+  NSMutableArray<GSCXRetainedScreenshot *> *retainedScreenshots = self.retainedScreenshots;
+  dispatch_async(self.hashingQueue, ^{
+    GTXHierarchyResultCollection *deduplicatedResult =
+        [GSCXScreenshotDeduplicator gscx_deduplicateResult:result
+                                       retainedScreenshots:retainedScreenshots
+                                    maximumHammingDistance:maximumHammingDistance];
+    dispatch_async(dispatch_get_main_queue(), ^{
+      completion(deduplicatedResult);
+    });
+  });
+}
+
+- (void)reset {
+  NSMutableArray<GSCXRetainedScreenshot *> *retainedScreenshots = self.retainedScreenshots;
+  dispatch_async(self.hashingQueue, ^{
+    [retainedScreenshots removeAllObjects];
+  });
+}
+
++ (uint64_t)differenceHashOfImage:(UIImage *)image {
+  CGImageRef cgImage = image.CGImage;
+  if (cgImage == NULL) {
+    return 0;
+  }
+  uint8_t pixels[kGSCXDifferenceHashWidth * kGSCXDifferenceHashHeight] = {0};
+  CGColorSpaceRef colorSpace = CGColorSpaceCreateDeviceGray();
+  CGContextRef context =
+      CGBitmapContextCreate(pixels, kGSCXDifferenceHashWidth, kGSCXDifferenceHashHeight, 8,
+                            kGSCXDifferenceHashWidth, colorSpace, kCGImageAlphaNone);
+  CGColorSpaceRelease(colorSpace);
+  if (context == NULL) {
+    return 0;
+  }
+  CGContextSetInterpolationQuality(context, kCGInterpolationMedium);
+  CGContextDrawImage(context, CGRectMake(0, 0, kGSCXDifferenceHashWidth, kGSCXDifferenceHashHeight),
+                     cgImage);
+  CGContextRelease(context);
+  uint64_t hash = 0;
+  for (size_t y = 0; y < kGSCXDifferenceHashHeight; y++) {
+    for (size_t x = 0; x + 1 < kGSCXDifferenceHashWidth; x++) {
+      const uint8_t *row = pixels + y * kGSCXDifferenceHashWidth;
+      hash = (hash << 1) | (row[x] > row[x + 1] ? 1 : 0);
+    }
+  }
+  return hash;
+}
+
+#pragma mark - Private
+
+/**
+ * Compares the screenshot of @c result to @c retainedScreenshots. Must be called on the hashing
+ * queue.
+ *
+ * @param result The result whose screenshot should be deduplicated.
+ * @param retainedScreenshots The screenshots to compare to. The screenshot of @c result is added if
+ *  it does not match any of them.
+ * @param maximumHammingDistance The maximum number of differing bits for a match.
+ * @return @c result if no retained screenshot matches, or an equivalent result using the matching
+ *  retained screenshot.
+ */
++ (GTXHierarchyResultCollection *)
+    gscx_deduplicateResult:(GTXHierarchyResultCollection *)result
+       retainedScreenshots:(NSMutableArray<GSCXRetainedScreenshot *> *)retainedScreenshots
+    maximumHammingDistance:(NSUInteger)maximumHammingDistance {
+  uint64_t differenceHash = [GSCXScreenshotDeduplicator differenceHashOfImage:result.screenshot];
+  NSSet<NSString *> *issueKeys = [GSCXScreenshotDeduplicator gscx_issueKeysOfResult:result];
+  NSIndexSet *releasedIndexes = [retainedScreenshots
+      indexesOfObjectsPassingTest:^BOOL(GSCXRetainedScreenshot *retained, NSUInteger index,
+                                        BOOL *stop) {
+        return retained.image == nil;
+      }];
+  [retainedScreenshots removeObjectsAtIndexes:releasedIndexes];
+  for (GSCXRetainedScreenshot *retained in retainedScreenshots) {
+    // The image may be released on another thread at any time, so it is read once.
+    UIImage *image = retained.image;
+    if (image == nil) {
+      continue;
+    }
+    if (image == result.screenshot) {
+      return result;
+    }
+    NSUInteger distance =
+        (NSUInteger)__builtin_popcountll(retained.differenceHash ^ differenceHash);
+    if (distance <= maximumHammingDistance &&
+        CGRectEqualToRect(retained.imageFrame, result.gscx_screenshotFrame) &&
+        CGSizeEqualToSize(retained.imageSize, result.screenshot.size) &&
+        [retained.issueKeys isEqualToSet:issueKeys]) {
+      return [GTXHierarchyResultCollection
+          gscx_resultWithElementResults:result.elementResults
+                             screenshot:image
+                        screenshotFrame:retained.imageFrame
+                             incomplete:result.gscx_isIncomplete
+                    throttledCheckNames:result.gscx_throttledCheckNames];
+    }
+  }
+  GSCXRetainedScreenshot *retained = [[GSCXRetainedScreenshot alloc] init];
+  retained.differenceHash = differenceHash;
+  retained.issueKeys = issueKeys;
+  retained.image = result.screenshot;
+  retained.imageSize = result.screenshot.size;
+  retained.imageFrame = result.gscx_screenshotFrame;
+  [retainedScreenshots addObject:retained];
+  if (retainedScreenshots.count > kGSCXScreenshotDeduplicatorCapacity) {
+    [retainedScreenshots removeObjectAtIndex:0];
+  }
+  return result;
+}
+
+/**
+ * Returns the keys of all issues in @c result, as computed by @c GSCXIssueDeduplicator.
+ *
+ * @param result The result to compute the issue keys of.
+ * @return The set of issue keys in @c result.
+ */
++ (NSSet<NSString *> *)gscx_issueKeysOfResult:(GTXHierarchyResultCollection *)result {
+  NSMutableSet<NSString *> *issueKeys = [[NSMutableSet alloc] init];
+  for (GTXElementResultCollection *elementResult in result.elementResults) {
+    for (GTXCheckResult *checkResult in elementResult.checkResults) {
+      [issueKeys addObject:[GSCXIssueDeduplicator
+                               issueKeyForCheckResult:checkResult
+                                     elementReference:elementResult.elementReference]];
+    }
+  }
+  return issueKeys;
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
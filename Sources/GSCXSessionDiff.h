@@ -0,0 +1,138 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+#import "GSCXUniqueIssue.h"
+#import <GTXiLib/GTXiLib.h>
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * How an issue changed between two sessions.
+ */
+typedef NS_ENUM(NSInteger, GSCXSessionDiffChange) {
+  /**
+   * The issue only occurs in the compared session.
+   */
+  GSCXSessionDiffChangeAdded,
+
+  /**
+   * The issue only occurs in the base session.
+   */
+  GSCXSessionDiffChangeRemoved,
+
+  /**
+   * The issue occurs in both sessions.
+   */
+  GSCXSessionDiffChangeUnchanged,
+};
+
+/**
+ * The differences between the issues found in two sessions of scans, such as continuous scans of
+ * two builds of an application. Issues are matched by their @c GSCXBaseline fingerprint, which does
+ * not depend on the scan or the device, so sessions of different lengths or screen sizes can be
+ * compared. Each session is hashed once, so computing a diff is linear in the number of issues.
+ */
+@interface GSCXSessionDiff : NSObject
+
+/**
+ * Issues found in the compared session but not the base session, ordered by when they were first
+ * seen in the compared session.
+ */
+@property(copy, nonatomic, readonly) NSArray<GSCXUniqueIssue *> *addedIssues;
+
+/**
+ * Issues found in the base session but not the compared session, ordered by when they were first
+ * seen in the base session.
+ */
+@property(copy, nonatomic, readonly) NSArray<GSCXUniqueIssue *> *removedIssues;
+
+/**
+ * Issues found in both sessions, ordered by when they were first seen in the compared session.
+ * Each issue refers to its first occurrence in the compared session.
+ */
+@property(copy, nonatomic, readonly) NSArray<GSCXUniqueIssue *> *unchangedIssues;
+
+/**
+ * The results of the earlier session.
+ */
+@property(strong, nonatomic, readonly) NSArray<GTXHierarchyResultCollection *> *baseResults;
+
+/**
+ * The results of the later session.
+ */
+@property(strong, nonatomic, readonly) NSArray<GTXHierarchyResultCollection *> *comparedResults;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Compares the issues in two sessions. Either session may be the live results of a continuous scan
+ * or a session read back from disk. May be called on any thread.
+ *
+ * @param baseResults The results of the earlier session.
+ * @param comparedResults The results of the later session.
+ * @return The differences between @c baseResults and @c comparedResults.
+ */
++ (instancetype)diffWithBaseResults:(NSArray<GTXHierarchyResultCollection *> *)baseResults
+                    comparedResults:(NSArray<GTXHierarchyResultCollection *> *)comparedResults;
+
+/**
+ * @param change The kind of change.
+ * @return @c addedIssues, @c removedIssues or @c unchangedIssues.
+ */
+- (NSArray<GSCXUniqueIssue *> *)issuesWithChange:(GSCXSessionDiffChange)change;
+
+/**
+ * @param change The kind of change.
+ * @return The results the issues with @c change were found in: @c baseResults for removed issues,
+ *  @c comparedResults otherwise. The scan indexes of the issues index into these results.
+ */
+- (NSArray<GTXHierarchyResultCollection *> *)resultsContainingIssuesWithChange:
+    (GSCXSessionDiffChange)change;
+
+/**
+ * Groups the issues with @c change by the name of the failing check.
+ *
+ * @param change The kind of change.
+ * @return The issues with @c change keyed by check name, each ordered by when it was first seen.
+ */
+- (NSDictionary<NSString *, NSArray<GSCXUniqueIssue *> *> *)issuesByCheckNameWithChange:
+    (GSCXSessionDiffChange)change;
+
+/**
+ * Groups the issues with @c change by the screen they were first seen on. Scans of the base session
+ * for removed issues, or of the compared session otherwise, are clustered into screens with
+ * @c GSCXScreenClusterer, so repeated scans of the same screen form a single group.
+ *
+ * @param change The kind of change.
+ * @return The issues with @c change keyed by screen index, in the order screens were first seen,
+ *  each ordered by when it was first seen.
+ */
+- (NSDictionary<NSNumber *, NSArray<GSCXUniqueIssue *> *> *)issuesByScreenIndexWithChange:
+    (GSCXSessionDiffChange)change;
+
+/**
+ * Constructs scan results containing the first occurrence of each issue with @c change, suitable
+ * for @c GSCXReport.
+ *
+ * @param change The kind of change.
+ * @return The scan results containing the issues with @c change, in scan order.
+ */
+- (NSArray<GTXHierarchyResultCollection *> *)resultsWithChange:(GSCXSessionDiffChange)change;
+
+@end
+
+NS_ASSUME_NONNULL_END
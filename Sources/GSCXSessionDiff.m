@@ -0,0 +1,181 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXSessionDiff.h"
+
+#import "GSCXBaseline.h"
+#import "GSCXIssueDeduplicator.h"
+#import "GSCXScreenClusterer.h"
+#import "GSCXScreenFingerprint.h"
+#import "NSArray+GSCXResults.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@implementation GSCXSessionDiff
+
+- (instancetype)initWithBaseResults:(NSArray<GTXHierarchyResultCollection *> *)baseResults
+                    comparedResults:(NSArray<GTXHierarchyResultCollection *> *)comparedResults
+                        addedIssues:(NSArray<GSCXUniqueIssue *> *)addedIssues
+                      removedIssues:(NSArray<GSCXUniqueIssue *> *)removedIssues
+                    unchangedIssues:(NSArray<GSCXUniqueIssue *> *)unchangedIssues {
+  self = [super init];
+  if (self) {
+    _baseResults = baseResults;
+    _comparedResults = comparedResults;
+    _addedIssues = [addedIssues copy];
+    _removedIssues = [removedIssues copy];
+    _unchangedIssues = [unchangedIssues copy];
+  }
+  return self;
+}
+
++ (instancetype)diffWithBaseResults:(NSArray<GTXHierarchyResultCollection *> *)baseResults
+                    comparedResults:(NSArray<GTXHierarchyResultCollection *> *)comparedResults {
+  NSMutableDictionary<NSString *, GSCXUniqueIssue *> *baseIssuesByKey =
+      [[NSMutableDictionary alloc] init];
+  NSMutableDictionary<NSString *, GSCXUniqueIssue *> *comparedIssuesByKey =
+      [[NSMutableDictionary alloc] init];
+  NSArray<GSCXUniqueIssue *> *baseIssues = [self gscx_uniqueIssuesInResults:baseResults
+                                                                  issuesByKey:baseIssuesByKey];
+  NSArray<GSCXUniqueIssue *> *comparedIssues =
+      [self gscx_uniqueIssuesInResults:comparedResults issuesByKey:comparedIssuesByKey];
+  NSMutableArray<GSCXUniqueIssue *> *addedIssues = [[NSMutableArray alloc] init];
+  NSMutableArray<GSCXUniqueIssue *> *removedIssues = [[NSMutableArray alloc] init];
+  NSMutableArray<GSCXUniqueIssue *> *unchangedIssues = [[NSMutableArray alloc] init];
+  for (GSCXUniqueIssue *issue in comparedIssues) {
+    if (baseIssuesByKey[issue.issueKey] == nil) {
+      [addedIssues addObject:issue];
+    } else {
+      [unchangedIssues addObject:issue];
+    }
+  }
+  for (GSCXUniqueIssue *issue in baseIssues) {
+    if (comparedIssuesByKey[issue.issueKey] == nil) {
+      [removedIssues addObject:issue];
+    }
+  }
+  return [[GSCXSessionDiff alloc] initWithBaseResults:baseResults
+                                      comparedResults:comparedResults
+                                          addedIssues:addedIssues
+                                        removedIssues:removedIssues
+                                      unchangedIssues:unchangedIssues];
+}
+
+- (NSArray<GSCXUniqueIssue *> *)issuesWithChange:(GSCXSessionDiffChange)change {
+  switch (change) {
+    case GSCXSessionDiffChangeAdded:
+      return self.addedIssues;
+    case GSCXSessionDiffChangeRemoved:
+      return self.removedIssues;
+    case GSCXSessionDiffChangeUnchanged:
+      return self.unchangedIssues;
+  }
+}
+
+- (NSArray<GTXHierarchyResultCollection *> *)resultsContainingIssuesWithChange:
+    (GSCXSessionDiffChange)change {
+  return change == GSCXSessionDiffChangeRemoved ? self.baseResults : self.comparedResults;
+}
+
+- (NSDictionary<NSString *, NSArray<GSCXUniqueIssue *> *> *)issuesByCheckNameWithChange:
+    (GSCXSessionDiffChange)change {
+  NSMutableDictionary<NSString *, NSMutableArray<GSCXUniqueIssue *> *> *issuesByCheckName =
+      [[NSMutableDictionary alloc] init];
+  for (GSCXUniqueIssue *issue in [self issuesWithChange:change]) {
+    if (issuesByCheckName[issue.checkName] == nil) {
+      issuesByCheckName[issue.checkName] = [[NSMutableArray alloc] init];
+    }
+    [issuesByCheckName[issue.checkName] addObject:issue];
+  }
+  return issuesByCheckName;
+}
+
+- (NSDictionary<NSNumber *, NSArray<GSCXUniqueIssue *> *> *)issuesByScreenIndexWithChange:
+    (GSCXSessionDiffChange)change {
+  NSArray<GTXHierarchyResultCollection *> *results =
+      [self resultsContainingIssuesWithChange:change];
+  GSCXScreenClusterer *clusterer = [[GSCXScreenClusterer alloc] init];
+  NSMutableArray<NSNumber *> *screenIndexes = [[NSMutableArray alloc] init];
+  for (NSUInteger scanIndex = 0; scanIndex < results.count; scanIndex++) {
+    GSCXScreenFingerprint *fingerprint = [GSCXScreenFingerprint
+        fingerprintWithElementResults:[results gscx_elementResultsOfResultAtIndex:scanIndex]];
+    [screenIndexes addObject:@([clusterer screenIndexForFingerprint:fingerprint])];
+  }
+  NSMutableDictionary<NSNumber *, NSMutableArray<GSCXUniqueIssue *> *> *issuesByScreenIndex =
+      [[NSMutableDictionary alloc] init];
+  for (GSCXUniqueIssue *issue in [self issuesWithChange:change]) {
+    GTX_ASSERT(issue.firstSeenScanIndex < screenIndexes.count,
+               @"results does not contain this issue.");
+    NSNumber *screenIndex = screenIndexes[issue.firstSeenScanIndex];
+    if (issuesByScreenIndex[screenIndex] == nil) {
+      issuesByScreenIndex[screenIndex] = [[NSMutableArray alloc] init];
+    }
+    [issuesByScreenIndex[screenIndex] addObject:issue];
+  }
+  return issuesByScreenIndex;
+}
+
+- (NSArray<GTXHierarchyResultCollection *> *)resultsWithChange:(GSCXSessionDiffChange)change {
+  return [GSCXIssueDeduplicator
+      resultsWithUniqueIssues:[self issuesWithChange:change]
+                    inResults:[self resultsContainingIssuesWithChange:change]];
+}
+
+#pragma mark - Private
+
+/**
+ * Collapses the issues in a session into unique issues keyed by their @c GSCXBaseline fingerprint.
+ * Only element results are read, so results that are decoded on access, like those of a
+ * @c GSCXMappedSession, do not load their screenshots.
+ *
+ * @param results The results of the session, in scan order.
+ * @param issuesByKey Populated with the unique issues keyed by fingerprint.
+ * @return The unique issues in @c results, ordered by when they were first seen.
+ */
++ (NSArray<GSCXUniqueIssue *> *)
+    gscx_uniqueIssuesInResults:(NSArray<GTXHierarchyResultCollection *> *)results
+                   issuesByKey:(NSMutableDictionary<NSString *, GSCXUniqueIssue *> *)issuesByKey {
+  NSMutableArray<GSCXUniqueIssue *> *uniqueIssues = [[NSMutableArray alloc] init];
+  for (NSUInteger scanIndex = 0; scanIndex < results.count; scanIndex++) {
+    NSInteger elementIndex = 0;
+    for (GTXElementResultCollection *elementResult in
+         [results gscx_elementResultsOfResultAtIndex:scanIndex]) {
+      for (GTXCheckResult *checkResult in elementResult.checkResults) {
+        NSString *issueKey =
+            [GSCXBaseline fingerprintForCheckResult:checkResult
+                                   elementReference:elementResult.elementReference];
+        GSCXUniqueIssue *issue = issuesByKey[issueKey];
+        if (issue != nil) {
+          [issue addOccurrenceAtScanIndex:scanIndex];
+          continue;
+        }
+        issue = [[GSCXUniqueIssue alloc] initWithIssueKey:issueKey
+                                              checkResult:checkResult
+                                 originalElementReference:elementResult.elementReference
+                                     originalElementIndex:elementIndex
+                                                scanIndex:scanIndex];
+        issuesByKey[issueKey] = issue;
+        [uniqueIssues addObject:issue];
+      }
+      elementIndex++;
+    }
+  }
+  return uniqueIssues;
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,195 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import <UIKit/UIKit.h>
+
+#import <GTXiLib/GTXiLib.h>
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * The error domain of errors reading or writing session journals.
+ */
+FOUNDATION_EXTERN NSErrorDomain const kGSCXSessionJournalErrorDomain;
+
+/**
+ * The extension of session directories created by @c GSCXSessionJournal.
+ */
+FOUNDATION_EXTERN NSString *const kGSCXSessionJournalSessionExtension;
+
+/**
+ * The number of records written between forced syncs to disk.
+ */
+FOUNDATION_EXTERN const NSUInteger kGSCXSessionJournalSyncRecordInterval;
+
+/**
+ * The maximum number of sessions kept in a directory. Creating a session removes the oldest
+ * sessions beyond this count.
+ */
+FOUNDATION_EXTERN const NSUInteger kGSCXSessionJournalMaximumSessionCount;
+
+/**
+ * Error codes in @c kGSCXSessionJournalErrorDomain.
+ */
+typedef NS_ENUM(NSInteger, GSCXSessionJournalErrorCode) {
+  /**
+   * The session directory or journal file could not be created.
+   */
+  GSCXSessionJournalErrorCodeCreationFailed = 1,
+
+  /**
+   * The journal file is missing or is not a session journal.
+   */
+  GSCXSessionJournalErrorCodeInvalidJournal,
+};
+
+/**
+ * Invoked once per valid record when enumerating a session's journal.
+ *
+ * @param isReplacement @c YES if the record replaces the result at @c index, @c NO if it appends a
+ *  result to the end of the session.
+ * @param index The index of the replaced result. Undefined for append records.
+ * @param screenshotFileName The name of the file in the session directory containing the
+ *  screenshot of the recorded result.
+ * @param screenshotScale The scale of the screenshot.
+ * @param screenshotFrame The rectangle, in screen coordinates, captured by the screenshot.
+ * @param incomplete @c YES if the scan producing the recorded result did not check every element.
+ * @param throttledCheckNames The names of checks throttled in the scan producing the recorded
+ *  result.
+ * @param elementResults The element results of the recorded result.
+ */
+typedef void (^GSCXSessionJournalRecordBlock)(
+    BOOL isReplacement, NSUInteger index, NSString *screenshotFileName, CGFloat screenshotScale,
+    CGRect screenshotFrame, BOOL incomplete, NSArray<NSString *> *throttledCheckNames,
+    NSArray<GTXElementResultCollection *> *elementResults);
+
+/**
+ * Writes continuous scan results to disk as they are found, so a session survives the host
+ * application crashing or being killed. Each session is a directory containing an append-only
+ * journal of binary records, one per added or replaced result, and one PNG file per distinct
+ * screenshot. Screenshots are written and synced before the records referring to them. Encoding
+ * and writing happen on a background queue, and the journal is synced to disk every
+ * @c kGSCXSessionJournalSyncRecordInterval records. Records torn by a crash are detected by their
+ * checksums and ignored when the session is read back. If a screenshot or record cannot be written,
+ * no further records are written, since sessions are only read back up to the first missing
+ * record.
+ */
+@interface GSCXSessionJournal : NSObject
+
+/**
+ * The directory containing this session's journal and screenshots.
+ */
+@property(strong, nonatomic, readonly) NSURL *sessionURL;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Creates a new, empty session in @c directory. Sessions beyond the most recent
+ * @c kGSCXSessionJournalMaximumSessionCount, including the new one, are removed in the background.
+ *
+ * @param directory The directory to create the session in. Created if it does not exist.
+ * @param error Set if the session cannot be created.
+ * @return A journal writing to the new session, or @c nil if it could not be created.
+ */
++ (nullable instancetype)journalInDirectory:(NSURL *)directory error:(NSError **)error;
+
+/**
+ * Appends a record adding @c result to the end of the session. Must be called on the main thread.
+ *
+ * @param result The result to add.
+ */
+- (void)appendResult:(GTXHierarchyResultCollection *)result;
+
+/**
+ * Appends a record replacing the result at @c index with @c result. Must be called on the main
+ * thread.
+ *
+ * @param index The index of the result to replace.
+ * @param result The new result.
+ */
+- (void)replaceResultAtIndex:(NSUInteger)index withResult:(GTXHierarchyResultCollection *)result;
+
+/**
+ * Syncs all pending records to disk, then invokes @c completion on the main queue.
+ *
+ * @param completion Invoked after the records are synced. Optional.
+ */
+- (void)synchronizeWithCompletion:(nullable void (^)(void))completion;
+
+/**
+ * @return The default directory sessions are stored in, inside the application's Application
+ *  Support directory.
+ */
++ (NSURL *)defaultDirectory;
+
+/**
+ * Finds the most recently created session in @c directory.
+ *
+ * @param directory The directory containing sessions.
+ * @return The URL of the most recent session, or @c nil if @c directory contains no sessions.
+ */
++ (nullable NSURL *)latestSessionInDirectory:(NSURL *)directory;
+
+/**
+ * Finds all sessions in @c directory.
+ *
+ * @param directory The directory containing sessions.
+ * @return The URLs of the sessions in @c directory, from oldest to most recent.
+ */
++ (NSArray<NSURL *> *)sessionsInDirectory:(NSURL *)directory;
+
+/**
+ * Removes all but the most recent @c count sessions in @c directory. May be called on any thread.
+ *
+ * @param directory The directory containing sessions.
+ * @param count The number of most recent sessions to keep.
+ */
++ (void)removeSessionsInDirectory:(NSURL *)directory keepingLatestCount:(NSUInteger)count;
+
+/**
+ * Reads back the results of the session at @c sessionURL. Replays records in order, stopping at the
+ * first incomplete or corrupt record. May be called on any thread.
+ *
+ * @param sessionURL The session directory to read.
+ * @param error Set if the session cannot be read.
+ * @return The results of the session, or @c nil if it could not be read.
+ */
++ (nullable NSArray<GTXHierarchyResultCollection *> *)resultsOfSessionAtURL:(NSURL *)sessionURL
+                                                                      error:(NSError **)error;
+
+/**
+ * Enumerates the records of the session at @c sessionURL in order, stopping at the first incomplete
+ * or corrupt record. Unlike @c resultsOfSessionAtURL:error:, screenshots are not loaded. May be
+ * called on any thread.
+ *
+ * @param sessionURL The session directory to read.
+ * @param block Invoked once per valid record.
+ * @param error Set if the session cannot be read.
+ * @return The number of journal bytes holding valid records, including the file header, or @c 0 if
+ *  the session could not be read.
+ */
++ (NSUInteger)enumerateRecordsOfSessionAtURL:(NSURL *)sessionURL
+                                  usingBlock:(GSCXSessionJournalRecordBlock)block
+                                       error:(NSError **)error;
+
+/**
+ * @param sessionURL A session directory.
+ * @return The URL of the journal file in the session at @c sessionURL.
+ */
++ (NSURL *)journalURLOfSessionAtURL:(NSURL *)sessionURL;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,683 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXSessionJournal.h"
+
+#import <QuartzCore/QuartzCore.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#import "GTXHierarchyResultCollection+GSCXCompleteness.h"
+#import "GTXHierarchyResultCollection+GSCXScreenshot.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+NSErrorDomain const kGSCXSessionJournalErrorDomain = @"com.google.gscxscanner.sessionjournal";
+
+NSString *const kGSCXSessionJournalSessionExtension = @"gscxsession";
+
+const NSUInteger kGSCXSessionJournalSyncRecordInterval = 8;
+
+const NSUInteger kGSCXSessionJournalMaximumSessionCount = 16;
+
+/**
+ * The maximum time, in seconds, records are kept in the operating system's buffers before being
+ * synced to disk, regardless of how many records were written.
+ */
+static const CFTimeInterval kGSCXSessionJournalSyncTimeInterval = 2.0;
+
+/**
+ * The name of the journal file in a session directory.
+ */
+static NSString *const kGSCXSessionJournalFileName = @"journal.bin";
+
+/**
+ * The bytes at the start of every journal file. The last character is the format version.
+ */
+static const char kGSCXSessionJournalMagic[8] = {'G', 'S', 'C', 'X', 'J', 'R', 'N', '2'};
+
+/**
+ * The format version of journals written before records stored completeness and throttled checks.
+ * Such journals are still read, and their results are complete and have no throttled checks.
+ */
+static const char kGSCXSessionJournalVersion1 = '1';
+
+/**
+ * The length written in place of a @c nil string's length.
+ */
+static const uint32_t kGSCXSessionJournalNilStringLength = UINT32_MAX;
+
+/**
+ * The kinds of records in a journal.
+ */
+typedef NS_ENUM(uint8_t, GSCXSessionJournalRecordType) {
+  /**
+   * Adds a result to the end of the session.
+   */
+  GSCXSessionJournalRecordTypeAppend = 0,
+
+  /**
+   * Replaces an existing result in the session.
+   */
+  GSCXSessionJournalRecordTypeReplace,
+};
+
+/**
+ * The position of a reader within a journal.
+ */
+typedef struct {
+  const uint8_t *bytes;
+  NSUInteger length;
+  NSUInteger offset;
+} GSCXSessionJournalCursor;
+
+#pragma mark - Writing
+
+/**
+ * Writes all @c length bytes at @c bytes to @c fileDescriptor, retrying partial and interrupted
+ * writes.
+ *
+ * @return @c YES if every byte was written, @c NO if writing failed.
+ */
+static BOOL GSCXSessionJournalWriteAll(int fileDescriptor, const void *bytes, size_t length) {
+  const uint8_t *remainingBytes = (const uint8_t *)bytes;
+  while (length > 0) {
+    ssize_t written = write(fileDescriptor, remainingBytes, length);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return NO;
+    }
+    remainingBytes += written;
+    length -= (size_t)written;
+  }
+  return YES;
+}
+
+/**
+ * Writes @c data to a new file at @c path and syncs it to disk.
+ *
+ * @return @c YES if the file was written and synced, @c NO otherwise.
+ */
+static BOOL GSCXSessionJournalWriteFile(NSData *_Nullable data, NSString *path) {
+  if (data == nil) {
+    return NO;
+  }
+  int fileDescriptor =
+      open(path.fileSystemRepresentation, O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
+  if (fileDescriptor < 0) {
+    return NO;
+  }
+  BOOL succeeded = GSCXSessionJournalWriteAll(fileDescriptor, data.bytes, data.length) &&
+                   fsync(fileDescriptor) == 0;
+  close(fileDescriptor);
+  return succeeded;
+}
+
+#pragma mark - Encoding
+
+/**
+ * Computes the 32 bit FNV-1a hash of @c length bytes at @c bytes, used to detect torn records.
+ */
+static uint32_t GSCXSessionJournalChecksum(const uint8_t *bytes, NSUInteger length) {
+  uint32_t hash = 2166136261u;
+  for (NSUInteger i = 0; i < length; i++) {
+    hash ^= bytes[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+static void GSCXSessionJournalAppendUInt32(NSMutableData *data, uint32_t value) {
+  [data appendBytes:&value length:sizeof(value)];
+}
+
+static void GSCXSessionJournalAppendUInt64(NSMutableData *data, uint64_t value) {
+  [data appendBytes:&value length:sizeof(value)];
+}
+
+static void GSCXSessionJournalAppendDouble(NSMutableData *data, double value) {
+  [data appendBytes:&value length:sizeof(value)];
+}
+
+static void GSCXSessionJournalAppendRect(NSMutableData *data, CGRect rect) {
+  GSCXSessionJournalAppendDouble(data, rect.origin.x);
+  GSCXSessionJournalAppendDouble(data, rect.origin.y);
+  GSCXSessionJournalAppendDouble(data, rect.size.width);
+  GSCXSessionJournalAppendDouble(data, rect.size.height);
+}
+
+static void GSCXSessionJournalAppendString(NSMutableData *data, NSString *_Nullable string) {
+  if (string == nil) {
+    GSCXSessionJournalAppendUInt32(data, kGSCXSessionJournalNilStringLength);
+    return;
+  }
+  NSData *bytes = [string dataUsingEncoding:NSUTF8StringEncoding];
+  GSCXSessionJournalAppendUInt32(data, (uint32_t)bytes.length);
+  [data appendData:bytes];
+}
+
+#pragma mark - Decoding
+
+static BOOL GSCXSessionJournalReadBytes(GSCXSessionJournalCursor *cursor, void *value,
+                                        NSUInteger length) {
+  if (cursor->length - cursor->offset < length) {
+    return NO;
+  }
+  memcpy(value, cursor->bytes + cursor->offset, length);
+  cursor->offset += length;
+  return YES;
+}
+
+static BOOL GSCXSessionJournalReadRect(GSCXSessionJournalCursor *cursor, CGRect *rect) {
+  double values[4];
+  if (!GSCXSessionJournalReadBytes(cursor, values, sizeof(values))) {
+    return NO;
+  }
+  *rect = CGRectMake(values[0], values[1], values[2], values[3]);
+  return YES;
+}
+
+static BOOL GSCXSessionJournalReadString(GSCXSessionJournalCursor *cursor,
+                                         NSString *_Nullable *_Nonnull string) {
+  uint32_t length;
+  if (!GSCXSessionJournalReadBytes(cursor, &length, sizeof(length))) {
+    return NO;
+  }
+  if (length == kGSCXSessionJournalNilStringLength) {
+    *string = nil;
+    return YES;
+  }
+  if (cursor->length - cursor->offset < length) {
+    return NO;
+  }
+  *string = [[NSString alloc] initWithBytes:cursor->bytes + cursor->offset
+                                     length:length
+                                   encoding:NSUTF8StringEncoding];
+  cursor->offset += length;
+  return *string != nil;
+}
+
+@interface GSCXSessionJournal ()
+
+/**
+ * Serializes writes to the journal file and screenshots.
+ */
+@property(strong, nonatomic) dispatch_queue_t writingQueue;
+
+/**
+ * The file descriptor of the open journal file. Only accessed on @c writingQueue.
+ */
+@property(assign, nonatomic) int fileDescriptor;
+
+/**
+ * The number of records written since the journal was last synced. Only accessed on
+ * @c writingQueue.
+ */
+@property(assign, nonatomic) NSUInteger unsyncedRecordCount;
+
+/**
+ * The time the journal was last synced. Only accessed on @c writingQueue.
+ */
+@property(assign, nonatomic) CFTimeInterval lastSyncTime;
+
+/**
+ * @c YES if a screenshot or record could not be written. Sessions are only read back up to the
+ * first missing record, so later records are dropped. Only accessed on @c writingQueue.
+ */
+@property(assign, nonatomic) BOOL writingFailed;
+
+/**
+ * The file names of screenshots already written, keyed by screenshot. Screenshots shared by
+ * several results are only written once. Only accessed on the main thread.
+ */
+@property(strong, nonatomic) NSMapTable<UIImage *, NSString *> *screenshotFileNames;
+
+/**
+ * The number of screenshots written, used to name screenshot files. Only accessed on the main
+ * thread.
+ */
+@property(assign, nonatomic) NSUInteger screenshotCount;
+
+@end
+
+@implementation GSCXSessionJournal
+
+- (instancetype)initWithSessionURL:(NSURL *)sessionURL fileDescriptor:(int)fileDescriptor {
+  self = [super init];
+  if (self) {
+    _sessionURL = sessionURL;
+    _fileDescriptor = fileDescriptor;
+    _writingQueue =
+        dispatch_queue_create("com.google.gscxscanner.sessionjournal", DISPATCH_QUEUE_SERIAL);
+    _lastSyncTime = CACurrentMediaTime();
+    _screenshotFileNames = [NSMapTable weakToStrongObjectsMapTable];
+  }
+  return self;
+}
+
+- (void)dealloc {
+  int fileDescriptor = _fileDescriptor;
+  dispatch_async(_writingQueue, ^{
+    fsync(fileDescriptor);
+    close(fileDescriptor);
+  });
+}
+
++ (nullable instancetype)journalInDirectory:(NSURL *)directory error:(NSError **)error {
+  NSDateFormatter *formatter = [[NSDateFormatter alloc] init];
+  formatter.locale = [NSLocale localeWithLocaleIdentifier:@"en_US_POSIX"];
+  formatter.timeZone = [NSTimeZone timeZoneForSecondsFromGMT:0];
+  formatter.dateFormat = @"yyyyMMdd-HHmmss-SSS";
+  // Session names sort chronologically, so the latest session can be found without reading them.
+  NSString *sessionName =
+      [NSString stringWithFormat:@"%@-%@", [formatter stringFromDate:[NSDate date]],
+                                 [[NSUUID UUID].UUIDString substringToIndex:8]];
+  NSURL *sessionURL = [[directory URLByAppendingPathComponent:sessionName isDirectory:YES]
+      URLByAppendingPathExtension:kGSCXSessionJournalSessionExtension];
+  if (![[NSFileManager defaultManager] createDirectoryAtURL:sessionURL
+                                withIntermediateDirectories:YES
+                                                 attributes:nil
+                                                      error:error]) {
+    return nil;
+  }
+  NSString *journalPath = [sessionURL URLByAppendingPathComponent:kGSCXSessionJournalFileName].path;
+  int fileDescriptor = open(journalPath.fileSystemRepresentation, O_WRONLY | O_CREAT | O_APPEND,
+                            S_IRUSR | S_IWUSR);
+  if (fileDescriptor < 0 ||
+      !GSCXSessionJournalWriteAll(fileDescriptor, kGSCXSessionJournalMagic,
+                                  sizeof(kGSCXSessionJournalMagic))) {
+    if (fileDescriptor >= 0) {
+      close(fileDescriptor);
+    }
+    if (error != NULL) {
+      *error = [NSError errorWithDomain:kGSCXSessionJournalErrorDomain
+                                   code:GSCXSessionJournalErrorCodeCreationFailed
+                               userInfo:@{
+                                 NSLocalizedDescriptionKey : @"Could not create session journal.",
+                                 NSFilePathErrorKey : journalPath
+                               }];
+    }
+    return nil;
+  }
+  GSCXSessionJournal *journal = [[GSCXSessionJournal alloc] initWithSessionURL:sessionURL
+                                                                fileDescriptor:fileDescriptor];
+  dispatch_async(journal.writingQueue, ^{
+    [GSCXSessionJournal removeSessionsInDirectory:directory
+                               keepingLatestCount:kGSCXSessionJournalMaximumSessionCount];
+  });
+  return journal;
+}
+
+- (void)appendResult:(GTXHierarchyResultCollection *)result {
+  [self gscx_writeRecordWithType:GSCXSessionJournalRecordTypeAppend index:0 result:result];
+}
+
+- (void)replaceResultAtIndex:(NSUInteger)index withResult:(GTXHierarchyResultCollection *)result {
+  [self gscx_writeRecordWithType:GSCXSessionJournalRecordTypeReplace index:index result:result];
+}
+
+- (void)synchronizeWithCompletion:(nullable void (^)(void))completion {
+  dispatch_async(self.writingQueue, ^{
+    [self gscx_sync];
+    if (completion != nil) {
+      dispatch_async(dispatch_get_main_queue(), completion);
+    }
+  });
+}
+
++ (NSURL *)defaultDirectory {
+  NSURL *applicationSupportURL =
+      [[NSFileManager defaultManager] URLsForDirectory:NSApplicationSupportDirectory
+                                             inDomains:NSUserDomainMask]
+          .firstObject;
+  return [applicationSupportURL URLByAppendingPathComponent:@"GSCXScanner/Sessions"
+                                                isDirectory:YES];
+}
+
++ (nullable NSURL *)latestSessionInDirectory:(NSURL *)directory {
+  return [[GSCXSessionJournal sessionsInDirectory:directory] lastObject];
+}
+
++ (NSArray<NSURL *> *)sessionsInDirectory:(NSURL *)directory {
+  NSArray<NSURL *> *contents =
+      [[NSFileManager defaultManager] contentsOfDirectoryAtURL:directory
+                                    includingPropertiesForKeys:nil
+                                                       options:0
+                                                         error:nil];
+  NSMutableArray<NSURL *> *sessionURLs = [[NSMutableArray alloc] init];
+  for (NSURL *url in contents) {
+    if ([url.pathExtension isEqualToString:kGSCXSessionJournalSessionExtension]) {
+      [sessionURLs addObject:url];
+    }
+  }
+  // Session names begin with their creation time, so they sort chronologically.
+  [sessionURLs sortUsingComparator:^NSComparisonResult(NSURL *url1, NSURL *url2) {
+    return [url1.lastPathComponent compare:url2.lastPathComponent];
+  }];
+  return sessionURLs;
+}
+
++ (void)removeSessionsInDirectory:(NSURL *)directory keepingLatestCount:(NSUInteger)count {
+  NSArray<NSURL *> *sessionURLs = [GSCXSessionJournal sessionsInDirectory:directory];
+  if (sessionURLs.count <= count) {
+    return;
+  }
+  for (NSUInteger i = 0; i < sessionURLs.count - count; i++) {
+    [[NSFileManager defaultManager] removeItemAtURL:sessionURLs[i] error:nil];
+  }
+}
+
++ (nullable NSArray<GTXHierarchyResultCollection *> *)resultsOfSessionAtURL:(NSURL *)sessionURL
+                                                                      error:(NSError **)error {
+  NSMutableArray<GTXHierarchyResultCollection *> *results = [[NSMutableArray alloc] init];
+  NSMutableDictionary<NSString *, UIImage *> *screenshots = [[NSMutableDictionary alloc] init];
+  __block BOOL replayStopped = NO;
+  GSCXSessionJournalRecordBlock block = ^(BOOL isReplacement, NSUInteger index,
+                                          NSString *screenshotFileName, CGFloat screenshotScale,
+                                          CGRect screenshotFrame, BOOL incomplete,
+                                          NSArray<NSString *> *throttledCheckNames,
+                                          NSArray<GTXElementResultCollection *> *elementResults) {
+    if (replayStopped || (isReplacement && index >= results.count)) {
+      replayStopped = YES;
+      return;
+    }
+    UIImage *screenshot = screenshots[screenshotFileName];
+    if (screenshot == nil) {
+      NSURL *screenshotURL = [sessionURL URLByAppendingPathComponent:screenshotFileName];
+      NSData *screenshotData = [NSData dataWithContentsOfURL:screenshotURL];
+      if (screenshotData != nil) {
+        screenshot = [UIImage imageWithData:screenshotData scale:screenshotScale];
+      }
+      if (screenshot == nil) {
+        // Later records may replace this one, so they cannot be replayed either.
+        replayStopped = YES;
+        return;
+      }
+      screenshots[screenshotFileName] = screenshot;
+    }
+    GTXHierarchyResultCollection *result =
+        [GTXHierarchyResultCollection gscx_resultWithElementResults:elementResults
+                                                         screenshot:screenshot
+                                                    screenshotFrame:screenshotFrame
+                                                         incomplete:incomplete
+                                                throttledCheckNames:throttledCheckNames];
+    if (isReplacement) {
+      results[index] = result;
+    } else {
+      [results addObject:result];
+    }
+  };
+  NSUInteger validLength = [GSCXSessionJournal enumerateRecordsOfSessionAtURL:sessionURL
+                                                                   usingBlock:block
+                                                                        error:error];
+  return validLength > 0 ? results : nil;
+}
+
++ (NSUInteger)enumerateRecordsOfSessionAtURL:(NSURL *)sessionURL
+                                  usingBlock:(GSCXSessionJournalRecordBlock)block
+                                       error:(NSError **)error {
+  NSURL *journalURL = [GSCXSessionJournal journalURLOfSessionAtURL:sessionURL];
+  NSData *journal = [NSData dataWithContentsOfURL:journalURL
+                                          options:NSDataReadingMappedIfSafe
+                                            error:error];
+  if (journal == nil) {
+    return 0;
+  }
+  const NSUInteger versionOffset = sizeof(kGSCXSessionJournalMagic) - 1;
+  char version = journal.length < sizeof(kGSCXSessionJournalMagic)
+                     ? 0
+                     : ((const char *)journal.bytes)[versionOffset];
+  if (version == 0 || memcmp(journal.bytes, kGSCXSessionJournalMagic, versionOffset) != 0 ||
+      (version != kGSCXSessionJournalMagic[versionOffset] &&
+       version != kGSCXSessionJournalVersion1)) {
+    if (error != NULL) {
+      *error = [NSError errorWithDomain:kGSCXSessionJournalErrorDomain
+                                   code:GSCXSessionJournalErrorCodeInvalidJournal
+                               userInfo:@{
+                                 NSLocalizedDescriptionKey : @"File is not a session journal.",
+                                 NSFilePathErrorKey : journalURL.path
+                               }];
+    }
+    return 0;
+  }
+  GSCXSessionJournalCursor cursor = {journal.bytes, journal.length,
+                                     sizeof(kGSCXSessionJournalMagic)};
+  NSUInteger validLength = cursor.offset;
+  while (cursor.offset < cursor.length) {
+    uint32_t header[2];
+    if (!GSCXSessionJournalReadBytes(&cursor, header, sizeof(header)) ||
+        cursor.length - cursor.offset < header[0] ||
+        GSCXSessionJournalChecksum(cursor.bytes + cursor.offset, header[0]) != header[1]) {
+      // The rest of the journal was not completely written before the application terminated.
+      break;
+    }
+    GSCXSessionJournalCursor payload = {cursor.bytes + cursor.offset, header[0], 0};
+    cursor.offset += header[0];
+    if (![GSCXSessionJournal gscx_decodePayload:&payload version:version usingBlock:block]) {
+      break;
+    }
+    validLength = cursor.offset;
+  }
+  return validLength;
+}
+
++ (NSURL *)journalURLOfSessionAtURL:(NSURL *)sessionURL {
+  return [sessionURL URLByAppendingPathComponent:kGSCXSessionJournalFileName];
+}
+
+#pragma mark - Private
+
+/**
+ * Encodes and writes a record on @c writingQueue. The screenshot of @c result is written and
+ * synced first if it has not been written yet. The record is dropped if the screenshot cannot be
+ * written.
+ *
+ * @param type The type of the record.
+ * @param index The index of the replaced result. Ignored for append records.
+ * @param result The result to record.
+ */
+- (void)gscx_writeRecordWithType:(GSCXSessionJournalRecordType)type
+                           index:(NSUInteger)index
+                          result:(GTXHierarchyResultCollection *)result {
+  UIImage *screenshot = result.screenshot;
+  NSString *screenshotFileName = [self.screenshotFileNames objectForKey:screenshot];
+  UIImage *unwrittenScreenshot = nil;
+  if (screenshotFileName == nil) {
+    screenshotFileName = [NSString
+        stringWithFormat:@"screenshot_%lu.png", (unsigned long)self.screenshotCount];
+    self.screenshotCount++;
+    [self.screenshotFileNames setObject:screenshotFileName forKey:screenshot];
+    unwrittenScreenshot = screenshot;
+  }
+  NSURL *screenshotURL = [self.sessionURL URLByAppendingPathComponent:screenshotFileName];
+  dispatch_async(self.writingQueue, ^{
+    if (self.writingFailed) {
+      return;
+    }
+    if (unwrittenScreenshot != nil &&
+        !GSCXSessionJournalWriteFile(UIImagePNGRepresentation(unwrittenScreenshot),
+                                     screenshotURL.path)) {
+      self.writingFailed = YES;
+      return;
+    }
+    NSData *payload = [GSCXSessionJournal gscx_payloadWithType:type
+                                                         index:index
+                                                        result:result
+                                            screenshotFileName:screenshotFileName];
+    uint32_t header[2] = {(uint32_t)payload.length,
+                          GSCXSessionJournalChecksum(payload.bytes, payload.length)};
+    NSMutableData *record = [[NSMutableData alloc] initWithBytes:header length:sizeof(header)];
+    [record appendData:payload];
+    if (!GSCXSessionJournalWriteAll(self.fileDescriptor, record.bytes, record.length)) {
+      self.writingFailed = YES;
+      return;
+    }
+    self.unsyncedRecordCount++;
+    if (self.unsyncedRecordCount >= kGSCXSessionJournalSyncRecordInterval ||
+        CACurrentMediaTime() - self.lastSyncTime >= kGSCXSessionJournalSyncTimeInterval) {
+      [self gscx_sync];
+    }
+  });
+}
+
+/**
+ * Flushes the journal file to disk. Must be called on @c writingQueue.
+ */
+- (void)gscx_sync {
+  fsync(self.fileDescriptor);
+  self.unsyncedRecordCount = 0;
+  self.lastSyncTime = CACurrentMediaTime();
+}
+
+/**
+ * Encodes a record's payload.
+ *
+ * @param type The type of the record.
+ * @param index The index of the replaced result.
+ * @param result The recorded result.
+ * @param screenshotFileName The name of the file containing the screenshot of @c result.
+ * @return The encoded payload.
+ */
++ (NSData *)gscx_payloadWithType:(GSCXSessionJournalRecordType)type
+                           index:(NSUInteger)index
+                          result:(GTXHierarchyResultCollection *)result
+              screenshotFileName:(NSString *)screenshotFileName {
+  NSMutableData *payload = [[NSMutableData alloc] init];
+  [payload appendBytes:&type length:sizeof(type)];
+  GSCXSessionJournalAppendUInt32(payload, (uint32_t)index);
+  GSCXSessionJournalAppendString(payload, screenshotFileName);
+  GSCXSessionJournalAppendDouble(payload, result.screenshot.scale);
+  GSCXSessionJournalAppendRect(payload, result.gscx_screenshotFrame);
+  uint8_t incomplete = result.gscx_isIncomplete ? 1 : 0;
+  [payload appendBytes:&incomplete length:sizeof(incomplete)];
+  NSArray<NSString *> *throttledCheckNames = result.gscx_throttledCheckNames;
+  GSCXSessionJournalAppendUInt32(payload, (uint32_t)throttledCheckNames.count);
+  for (NSString *checkName in throttledCheckNames) {
+    GSCXSessionJournalAppendString(payload, checkName);
+  }
+  GSCXSessionJournalAppendUInt32(payload, (uint32_t)result.elementResults.count);
+  for (GTXElementResultCollection *elementResult in result.elementResults) {
+    GTXElementReference *elementReference = elementResult.elementReference;
+    GSCXSessionJournalAppendUInt64(payload, elementReference.elementAddress);
+    GSCXSessionJournalAppendRect(payload, elementReference.accessibilityFrame);
+    GSCXSessionJournalAppendString(payload, NSStringFromClass(elementReference.elementClass));
+    GSCXSessionJournalAppendString(payload, elementReference.accessibilityLabel);
+    GSCXSessionJournalAppendString(payload, elementReference.accessibilityIdentifier);
+    GSCXSessionJournalAppendString(payload, elementReference.elementDescription);
+    GSCXSessionJournalAppendUInt32(payload, (uint32_t)elementResult.checkResults.count);
+    for (GTXCheckResult *checkResult in elementResult.checkResults) {
+      GSCXSessionJournalAppendString(payload, checkResult.checkName);
+      GSCXSessionJournalAppendString(payload, checkResult.errorDescription);
+    }
+  }
+  return payload;
+}
+
+/**
+ * Decodes a record's payload and passes it to @c block.
+ *
+ * @param payload The payload to decode.
+ * @param version The format version of the journal containing the record.
+ * @param block Invoked with the decoded record if it is valid.
+ * @return @c YES if the record was valid, @c NO otherwise.
+ */
++ (BOOL)gscx_decodePayload:(GSCXSessionJournalCursor *)payload
+                   version:(char)version
+                usingBlock:(GSCXSessionJournalRecordBlock)block {
+  GSCXSessionJournalRecordType type;
+  uint32_t index;
+  NSString *screenshotFileName;
+  double screenshotScale;
+  CGRect screenshotFrame;
+  uint32_t elementCount;
+  if (!GSCXSessionJournalReadBytes(payload, &type, sizeof(type)) ||
+      !GSCXSessionJournalReadBytes(payload, &index, sizeof(index)) ||
+      !GSCXSessionJournalReadString(payload, &screenshotFileName) || screenshotFileName == nil ||
+      !GSCXSessionJournalReadBytes(payload, &screenshotScale, sizeof(screenshotScale)) ||
+      !GSCXSessionJournalReadRect(payload, &screenshotFrame)) {
+    return NO;
+  }
+  uint8_t incomplete = 0;
+  NSMutableArray<NSString *> *throttledCheckNames = [[NSMutableArray alloc] init];
+  if (version != kGSCXSessionJournalVersion1) {
+    uint32_t throttledCheckNameCount;
+    if (!GSCXSessionJournalReadBytes(payload, &incomplete, sizeof(incomplete)) ||
+        !GSCXSessionJournalReadBytes(payload, &throttledCheckNameCount,
+                                     sizeof(throttledCheckNameCount))) {
+      return NO;
+    }
+    for (uint32_t i = 0; i < throttledCheckNameCount; i++) {
+      NSString *checkName;
+      if (!GSCXSessionJournalReadString(payload, &checkName) || checkName == nil) {
+        return NO;
+      }
+      [throttledCheckNames addObject:checkName];
+    }
+  }
+  if (!GSCXSessionJournalReadBytes(payload, &elementCount, sizeof(elementCount)) ||
+      (type != GSCXSessionJournalRecordTypeAppend && type != GSCXSessionJournalRecordTypeReplace)) {
+    return NO;
+  }
+  NSMutableArray<GTXElementResultCollection *> *elementResults = [[NSMutableArray alloc] init];
+  for (uint32_t i = 0; i < elementCount; i++) {
+    uint64_t elementAddress;
+    CGRect accessibilityFrame;
+    NSString *className, *label, *identifier, *elementDescription;
+    uint32_t checkCount;
+    if (!GSCXSessionJournalReadBytes(payload, &elementAddress, sizeof(elementAddress)) ||
+        !GSCXSessionJournalReadRect(payload, &accessibilityFrame) ||
+        !GSCXSessionJournalReadString(payload, &className) ||
+        !GSCXSessionJournalReadString(payload, &label) ||
+        !GSCXSessionJournalReadString(payload, &identifier) ||
+        !GSCXSessionJournalReadString(payload, &elementDescription) ||
+        !GSCXSessionJournalReadBytes(payload, &checkCount, sizeof(checkCount))) {
+      return NO;
+    }
+    NSMutableArray<GTXCheckResult *> *checkResults = [[NSMutableArray alloc] init];
+    for (uint32_t j = 0; j < checkCount; j++) {
+      NSString *checkName, *errorDescription;
+      if (!GSCXSessionJournalReadString(payload, &checkName) ||
+          !GSCXSessionJournalReadString(payload, &errorDescription) || checkName == nil) {
+        return NO;
+      }
+      [checkResults addObject:[[GTXCheckResult alloc] initWithCheckName:checkName
+                                                        errorDescription:errorDescription]];
+    }
+    // The element no longer exists, so its class is only used for display. Classes that are not
+    // loaded in the relaunched application fall back to UIView.
+    Class elementClass = (className ? NSClassFromString(className) : Nil) ?: [UIView class];
+    GTXElementReference *elementReference =
+        [[GTXElementReference alloc] initWithElementAddress:(NSUInteger)elementAddress
+                                               elementClass:elementClass
+                                         accessibilityLabel:label
+                                    accessibilityIdentifier:identifier
+                                         accessibilityFrame:accessibilityFrame
+                                         elementDescription:elementDescription];
+    [elementResults addObject:[[GTXElementResultCollection alloc] initWithElement:elementReference
+                                                                     checkResults:checkResults]];
+  }
+  block(type == GSCXSessionJournalRecordTypeReplace, index, screenshotFileName,
+        (CGFloat)screenshotScale, screenshotFrame, incomplete != 0, throttledCheckNames,
+        elementResults);
+  return YES;
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
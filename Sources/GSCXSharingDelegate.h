@@ -20,6 +20,28 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+/**
+ * The formats a @c GSCXSharingDelegate instance can share reports in. Implementations generate PDF
+ * reports with @c GSCXReport.createPDFReport:completionBlock:errorBlock: and machine readable
+ * reports with @c GSCXReport.exportReport:format:completionBlock:errorBlock:.
+ */
+typedef NS_ENUM(NSInteger, GSCXSharedReportFormat) {
+  /**
+   * A PDF rendered from the HTML report.
+   */
+  GSCXSharedReportFormatPDF = 0,
+
+  /**
+   * A JSON Lines export. See @c GSCXReportExportFormatJSONLines.
+   */
+  GSCXSharedReportFormatJSONLines,
+
+  /**
+   * A SARIF 2.1.0 export. See @c GSCXReportExportFormatSARIF.
+   */
+  GSCXSharedReportFormatSARIF,
+};
+
 /**
  * Invoked when a @c GSCXSharingDelegate instance finishes its share action.
  */
@@ -0,0 +1,115 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import <UIKit/UIKit.h>
+
+#import <GTXiLib/GTXiLib.h>
+NS_ASSUME_NONNULL_BEGIN
+
+@class GSCXSlicedScan;
+
+/**
+ * Invoked when a sliced scan ends.
+ *
+ * @param scan The scan that ended.
+ * @param errors The errors found in every checked element if the scan completed, or @c nil if it
+ *  was invalidated.
+ */
+typedef void (^GSCXSlicedScanCompletionBlock)(GSCXSlicedScan *scan,
+                                              NSArray<NSError *> *_Nullable errors);
+
+/**
+ * Checks the elements of a view hierarchy in resumable slices, so a scan of a large hierarchy does
+ * not block the main thread for longer than a frame. Each slice checks elements until
+ * @c timeBudget elapses, then yields until the next frame. Before each slice after the first, the
+ * scan is invalidated if a root view left its window or the structure of the hierarchy changed, so
+ * a completed scan always describes a single state of the screen. Must only be used on the main
+ * thread.
+ */
+@interface GSCXSlicedScan : NSObject
+
+/**
+ * The roots of the view hierarchy being scanned.
+ */
+@property(copy, nonatomic, readonly) NSArray<UIView *> *rootViews;
+
+/**
+ * The maximum number of seconds each slice spends checking elements. At least one element is
+ * checked per slice, so a single expensive element may exceed the budget.
+ */
+@property(assign, nonatomic, readonly) NSTimeInterval timeBudget;
+
+/**
+ * The number of slices performed so far.
+ */
+@property(assign, nonatomic, readonly) NSUInteger sliceCount;
+
+/**
+ * The number of elements checked so far.
+ */
+@property(assign, nonatomic, readonly) NSUInteger checkedElementCount;
+
+/**
+ * @c YES if every element has been checked, @c NO otherwise.
+ */
+@property(assign, nonatomic, readonly, getter=isFinished) BOOL finished;
+
+/**
+ * @c YES if the scan was invalidated before every element was checked, @c NO otherwise.
+ */
+@property(assign, nonatomic, readonly, getter=isInvalidated) BOOL invalidated;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Initializes a @c GSCXSlicedScan instance. The scan does not begin until @c start or
+ * @c performSlice is called.
+ *
+ * @param toolkit The toolkit used to check each element.
+ * @param rootViews The roots of the view hierarchy to scan. Must not be empty.
+ * @param timeBudget The maximum number of seconds each slice spends checking elements.
+ * @param completion Invoked exactly once, when the scan finishes or is invalidated.
+ * @return An initialized @c GSCXSlicedScan instance.
+ */
+- (instancetype)initWithToolkit:(GTXToolKit *)toolkit
+                      rootViews:(NSArray<UIView *> *)rootViews
+                     timeBudget:(NSTimeInterval)timeBudget
+                     completion:(GSCXSlicedScanCompletionBlock)completion
+    NS_DESIGNATED_INITIALIZER;
+
+/**
+ * Performs a slice on every frame until the scan finishes or is invalidated. The scan retains
+ * itself until then.
+ */
+- (void)start;
+
+/**
+ * Performs a single slice immediately. If this completes the scan, the completion block is invoked
+ * before returning. Does nothing if the scan has already ended.
+ *
+ * @return @c YES if elements remain to be checked, @c NO if the scan has ended.
+ */
+- (BOOL)performSlice;
+
+/**
+ * Stops the scan and invokes the completion block with @c nil errors. Does nothing if the scan has
+ * already ended.
+ */
+- (void)invalidate;
+
+@end
+
+NS_ASSUME_NONNULL_END
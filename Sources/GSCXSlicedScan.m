@@ -0,0 +1,200 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXSlicedScan.h"
+
+#import <QuartzCore/QuartzCore.h>
+
+#import "GSCXScreenFingerprint.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface GSCXSlicedScan ()
+
+/**
+ * The toolkit used to check each element.
+ */
+@property(strong, nonatomic) GTXToolKit *toolkit;
+
+/**
+ * Invoked when the scan ends. @c nil once it has been invoked.
+ */
+@property(copy, nonatomic, nullable) GSCXSlicedScanCompletionBlock completion;
+
+/**
+ * Enumerates the elements of @c rootViews. Created by the first slice, so elements are enumerated
+ * from the hierarchy as it is when the scan begins.
+ */
+@property(strong, nonatomic, nullable) GTXAccessibilityTree *tree;
+
+/**
+ * The errors found in the elements checked so far.
+ */
+@property(strong, nonatomic) NSMutableArray<NSError *> *errors;
+
+/**
+ * The window of each root view when the first slice was performed, in the same order as
+ * @c rootViews.
+ */
+@property(strong, nonatomic, nullable) NSPointerArray *rootViewWindows;
+
+/**
+ * The fingerprint of @c rootViews when the first slice was performed.
+ */
+@property(strong, nonatomic, nullable) GSCXScreenFingerprint *fingerprint;
+
+/**
+ * Performs a slice every frame. @c nil if @c start has not been called or the scan has ended.
+ */
+@property(strong, nonatomic, nullable) CADisplayLink *displayLink;
+
+@end
+
+@implementation GSCXSlicedScan
+
+- (instancetype)initWithToolkit:(GTXToolKit *)toolkit
+                      rootViews:(NSArray<UIView *> *)rootViews
+                     timeBudget:(NSTimeInterval)timeBudget
+                     completion:(GSCXSlicedScanCompletionBlock)completion {
+  GTX_ASSERT(rootViews.count > 0, @"rootViews cannot be empty.");
+  self = [super init];
+  if (self) {
+    _toolkit = toolkit;
+    _rootViews = [rootViews copy];
+    _timeBudget = timeBudget;
+    _completion = [completion copy];
+    _errors = [[NSMutableArray alloc] init];
+  }
+  return self;
+}
+
+- (void)start {
+  if (self.displayLink != nil || [self gscx_hasEnded]) {
+    return;
+  }
+  // The display link retains the scan until it is invalidated when the scan ends.
+  self.displayLink = [CADisplayLink displayLinkWithTarget:self
+                                                 selector:@selector(gscx_displayLinkDidFire:)];
+  [self.displayLink addToRunLoop:[NSRunLoop mainRunLoop] forMode:NSRunLoopCommonModes];
+}
+
+- (BOOL)performSlice {
+  if ([self gscx_hasEnded]) {
+    return NO;
+  }
+  if (self.tree == nil) {
+    [self gscx_recordHierarchyState];
+  } else if ([self gscx_hierarchyDidChange]) {
+    [self invalidate];
+    return NO;
+  }
+  _sliceCount++;
+  CFTimeInterval deadline = CACurrentMediaTime() + self.timeBudget;
+  do {
+    id element = [self.tree nextObject];
+    if (element == nil) {
+      [self gscx_endWithErrors:self.errors];
+      return NO;
+    }
+    NSError *error;
+    if (![self.toolkit checkElement:element error:&error] && error != nil) {
+      [self.errors addObject:error];
+    }
+    _checkedElementCount++;
+  } while (CACurrentMediaTime() < deadline);
+  return YES;
+}
+
+- (void)invalidate {
+  if ([self gscx_hasEnded]) {
+    return;
+  }
+  _invalidated = YES;
+  [self gscx_endWithErrors:nil];
+}
+
+#pragma mark - Private
+
+/**
+ * Performs a slice in response to a frame.
+ *
+ * @param displayLink The display link that fired.
+ */
+- (void)gscx_displayLinkDidFire:(CADisplayLink *)displayLink {
+  [self performSlice];
+}
+
+/**
+ * @return @c YES if the scan has finished or been invalidated, @c NO otherwise.
+ */
+- (BOOL)gscx_hasEnded {
+  return self.completion == nil;
+}
+
+/**
+ * Begins enumerating elements and records the state of the hierarchy, so later slices can detect
+ * if it changed.
+ */
+- (void)gscx_recordHierarchyState {
+  self.tree = [[GTXAccessibilityTree alloc] initWithRootElements:self.rootViews];
+  self.rootViewWindows = [NSPointerArray weakObjectsPointerArray];
+  for (UIView *rootView in self.rootViews) {
+    [self.rootViewWindows addPointer:(__bridge void *)rootView.window];
+  }
+  self.fingerprint = [GSCXScreenFingerprint fingerprintWithRootViews:self.rootViews];
+}
+
+/**
+ * Determines if the hierarchy changed since the first slice. Only the structure near the root
+ * views is compared, which is far cheaper than a slice.
+ *
+ * @return @c YES if a root view moved to a different window or the fingerprint of the hierarchy
+ *  changed, @c NO otherwise.
+ */
+- (BOOL)gscx_hierarchyDidChange {
+  for (NSUInteger i = 0; i < self.rootViews.count; i++) {
+    UIWindow *window = (__bridge UIWindow *)[self.rootViewWindows pointerAtIndex:i];
+    if (self.rootViews[i].window != window) {
+      return YES;
+    }
+  }
+  GSCXScreenFingerprint *fingerprint =
+      [GSCXScreenFingerprint fingerprintWithRootViews:self.rootViews];
+  return ![fingerprint isEqual:self.fingerprint];
+}
+
+/**
+ * Stops performing slices, releases the hierarchy and invokes the completion block.
+ *
+ * @param errors The errors to pass to the completion block, or @c nil if the scan was invalidated.
+ */
+- (void)gscx_endWithErrors:(nullable NSArray<NSError *> *)errors {
+  if (errors != nil) {
+    _finished = YES;
+  }
+  [self.displayLink invalidate];
+  self.displayLink = nil;
+  self.tree = nil;
+  self.rootViewWindows = nil;
+  self.fingerprint = nil;
+  GSCXSlicedScanCompletionBlock completion = self.completion;
+  self.completion = nil;
+  completion(self, [errors copy]);
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,78 @@
+//
+// Copyright 2018 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+#import "GSCXElementSnapshot.h"
+#import <GTXiLib/GTXiLib.h>
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * A check that can be evaluated on a @c GSCXElementSnapshot instead of the element itself.
+ * Conforming marks the check as thread-safe: @c checkSnapshot: may be called on any thread,
+ * concurrently, and must only read the snapshot. It must also agree with @c check:error:, because
+ * scans evaluating snapshots in parallel call @c check:error: on the main thread for elements whose
+ * snapshot failed, so errors are reported exactly as when checks run serially.
+ */
+@protocol GSCXSnapshotChecking <GTXChecking>
+
+/**
+ * Evaluates this check on a snapshot of an element. Must be a pure function of @c snapshot.
+ *
+ * @param snapshot The snapshot to check.
+ * @return @c YES if the element passes this check, @c NO otherwise.
+ */
+- (BOOL)checkSnapshot:(GSCXElementSnapshot *)snapshot;
+
+@end
+
+/**
+ * Determines whether a snapshot of an element passes a check.
+ *
+ * @param snapshot The snapshot to check.
+ * @return @c YES if the element passes the check, @c NO otherwise.
+ */
+typedef BOOL (^GSCXSnapshotCheckBlock)(GSCXElementSnapshot *snapshot);
+
+/**
+ * A @c GSCXSnapshotChecking implementation defined by a block. @c check:error: captures a snapshot
+ * of the element and evaluates the same block, so the two always agree. During a scan, snapshots
+ * are captured through the scan's @c GSCXAttributeCache, so every snapshot check shares them.
+ */
+@interface GSCXSnapshotCheck : NSObject <GSCXSnapshotChecking>
+
+/**
+ * The description of the error reported for elements failing this check.
+ */
+@property(copy, nonatomic, readonly) NSString *errorDescription;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Constructs a @c GSCXSnapshotCheck instance.
+ *
+ * @param name The name of the check.
+ * @param errorDescription The description of the error reported for failing elements.
+ * @param block Determines whether a snapshot passes the check. Called on arbitrary threads.
+ * @return A @c GSCXSnapshotCheck instance.
+ */
++ (instancetype)checkWithName:(NSString *)name
+             errorDescription:(NSString *)errorDescription
+                        block:(GSCXSnapshotCheckBlock)block;
+
+@end
+
+NS_ASSUME_NONNULL_END
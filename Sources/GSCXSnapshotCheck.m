@@ -0,0 +1,74 @@
+//
+// Copyright 2018 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXSnapshotCheck.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface GSCXSnapshotCheck ()
+
+/**
+ * The name of this check.
+ */
+@property(copy, nonatomic) NSString *name;
+
+/**
+ * Determines whether a snapshot passes this check.
+ */
+@property(copy, nonatomic) GSCXSnapshotCheckBlock block;
+
+@end
+
+@implementation GSCXSnapshotCheck
+
+- (instancetype)initWithName:(NSString *)name
+            errorDescription:(NSString *)errorDescription
+                       block:(GSCXSnapshotCheckBlock)block {
+  self = [super init];
+  if (self) {
+    _name = [name copy];
+    _errorDescription = [errorDescription copy];
+    _block = [block copy];
+  }
+  return self;
+}
+
++ (instancetype)checkWithName:(NSString *)name
+             errorDescription:(NSString *)errorDescription
+                        block:(GSCXSnapshotCheckBlock)block {
+  return [[GSCXSnapshotCheck alloc] initWithName:name
+                                errorDescription:errorDescription
+                                           block:block];
+}
+
+- (BOOL)check:(id)element error:(GTXErrorRefType)errorOrNil {
+  if ([self checkSnapshot:[GSCXElementSnapshot snapshotOfElement:element]]) {
+    return YES;
+  }
+  [NSError gtx_logOrSetGTXCheckFailedError:errorOrNil
+                                   element:element
+                                      name:self.name
+                               description:self.errorDescription];
+  return NO;
+}
+
+- (BOOL)checkSnapshot:(GSCXElementSnapshot *)snapshot {
+  return self.block(snapshot);
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
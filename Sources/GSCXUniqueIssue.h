@@ -0,0 +1,108 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+#import <GTXiLib/GTXiLib.h>
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * A single accessibility issue, identified by the failing check and the element it failed on,
+ * aggregated across all scans it occurred in.
+ */
+@interface GSCXUniqueIssue : NSObject
+
+/**
+ * Identifies this issue across scans. Two occurrences with the same key are considered the same
+ * issue.
+ */
+@property(copy, nonatomic, readonly) NSString *issueKey;
+
+/**
+ * The name of the failing check.
+ */
+@property(copy, nonatomic, readonly) NSString *checkName;
+
+/**
+ * The description of the failure from the first occurrence of this issue.
+ */
+@property(copy, nonatomic, readonly) NSString *errorDescription;
+
+/**
+ * The element the first occurrence of this issue failed on. Only the element reference is kept,
+ * not the result containing it, so unique issues do not retain screenshots. Use
+ * @c originalResultInResults: to look up the result.
+ */
+@property(strong, nonatomic, readonly) GTXElementReference *originalElementReference;
+
+/**
+ * The index of the element this issue first occurred on in the result at @c firstSeenScanIndex.
+ */
+@property(assign, nonatomic, readonly) NSInteger originalElementIndex;
+
+/**
+ * The index of the scan this issue first occurred in. Also the index of the result containing the
+ * first occurrence in the results the issue was found in.
+ */
+@property(assign, nonatomic, readonly) NSUInteger firstSeenScanIndex;
+
+/**
+ * The index of the most recent scan this issue occurred in.
+ */
+@property(assign, nonatomic, readonly) NSUInteger lastSeenScanIndex;
+
+/**
+ * The number of times this issue occurred across all scans.
+ */
+@property(assign, nonatomic, readonly) NSUInteger occurrenceCount;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Initializes a @c GSCXUniqueIssue instance representing the first occurrence of an issue.
+ *
+ * @param issueKey Identifies this issue across scans.
+ * @param checkResult The failing check.
+ * @param elementReference The element the issue occurred on.
+ * @param elementIndex The index of the element in its scan result.
+ * @param scanIndex The index of the scan the issue occurred in.
+ * @return An initialized @c GSCXUniqueIssue instance with an occurrence count of 1.
+ */
+- (instancetype)initWithIssueKey:(NSString *)issueKey
+                     checkResult:(GTXCheckResult *)checkResult
+        originalElementReference:(GTXElementReference *)elementReference
+            originalElementIndex:(NSInteger)elementIndex
+                       scanIndex:(NSUInteger)scanIndex NS_DESIGNATED_INITIALIZER;
+
+/**
+ * Looks up the result containing the first occurrence of this issue.
+ *
+ * @param results The results this issue was found in, in scan order.
+ * @return The result at @c firstSeenScanIndex in @c results.
+ */
+- (GTXHierarchyResultCollection *)originalResultInResults:
+    (NSArray<GTXHierarchyResultCollection *> *)results;
+
+/**
+ * Records another occurrence of this issue.
+ *
+ * @param scanIndex The index of the scan the issue occurred in.
+ */
+- (void)addOccurrenceAtScanIndex:(NSUInteger)scanIndex;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,59 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXUniqueIssue.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@implementation GSCXUniqueIssue
+
+- (instancetype)initWithIssueKey:(NSString *)issueKey
+                     checkResult:(GTXCheckResult *)checkResult
+        originalElementReference:(GTXElementReference *)elementReference
+            originalElementIndex:(NSInteger)elementIndex
+                       scanIndex:(NSUInteger)scanIndex {
+  GTX_ASSERT(elementIndex >= 0, @"elementIndex is out of range.");
+  self = [super init];
+  if (self) {
+    _issueKey = [issueKey copy];
+    _checkName = [checkResult.checkName copy];
+    _errorDescription = [checkResult.errorDescription copy];
+    _originalElementReference = elementReference;
+    _originalElementIndex = elementIndex;
+    _firstSeenScanIndex = scanIndex;
+    _lastSeenScanIndex = scanIndex;
+    _occurrenceCount = 1;
+  }
+  return self;
+}
+
+- (GTXHierarchyResultCollection *)originalResultInResults:
+    (NSArray<GTXHierarchyResultCollection *> *)results {
+  GTX_ASSERT(self.firstSeenScanIndex < results.count, @"results does not contain this issue.");
+  GTXHierarchyResultCollection *result = results[self.firstSeenScanIndex];
+  GTX_ASSERT((NSUInteger)self.originalElementIndex < result.elementResults.count,
+             @"results does not contain this issue.");
+  return result;
+}
+
+- (void)addOccurrenceAtScanIndex:(NSUInteger)scanIndex {
+  _occurrenceCount++;
+  _lastSeenScanIndex = MAX(_lastSeenScanIndex, scanIndex);
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
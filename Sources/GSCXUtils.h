@@ -41,6 +41,15 @@ FOUNDATION_EXTERN const CGFloat kGSCXMinimumTouchTargetSize;
  */
 + (NSURL *)uniqueTemporaryDirectoryURL;
 
+/**
+ * Computes the 64 bit FNV-1a hash of the UTF-8 bytes of @c string. Used for issue keys and
+ * baseline fingerprints, which must stay the same across launches, unlike @c NSString.hash.
+ *
+ * @param string The string to hash.
+ * @return The hash, as a 16 character hexadecimal string.
+ */
++ (NSString *)hexadecimalHashOfString:(NSString *)string;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -21,6 +21,16 @@ NS_ASSUME_NONNULL_BEGIN
 
 const CGFloat kGSCXMinimumTouchTargetSize = 44.0;
 
+/**
+ * The FNV-1a 64 bit offset basis.
+ */
+static const uint64_t kGSCXUtilsHashOffsetBasis = 0xcbf29ce484222325ULL;
+
+/**
+ * The FNV-1a 64 bit prime.
+ */
+static const uint64_t kGSCXUtilsHashPrime = 0x100000001b3ULL;
+
 @implementation GSCXUtils
 
 + (NSURL *)uniqueTemporaryDirectoryURL {
@@ -36,6 +46,16 @@ const CGFloat kGSCXMinimumTouchTargetSize = 44.0;
   return temporaryDirectoryURL;
 }
 
++ (NSString *)hexadecimalHashOfString:(NSString *)string {
+  uint64_t hash = kGSCXUtilsHashOffsetBasis;
+  const char *bytes = [string UTF8String];
+  for (size_t i = 0; bytes[i] != '\0'; i++) {
+    hash ^= (uint8_t)bytes[i];
+    hash *= kGSCXUtilsHashPrime;
+  }
+  return [NSString stringWithFormat:@"%016llx", (unsigned long long)hash];
+}
+
 @end
 
 NS_ASSUME_NONNULL_END
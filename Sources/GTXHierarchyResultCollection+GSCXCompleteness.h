@@ -0,0 +1,43 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+#import <GTXiLib/GTXiLib.h>
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Marks results of scans that stopped before checking every element, or did not run every check.
+ */
+@interface GTXHierarchyResultCollection (GSCXCompleteness)
+
+/**
+ * @c YES if the scan producing this result was cancelled or timed out, so elements after the last
+ * checked element may have issues that are not included. Defaults to @c NO.
+ */
+@property(assign, nonatomic, getter=gscx_isIncomplete, setter=gscx_setIncomplete:)
+    BOOL gscx_incomplete;
+
+/**
+ * The names of active checks that were throttled, and so not run, in the scan producing this
+ * result. Defaults to an empty array.
+ */
+@property(copy, nonatomic, setter=gscx_setThrottledCheckNames:)
+    NSArray<NSString *> *gscx_throttledCheckNames;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,55 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GTXHierarchyResultCollection+GSCXCompleteness.h"
+
+#import <objc/runtime.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * The key of the associated object storing @c gscx_incomplete.
+ */
+static const void *kGSCXIncompleteKey = &kGSCXIncompleteKey;
+
+/**
+ * The key of the associated object storing @c gscx_throttledCheckNames.
+ */
+static const void *kGSCXThrottledCheckNamesKey = &kGSCXThrottledCheckNamesKey;
+
+@implementation GTXHierarchyResultCollection (GSCXCompleteness)
+
+- (BOOL)gscx_isIncomplete {
+  return [objc_getAssociatedObject(self, kGSCXIncompleteKey) boolValue];
+}
+
+- (void)gscx_setIncomplete:(BOOL)incomplete {
+  objc_setAssociatedObject(self, kGSCXIncompleteKey, @(incomplete),
+                           OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+}
+
+- (NSArray<NSString *> *)gscx_throttledCheckNames {
+  return objc_getAssociatedObject(self, kGSCXThrottledCheckNamesKey) ?: @[];
+}
+
+- (void)gscx_setThrottledCheckNames:(NSArray<NSString *> *)throttledCheckNames {
+  objc_setAssociatedObject(self, kGSCXThrottledCheckNamesKey, throttledCheckNames,
+                           OBJC_ASSOCIATION_COPY_NONATOMIC);
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
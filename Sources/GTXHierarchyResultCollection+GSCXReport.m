@@ -18,6 +18,8 @@
 
 #import "GSCXRingViewArranger.h"
 #import "GTXElementResultCollection+GSCXReport.h"
+#import "GTXHierarchyResultCollection+GSCXCompleteness.h"
+#import "GTXHierarchyResultCollection+GSCXScreenshot.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -26,6 +28,15 @@ NS_ASSUME_NONNULL_BEGIN
 - (NSString *)htmlDescription:(GSCXReportContext *)context {
   NSMutableArray *htmlSnippets = [[NSMutableArray alloc] init];
   [htmlSnippets addObject:@"<meta charset=\"UTF-8\">"];
+  if (self.gscx_isIncomplete) {
+    [htmlSnippets addObject:@"<p>This scan stopped before checking every element.</p>"];
+  }
+  if (self.gscx_throttledCheckNames.count > 0) {
+    NSString *checkNames = [self.gscx_throttledCheckNames componentsJoinedByString:@", "];
+    [htmlSnippets
+        addObject:[NSString stringWithFormat:@"<p>Throttled checks not run in this scan: %@</p>",
+                                             checkNames]];
+  }
   for (GTXElementResultCollection *elementResult in self.elementResults) {
     [htmlSnippets addObject:[elementResult htmlDescription]];
   }
@@ -44,8 +55,7 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (UIImage *)gscx_annotatedScreenshot {
   GSCXRingViewArranger *arranger = [[GSCXRingViewArranger alloc] initWithResult:self];
-  CGRect originalCoordinates =
-      CGRectMake(0, 0, self.screenshot.size.width, self.screenshot.size.height);
+  CGRect originalCoordinates = self.gscx_screenshotFrame;
   UIImageView *superview = [[UIImageView alloc] initWithImage:self.screenshot];
   return [arranger imageByAddingRingViewsToSuperview:superview fromCoordinates:originalCoordinates];
 }
@@ -0,0 +1,65 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import <UIKit/UIKit.h>
+
+#import <GTXiLib/GTXiLib.h>
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Describes which part of the screen a result's screenshot covers, so elements' accessibility
+ * frames can be mapped onto screenshots that were cropped when captured.
+ */
+@interface GTXHierarchyResultCollection (GSCXScreenshot)
+
+/**
+ * The rectangle, in screen coordinates, captured by @c screenshot. Defaults to the origin and the
+ * size of @c screenshot, which is the full screen for results constructed by GTXiLib.
+ */
+@property(assign, nonatomic, setter=gscx_setScreenshotFrame:) CGRect gscx_screenshotFrame;
+
+/**
+ * Constructs a result and sets every property GSCXScanner associates with results. Code rebuilding
+ * a result, from another result or from a persisted record, must use this method or
+ * @c gscx_resultWithElementResults: so none of those properties are dropped.
+ *
+ * @param elementResults The element results of the new result.
+ * @param screenshot The screenshot of the new result.
+ * @param screenshotFrame The rectangle, in screen coordinates, captured by @c screenshot.
+ * @param incomplete @c YES if the scan producing the result did not check every element.
+ * @param throttledCheckNames The names of checks throttled in the scan producing the result.
+ * @return A new result with the given properties.
+ */
++ (GTXHierarchyResultCollection *)
+    gscx_resultWithElementResults:(NSArray<GTXElementResultCollection *> *)elementResults
+                       screenshot:(UIImage *)screenshot
+                  screenshotFrame:(CGRect)screenshotFrame
+                       incomplete:(BOOL)incomplete
+              throttledCheckNames:(NSArray<NSString *> *)throttledCheckNames;
+
+/**
+ * Constructs a result with @c elementResults that shares this instance's screenshot, screenshot
+ * frame, completeness and throttled checks.
+ *
+ * @param elementResults The element results of the new result.
+ * @return A new result containing @c elementResults.
+ */
+- (GTXHierarchyResultCollection *)gscx_resultWithElementResults:
+    (NSArray<GTXElementResultCollection *> *)elementResults;
+
+@end
+
+NS_ASSUME_NONNULL_END
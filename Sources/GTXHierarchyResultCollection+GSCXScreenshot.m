@@ -0,0 +1,72 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GTXHierarchyResultCollection+GSCXScreenshot.h"
+
+#import <objc/runtime.h>
+
+#import "GTXHierarchyResultCollection+GSCXCompleteness.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * The key of the associated object storing @c gscx_screenshotFrame.
+ */
+static const void *kGSCXScreenshotFrameKey = &kGSCXScreenshotFrameKey;
+
+@implementation GTXHierarchyResultCollection (GSCXScreenshot)
+
+- (CGRect)gscx_screenshotFrame {
+  NSValue *frame = objc_getAssociatedObject(self, kGSCXScreenshotFrameKey);
+  if (frame == nil) {
+    return CGRectMake(0, 0, self.screenshot.size.width, self.screenshot.size.height);
+  }
+  return [frame CGRectValue];
+}
+
+- (void)gscx_setScreenshotFrame:(CGRect)screenshotFrame {
+  objc_setAssociatedObject(self, kGSCXScreenshotFrameKey, [NSValue valueWithCGRect:screenshotFrame],
+                           OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+}
+
++ (GTXHierarchyResultCollection *)
+    gscx_resultWithElementResults:(NSArray<GTXElementResultCollection *> *)elementResults
+                       screenshot:(UIImage *)screenshot
+                  screenshotFrame:(CGRect)screenshotFrame
+                       incomplete:(BOOL)incomplete
+              throttledCheckNames:(NSArray<NSString *> *)throttledCheckNames {
+  GTXHierarchyResultCollection *result =
+      [[GTXHierarchyResultCollection alloc] initWithElementResults:elementResults
+                                                        screenshot:screenshot];
+  result.gscx_screenshotFrame = screenshotFrame;
+  result.gscx_incomplete = incomplete;
+  result.gscx_throttledCheckNames = throttledCheckNames;
+  return result;
+}
+
+- (GTXHierarchyResultCollection *)gscx_resultWithElementResults:
+    (NSArray<GTXElementResultCollection *> *)elementResults {
+  return [GTXHierarchyResultCollection
+      gscx_resultWithElementResults:elementResults
+                         screenshot:self.screenshot
+                    screenshotFrame:self.gscx_screenshotFrame
+                         incomplete:self.gscx_isIncomplete
+                throttledCheckNames:self.gscx_throttledCheckNames];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
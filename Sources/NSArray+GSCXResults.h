@@ -0,0 +1,44 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import <UIKit/UIKit.h>
+
+#import <GTXiLib/GTXiLib.h>
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Accesses parts of scan results by index. Arrays that decode results when they are accessed, like
+ * the results of a @c GSCXMappedSession, override these methods to read the parts without decoding
+ * whole results and their screenshots, so long sessions can be indexed, sized and deduplicated
+ * cheaply. Other arrays access the result at the index.
+ */
+@interface NSArray (GSCXResults)
+
+/**
+ * @param index The index of a result in the receiver. Must be less than @c count.
+ * @return The element results of the result at @c index.
+ */
+- (NSArray<GTXElementResultCollection *> *)gscx_elementResultsOfResultAtIndex:(NSUInteger)index;
+
+/**
+ * @param index The index of a result in the receiver. Must be less than @c count.
+ * @return The size, in points, of the screenshot of the result at @c index.
+ */
+- (CGSize)gscx_screenshotSizeOfResultAtIndex:(NSUInteger)index;
+
+@end
+
+NS_ASSUME_NONNULL_END
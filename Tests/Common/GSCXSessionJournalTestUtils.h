@@ -0,0 +1,60 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "GSCXSessionJournal.h"
+#import <GTXiLib/GTXiLib.h>
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * The check name of results constructed by @c GSCXSessionJournalTestUtils.
+ */
+FOUNDATION_EXTERN NSString *const kGSCXSessionJournalTestUtilsCheckName;
+
+/**
+ * The error description of results constructed by @c GSCXSessionJournalTestUtils.
+ */
+FOUNDATION_EXTERN NSString *const kGSCXSessionJournalTestUtilsCheckDescription;
+
+/**
+ * Helpers for tests writing and reading journaled sessions.
+ */
+@interface GSCXSessionJournalTestUtils : NSObject
+
+/**
+ * Syncs @c journal and waits for it to complete.
+ *
+ * @param journal The journal to sync.
+ * @param testCase The test case waiting for the sync.
+ */
++ (void)synchronizeJournal:(GSCXSessionJournal *)journal inTestCase:(XCTestCase *)testCase;
+
+/**
+ * Constructs a result containing a single element failing a single check. The element is a
+ * @c UILabel with the accessibility identifier "Identifier", the description "Description" and the
+ * accessibility frame (1, 2, 3, 4). The check is named @c kGSCXSessionJournalTestUtilsCheckName.
+ *
+ * @param label The accessibility label of the element.
+ * @param screenshot The screenshot of the result.
+ * @return A result with @c screenshot.
+ */
++ (GTXHierarchyResultCollection *)resultWithLabel:(nullable NSString *)label
+                                       screenshot:(UIImage *)screenshot;
+
+@end
+
+NS_ASSUME_NONNULL_END
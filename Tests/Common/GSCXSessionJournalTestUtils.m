@@ -0,0 +1,62 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "third_party/objective_c/GSCXScanner/Tests/Common/GSCXSessionJournalTestUtils.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+NSString *const kGSCXSessionJournalTestUtilsCheckName = @"Accessibility label missing";
+
+NSString *const kGSCXSessionJournalTestUtilsCheckDescription =
+    @"This element doesn't have an accessibility label.";
+
+/**
+ * The time, in seconds, to wait for a journal to be synced.
+ */
+static const NSTimeInterval kGSCXSessionJournalTestUtilsTimeout = 5.0;
+
+@implementation GSCXSessionJournalTestUtils
+
++ (void)synchronizeJournal:(GSCXSessionJournal *)journal inTestCase:(XCTestCase *)testCase {
+  XCTestExpectation *expectation = [testCase expectationWithDescription:@"Journal synced."];
+  [journal synchronizeWithCompletion:^{
+    [expectation fulfill];
+  }];
+  [testCase waitForExpectations:@[ expectation ] timeout:kGSCXSessionJournalTestUtilsTimeout];
+}
+
++ (GTXHierarchyResultCollection *)resultWithLabel:(nullable NSString *)label
+                                       screenshot:(UIImage *)screenshot {
+  GTXElementReference *elementReference =
+      [[GTXElementReference alloc] initWithElementAddress:1
+                                             elementClass:[UILabel class]
+                                       accessibilityLabel:label
+                                  accessibilityIdentifier:@"Identifier"
+                                       accessibilityFrame:CGRectMake(1, 2, 3, 4)
+                                       elementDescription:@"Description"];
+  GTXCheckResult *checkResult =
+      [[GTXCheckResult alloc] initWithCheckName:kGSCXSessionJournalTestUtilsCheckName
+                               errorDescription:kGSCXSessionJournalTestUtilsCheckDescription];
+  GTXElementResultCollection *elementResult =
+      [[GTXElementResultCollection alloc] initWithElement:elementReference
+                                             checkResults:@[ checkResult ]];
+  return [[GTXHierarchyResultCollection alloc] initWithElementResults:@[ elementResult ]
+                                                           screenshot:screenshot];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
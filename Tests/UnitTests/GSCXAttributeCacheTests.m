@@ -0,0 +1,73 @@
+//
+// Copyright 2018 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXAttributeCache.h"
+
+#import <XCTest/XCTest.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface GSCXAttributeCacheTests : XCTestCase
+@end
+
+@implementation GSCXAttributeCacheTests
+
+- (void)testAttributesAreReadOnce {
+  GSCXAttributeCache *cache = [[GSCXAttributeCache alloc] init];
+  UIView *view = [[UIView alloc] initWithFrame:CGRectMake(0, 0, 10, 10)];
+  view.accessibilityLabel = @"Label";
+
+  XCTAssertEqualObjects([cache accessibilityLabelOfElement:view], @"Label");
+  view.accessibilityLabel = @"Changed";
+  XCTAssertEqualObjects([cache accessibilityLabelOfElement:view], @"Label");
+
+  XCTAssertEqual(cache.hitCount, 1ul);
+  XCTAssertEqual(cache.missCount, 1ul);
+}
+
+- (void)testNilAttributesAreCached {
+  GSCXAttributeCache *cache = [[GSCXAttributeCache alloc] init];
+  UIView *view = [[UIView alloc] initWithFrame:CGRectMake(0, 0, 10, 10)];
+
+  XCTAssertNil([cache accessibilityHintOfElement:view]);
+  XCTAssertNil([cache accessibilityHintOfElement:view]);
+
+  XCTAssertEqual(cache.hitCount, 1ul);
+  XCTAssertEqual(cache.missCount, 1ul);
+}
+
+- (void)testElementsAreCachedSeparately {
+  GSCXAttributeCache *cache = [[GSCXAttributeCache alloc] init];
+  UIView *view1 = [[UIView alloc] initWithFrame:CGRectMake(0, 0, 10, 10)];
+  UIView *view2 = [[UIView alloc] initWithFrame:CGRectMake(0, 0, 10, 10)];
+  view1.accessibilityTraits = UIAccessibilityTraitButton;
+  view2.isAccessibilityElement = YES;
+
+  XCTAssertEqual([cache accessibilityTraitsOfElement:view1], UIAccessibilityTraitButton);
+  XCTAssertEqual([cache accessibilityTraitsOfElement:view2], UIAccessibilityTraitNone);
+  XCTAssertFalse([cache isAccessibilityElement:view1]);
+  XCTAssertTrue([cache isAccessibilityElement:view2]);
+  [cache reset];
+
+  XCTAssertEqual(cache.hitCount, 0ul);
+  XCTAssertEqual(cache.missCount, 0ul);
+  view1.accessibilityTraits = UIAccessibilityTraitNone;
+  XCTAssertEqual([cache accessibilityTraitsOfElement:view1], UIAccessibilityTraitNone);
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,140 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXBaseline.h"
+
+#import <XCTest/XCTest.h>
+
+#import "GSCXTestCheckNames.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface GSCXBaselineTests : XCTestCase
+@end
+
+@implementation GSCXBaselineTests
+
+- (void)testFingerprintIgnoresFrameOfIdentifiedElements {
+  GTXCheckResult *checkResult = [self gscx_labelCheckResult];
+  NSString *fingerprint = [GSCXBaseline
+      fingerprintForCheckResult:checkResult
+               elementReference:[self gscx_elementWithIdentifier:@"A"
+                                                           frame:CGRectMake(0, 0, 10, 10)]];
+  NSString *movedFingerprint = [GSCXBaseline
+      fingerprintForCheckResult:checkResult
+               elementReference:[self gscx_elementWithIdentifier:@"A"
+                                                           frame:CGRectMake(50, 50, 20, 20)]];
+  NSString *otherFingerprint = [GSCXBaseline
+      fingerprintForCheckResult:checkResult
+               elementReference:[self gscx_elementWithIdentifier:@"B"
+                                                           frame:CGRectMake(0, 0, 10, 10)]];
+  NSString *unidentifiedFingerprint = [GSCXBaseline
+      fingerprintForCheckResult:checkResult
+               elementReference:[self gscx_elementWithIdentifier:nil
+                                                           frame:CGRectMake(0, 0, 10, 10)]];
+  NSString *movedUnidentifiedFingerprint = [GSCXBaseline
+      fingerprintForCheckResult:checkResult
+               elementReference:[self gscx_elementWithIdentifier:nil
+                                                           frame:CGRectMake(50, 50, 20, 20)]];
+  XCTAssertEqual(fingerprint.length, 16ul);
+  XCTAssertEqualObjects(fingerprint, movedFingerprint);
+  XCTAssertNotEqualObjects(fingerprint, otherFingerprint);
+  XCTAssertNotEqualObjects(unidentifiedFingerprint, movedUnidentifiedFingerprint);
+}
+
+- (void)testFilteringRemovesOnlyBaselineIssues {
+  GTXElementReference *known = [self gscx_elementWithIdentifier:@"A" frame:CGRectZero];
+  GTXElementReference *unknown = [self gscx_elementWithIdentifier:@"B" frame:CGRectZero];
+  GTXCheckResult *labelCheckResult = [self gscx_labelCheckResult];
+  GTXCheckResult *contrastCheckResult =
+      [[GTXCheckResult alloc] initWithCheckName:kGSCXTestContrastRatioCheckName
+                               errorDescription:kGSCXTestContrastRatioCheckDescription];
+  GSCXBaseline *baseline = [[GSCXBaseline alloc] initWithFingerprints:[NSSet setWithObject:
+      [GSCXBaseline fingerprintForCheckResult:labelCheckResult elementReference:known]]];
+  NSArray<GTXElementResultCollection *> *elementResults = @[
+    [[GTXElementResultCollection alloc] initWithElement:known
+                                           checkResults:@[ labelCheckResult, contrastCheckResult ]],
+    [[GTXElementResultCollection alloc] initWithElement:unknown
+                                           checkResults:@[ labelCheckResult ]],
+  ];
+
+  NSArray<GTXElementResultCollection *> *filtered =
+      [baseline elementResultsByRemovingBaselineIssues:elementResults];
+
+  XCTAssertEqual(filtered.count, 2ul);
+  XCTAssertEqual(filtered[0].checkResults.count, 1ul);
+  XCTAssertEqualObjects(filtered[0].checkResults[0].checkName, kGSCXTestContrastRatioCheckName);
+  XCTAssertEqual(filtered[1], elementResults[1]);
+  NSArray<GTXElementResultCollection *> *unfiltered = @[ elementResults[1] ];
+  XCTAssertEqual([baseline elementResultsByRemovingBaselineIssues:unfiltered], unfiltered);
+}
+
+- (void)testWrittenBaselineCanBeRead {
+  GTXElementReference *element = [self gscx_elementWithIdentifier:@"A" frame:CGRectZero];
+  GTXElementResultCollection *elementResult =
+      [[GTXElementResultCollection alloc] initWithElement:element
+                                             checkResults:@[ [self gscx_labelCheckResult] ]];
+  UIGraphicsBeginImageContextWithOptions(CGSizeMake(1.0, 1.0), YES, 1.0);
+  UIImage *screenshot = UIGraphicsGetImageFromCurrentImageContext();
+  UIGraphicsEndImageContext();
+  GTXHierarchyResultCollection *result =
+      [[GTXHierarchyResultCollection alloc] initWithElementResults:@[ elementResult ]
+                                                        screenshot:screenshot];
+  GSCXBaseline *baseline = [[GSCXBaseline alloc] initWithFingerprints:[NSSet setWithObject:@"x"]];
+  GSCXBaseline *newBaseline = [baseline baselineByAddingResults:@[ result ]];
+  NSURL *url = [[NSURL fileURLWithPath:NSTemporaryDirectory()]
+      URLByAppendingPathComponent:[NSUUID UUID].UUIDString];
+
+  XCTAssertTrue([newBaseline writeToURL:url error:nil]);
+  GSCXBaseline *readBaseline = [GSCXBaseline baselineWithContentsOfURL:url error:nil];
+  [[NSFileManager defaultManager] removeItemAtURL:url error:nil];
+
+  XCTAssertEqual(newBaseline.count, 2ul);
+  XCTAssertEqual(readBaseline.count, 2ul);
+  XCTAssertTrue([readBaseline containsCheckResult:elementResult.checkResults[0]
+                                 elementReference:element]);
+}
+
+#pragma mark - Private
+
+/**
+ * @return A check result failing @c kGSCXTestAccessibilityLabelCheckName.
+ */
+- (GTXCheckResult *)gscx_labelCheckResult {
+  return [[GTXCheckResult alloc] initWithCheckName:kGSCXTestAccessibilityLabelCheckName
+                                  errorDescription:kGSCXTestAccessibilityLabelCheckDescription];
+}
+
+/**
+ * Constructs an element reference without an accessibility label.
+ *
+ * @param identifier The accessibility identifier of the element.
+ * @param frame The accessibility frame of the element.
+ * @return An element reference.
+ */
+- (GTXElementReference *)gscx_elementWithIdentifier:(nullable NSString *)identifier
+                                              frame:(CGRect)frame {
+  return [[GTXElementReference alloc] initWithElementAddress:0
+                                                elementClass:[UIView class]
+                                          accessibilityLabel:nil
+                                     accessibilityIdentifier:identifier
+                                          accessibilityFrame:frame
+                                          elementDescription:@"Description"];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,82 @@
+//
+// Copyright 2018 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXCheckCostModel.h"
+
+#import <XCTest/XCTest.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * The name of the check measured in these tests.
+ */
+static NSString *const kGSCXCheckCostModelTestsCheckName = @"Check";
+
+@interface GSCXCheckCostModelTests : XCTestCase
+@end
+
+@implementation GSCXCheckCostModelTests
+
+- (void)testFirstMeasurementInitializesCost {
+  GSCXCheckCostModel *model = [[GSCXCheckCostModel alloc] init];
+
+  XCTAssertFalse([model hasCostForCheckNamed:kGSCXCheckCostModelTestsCheckName]);
+  [model recordCheckDurations:@{kGSCXCheckCostModelTestsCheckName : @2.0} elementCount:4];
+
+  XCTAssertTrue([model hasCostForCheckNamed:kGSCXCheckCostModelTestsCheckName]);
+  XCTAssertEqualWithAccuracy([model costPerElementForCheckNamed:kGSCXCheckCostModelTestsCheckName],
+                             0.5, 1e-9);
+  XCTAssertEqual(model.lastScanElementCount, 4ul);
+  XCTAssertEqualWithAccuracy(model.lastScanDuration, 2.0, 1e-9);
+}
+
+- (void)testLaterMeasurementsAreSmoothed {
+  GSCXCheckCostModel *model = [[GSCXCheckCostModel alloc] initWithSmoothingFactor:0.25];
+
+  [model recordCheckDurations:@{kGSCXCheckCostModelTestsCheckName : @1.0} elementCount:1];
+  [model recordCheckDurations:@{kGSCXCheckCostModelTestsCheckName : @5.0} elementCount:1];
+
+  XCTAssertEqualWithAccuracy([model costPerElementForCheckNamed:kGSCXCheckCostModelTestsCheckName],
+                             2.0, 1e-9);
+}
+
+- (void)testCostIsMeasuredOverElementsCheckWasEvaluatedOn {
+  GSCXCheckCostModel *model = [[GSCXCheckCostModel alloc] init];
+
+  [model recordCheckDurations:@{kGSCXCheckCostModelTestsCheckName : @1.0}
+             evaluationCounts:@{kGSCXCheckCostModelTestsCheckName : @2}
+                 elementCount:10];
+
+  XCTAssertEqualWithAccuracy([model costPerElementForCheckNamed:kGSCXCheckCostModelTestsCheckName],
+                             0.5, 1e-9);
+  XCTAssertEqual(model.lastScanElementCount, 10ul);
+}
+
+- (void)testEmptyScanDoesNotUpdateCosts {
+  GSCXCheckCostModel *model = [[GSCXCheckCostModel alloc] init];
+
+  [model recordCheckDurations:@{kGSCXCheckCostModelTestsCheckName : @1.0} elementCount:0];
+
+  XCTAssertFalse([model hasCostForCheckNamed:kGSCXCheckCostModelTestsCheckName]);
+  XCTAssertEqual([model costPerElementForCheckNamed:kGSCXCheckCostModelTestsCheckName], 0.0);
+  [model recordCheckDurations:@{kGSCXCheckCostModelTestsCheckName : @1.0} elementCount:1];
+  [model reset];
+  XCTAssertFalse([model hasCostForCheckNamed:kGSCXCheckCostModelTestsCheckName]);
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,253 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXCompactResultStore.h"
+
+#import <XCTest/XCTest.h>
+
+#import "GSCXTestCheckNames.h"
+#import "GTXHierarchyResultCollection+GSCXCompleteness.h"
+#import "GTXHierarchyResultCollection+GSCXScreenshot.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * The number of results stored in memory benchmarks.
+ */
+static const NSUInteger kGSCXCompactResultStoreTestsBenchmarkResultCount = 2000;
+
+/**
+ * The number of elements in each result stored in memory benchmarks.
+ */
+static const NSUInteger kGSCXCompactResultStoreTestsBenchmarkElementCount = 10;
+
+/**
+ * The number of times a result is replaced in tests of reclaiming replaced results.
+ */
+static const NSUInteger kGSCXCompactResultStoreTestsReplacementCount = 1000;
+
+@interface GSCXCompactResultStoreTests : XCTestCase
+
+/**
+ * A blank image passed to @c GTXHierarchyResultCollection initializers.
+ */
+@property(strong, nonatomic) UIImage *dummyImage;
+
+@end
+
+@implementation GSCXCompactResultStoreTests
+
+- (void)setUp {
+  [super setUp];
+  UIGraphicsBeginImageContext(CGSizeMake(1.0, 1.0));
+  self.dummyImage = UIGraphicsGetImageFromCurrentImageContext();
+  UIGraphicsEndImageContext();
+}
+
+- (void)testStoredResultsConvertBackToEquivalentResults {
+  GSCXCompactResultStore *store = [[GSCXCompactResultStore alloc] init];
+  GTXHierarchyResultCollection *result = [self gscx_resultWithElementCount:2 labelPrefix:@"A"];
+  result.gscx_screenshotFrame = CGRectMake(1, 2, 3, 4);
+  result.gscx_incomplete = YES;
+  result.gscx_throttledCheckNames = @[ kGSCXTestContrastRatioCheckName ];
+  XCTAssertEqual([store addResult:result], 0);
+  XCTAssertEqual([store addResult:[self gscx_resultWithElementCount:0 labelPrefix:@"B"]], 1);
+
+  GTXHierarchyResultCollection *storedResult = [store resultAtIndex:0];
+  XCTAssertEqual([store resultCount], 2);
+  XCTAssertEqual([store checkResultCount], 4);
+  XCTAssertEqual(storedResult.screenshot, result.screenshot);
+  XCTAssert(CGRectEqualToRect(storedResult.gscx_screenshotFrame, CGRectMake(1, 2, 3, 4)));
+  XCTAssertTrue(storedResult.gscx_isIncomplete);
+  XCTAssertEqualObjects(storedResult.gscx_throttledCheckNames,
+                        @[ kGSCXTestContrastRatioCheckName ]);
+  XCTAssertEqual(storedResult.elementResults.count, 2);
+  for (NSUInteger i = 0; i < 2; i++) {
+    GTXElementReference *expected = result.elementResults[i].elementReference;
+    GTXElementReference *actual = storedResult.elementResults[i].elementReference;
+    XCTAssertEqual(actual.elementAddress, expected.elementAddress);
+    XCTAssertEqual(actual.elementClass, expected.elementClass);
+    XCTAssertEqualObjects(actual.accessibilityLabel, expected.accessibilityLabel);
+    XCTAssertNil(actual.accessibilityIdentifier);
+    XCTAssert(CGRectEqualToRect(actual.accessibilityFrame, expected.accessibilityFrame));
+    XCTAssertEqualObjects(actual.elementDescription, expected.elementDescription);
+    XCTAssertEqualObjects(storedResult.elementResults[i].checkResults[1].checkName,
+                          kGSCXTestContrastRatioCheckName);
+    XCTAssertEqualObjects(storedResult.elementResults[i].checkResults[1].errorDescription,
+                          kGSCXTestContrastRatioCheckDescription);
+  }
+  XCTAssertEqual([store resultAtIndex:1].elementResults.count, 0);
+  XCTAssertFalse([store resultAtIndex:1].gscx_isIncomplete);
+  XCTAssertEqualObjects([store resultAtIndex:1].gscx_throttledCheckNames, @[]);
+}
+
+- (void)testRepeatedStringsAreInternedOnce {
+  GSCXCompactResultStore *store = [[GSCXCompactResultStore alloc] init];
+  for (NSUInteger i = 0; i < 10; i++) {
+    [store addResult:[self gscx_resultWithElementCount:3 labelPrefix:@"A"]];
+  }
+  // 3 labels, 1 class name, 1 element description, 2 error descriptions and 2 check names.
+  XCTAssertEqual([store internedStringCount], 9);
+  XCTAssertEqual([store resultAtIndex:0].elementResults[0].elementReference.accessibilityLabel,
+                 [store resultAtIndex:9].elementResults[0].elementReference.accessibilityLabel);
+}
+
+- (void)testReplacingResultsUpdatesCounts {
+  GSCXCompactResultStore *store = [[GSCXCompactResultStore alloc] init];
+  GTXHierarchyResultCollection *result = [self gscx_resultWithElementCount:2 labelPrefix:@"A"];
+  [store addResult:result];
+  [store replaceResultAtIndex:0 withResult:[self gscx_resultWithElementCount:1 labelPrefix:@"B"]];
+  XCTAssertEqual([store resultCount], 1);
+  XCTAssertEqual([store checkResultCount], 2);
+  GTXElementReference *elementReference =
+      [store resultAtIndex:0].elementResults[0].elementReference;
+  XCTAssertEqualObjects(elementReference.accessibilityLabel, @"B0");
+
+  UIGraphicsBeginImageContext(CGSizeMake(2.0, 2.0));
+  UIImage *otherImage = UIGraphicsGetImageFromCurrentImageContext();
+  UIGraphicsEndImageContext();
+  [store setScreenshot:otherImage forResultAtIndex:0];
+  XCTAssertEqual([store resultAtIndex:0].screenshot, otherImage);
+  XCTAssertEqual([store indexOfResultWithScreenshot:otherImage], 0);
+  XCTAssertEqual([store indexOfResultWithScreenshot:self.dummyImage], NSNotFound);
+
+  [store removeAllResults];
+  XCTAssertEqual([store resultCount], 0);
+  XCTAssertEqual([store checkResultCount], 0);
+  XCTAssertEqual([store internedStringCount], 0);
+}
+
+- (void)testReplacingResultRepeatedlyKeepsStoreBounded {
+  GSCXCompactResultStore *store = [[GSCXCompactResultStore alloc] init];
+  [store addResult:[self gscx_resultWithElementCount:10 labelPrefix:@"A"]];
+  [store addResult:[self gscx_resultWithElementCount:3 labelPrefix:@"B"]];
+  NSUInteger maximumByteCount = 0;
+  NSUInteger maximumStringCount = 0;
+  for (NSUInteger i = 0; i < kGSCXCompactResultStoreTestsReplacementCount; i++) {
+    // Fixed width labels keep the size of each replacement the same.
+    NSString *labelPrefix = [NSString stringWithFormat:@"R%04lu-", (unsigned long)i];
+    [store replaceResultAtIndex:0
+                     withResult:[self gscx_resultWithElementCount:10 labelPrefix:labelPrefix]];
+    if (i < kGSCXCompactResultStoreTestsReplacementCount / 2) {
+      maximumByteCount = MAX(maximumByteCount, [store estimatedByteCount]);
+      maximumStringCount = MAX(maximumStringCount, [store internedStringCount]);
+    } else {
+      XCTAssertLessThanOrEqual([store estimatedByteCount], maximumByteCount);
+      XCTAssertLessThanOrEqual([store internedStringCount], maximumStringCount);
+    }
+  }
+  XCTAssertEqual([store resultCount], 2);
+  XCTAssertEqual([store checkResultCount], 26);
+  NSUInteger lastReplacement = kGSCXCompactResultStoreTestsReplacementCount - 1;
+  NSString *lastLabel =
+      [NSString stringWithFormat:@"R%04lu-9", (unsigned long)lastReplacement];
+  XCTAssertEqualObjects(
+      [store resultAtIndex:0].elementResults[9].elementReference.accessibilityLabel, lastLabel);
+  XCTAssertEqualObjects(
+      [store resultAtIndex:1].elementResults[2].elementReference.accessibilityLabel, @"B2");
+}
+
+- (void)testResultsAreConvertedOnAccess {
+  GSCXCompactResultStore *store = [[GSCXCompactResultStore alloc] init];
+  [store addResult:[self gscx_resultWithElementCount:1 labelPrefix:@"A"]];
+  [store addResult:[self gscx_resultWithElementCount:2 labelPrefix:@"B"]];
+  NSArray<GTXHierarchyResultCollection *> *results = [store results];
+  [store addResult:[self gscx_resultWithElementCount:3 labelPrefix:@"C"]];
+  [store replaceResultAtIndex:1 withResult:[self gscx_resultWithElementCount:4 labelPrefix:@"D"]];
+
+  XCTAssertEqual(results.count, 2);
+  XCTAssertEqual([results copy], results);
+  XCTAssertEqual(results[0].elementResults.count, 1);
+  XCTAssertEqual(results[1].elementResults.count, 4);
+  XCTAssertThrows([results objectAtIndex:2]);
+}
+
+- (void)testMemoryOfResultObjects {
+  [self measureWithMetrics:@[ [[XCTMemoryMetric alloc] init] ]
+                     block:^{
+                       NSMutableArray<GTXHierarchyResultCollection *> *results =
+                           [[NSMutableArray alloc] init];
+                       for (NSUInteger i = 0; i < kGSCXCompactResultStoreTestsBenchmarkResultCount;
+                            i++) {
+                         [results addObject:[self gscx_benchmarkResult]];
+                       }
+                     }];
+}
+
+- (void)testMemoryOfCompactResultStore {
+  [self measureWithMetrics:@[ [[XCTMemoryMetric alloc] init] ]
+                     block:^{
+                       GSCXCompactResultStore *store = [[GSCXCompactResultStore alloc] init];
+                       for (NSUInteger i = 0; i < kGSCXCompactResultStoreTestsBenchmarkResultCount;
+                            i++) {
+                         @autoreleasepool {
+                           [store addResult:[self gscx_benchmarkResult]];
+                         }
+                       }
+                     }];
+}
+
+#pragma mark - Private
+
+/**
+ * Constructs a result whose elements each fail two checks.
+ *
+ * @param elementCount The number of elements in the result.
+ * @param labelPrefix The prefix of each element's accessibility label. The label is the prefix
+ *  followed by the element's index.
+ * @return A result with @c elementCount elements.
+ */
+- (GTXHierarchyResultCollection *)gscx_resultWithElementCount:(NSUInteger)elementCount
+                                                  labelPrefix:(NSString *)labelPrefix {
+  NSMutableArray<GTXElementResultCollection *> *elementResults = [[NSMutableArray alloc] init];
+  for (NSUInteger i = 0; i < elementCount; i++) {
+    // Builds the strings from scratch, like GTXiLib does for each scan, so they are distinct
+    // objects with equal contents.
+    NSString *label = [NSString stringWithFormat:@"%@%lu", labelPrefix, (unsigned long)i];
+    NSString *elementDescription = [NSString stringWithFormat:@"<UIView: %@>", @"description"];
+    GTXElementReference *elementReference =
+        [[GTXElementReference alloc] initWithElementAddress:i + 1
+                                               elementClass:[UIView class]
+                                         accessibilityLabel:label
+                                    accessibilityIdentifier:nil
+                                         accessibilityFrame:CGRectMake(i, i, 10, 10)
+                                         elementDescription:elementDescription];
+    NSArray<GTXCheckResult *> *checkResults = @[
+      [[GTXCheckResult alloc] initWithCheckName:kGSCXTestAccessibilityLabelCheckName
+                               errorDescription:kGSCXTestAccessibilityLabelCheckDescription],
+      [[GTXCheckResult alloc]
+          initWithCheckName:kGSCXTestContrastRatioCheckName
+           errorDescription:[kGSCXTestContrastRatioCheckDescription mutableCopy]]
+    ];
+    [elementResults addObject:[[GTXElementResultCollection alloc] initWithElement:elementReference
+                                                                     checkResults:checkResults]];
+  }
+  return [[GTXHierarchyResultCollection alloc] initWithElementResults:elementResults
+                                                           screenshot:self.dummyImage];
+}
+
+/**
+ * @return A result with @c kGSCXCompactResultStoreTestsBenchmarkElementCount elements, typical of
+ *  a screen scanned repeatedly in a continuous session.
+ */
+- (GTXHierarchyResultCollection *)gscx_benchmarkResult {
+  return [self gscx_resultWithElementCount:kGSCXCompactResultStoreTestsBenchmarkElementCount
+                               labelPrefix:@"Element "];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,177 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXContinuousScannerGalleryViewController.h"
+
+#import <XCTest/XCTest.h>
+
+#import "GSCXContinuousScannerGalleryDetailViewData.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * The number of element results in the gallery, enough that most pages are not neighbors.
+ */
+static const NSUInteger kGSCXGalleryTestsElementCount = 10;
+
+/**
+ * The maximum number of detail views the gallery keeps: the current page and one neighbor on
+ * either side.
+ */
+static const NSUInteger kGSCXGalleryTestsMaximumDetailViewCount = 3;
+
+@interface GSCXContinuousScannerGalleryViewController (ExposedForTesting)
+- (NSMutableDictionary<NSNumber *, GSCXContinuousScannerGalleryDetailViewData *> *)detailViews;
+- (NSMutableArray<GSCXContinuousScannerGalleryDetailViewData *> *)reusableDetailViews;
+@end
+
+@interface GSCXContinuousScannerGalleryViewControllerTests : XCTestCase
+
+/**
+ * The window displaying @c galleryController.
+ */
+@property(strong, nonatomic) UIWindow *window;
+
+/**
+ * The gallery under test, displaying a result with @c kGSCXGalleryTestsElementCount elements.
+ */
+@property(strong, nonatomic) GSCXContinuousScannerGalleryViewController *galleryController;
+
+@end
+
+@implementation GSCXContinuousScannerGalleryViewControllerTests
+
+- (void)setUp {
+  [super setUp];
+  self.galleryController = [[GSCXContinuousScannerGalleryViewController alloc]
+      initWithNibName:@"GSCXContinuousScannerGalleryViewController"
+               bundle:[NSBundle bundleForClass:[GSCXContinuousScannerGalleryViewController class]]
+               result:[self gscx_resultWithElementCount:kGSCXGalleryTestsElementCount]];
+  self.window = [[UIWindow alloc] initWithFrame:[UIScreen mainScreen].bounds];
+  self.window.rootViewController = self.galleryController;
+  [self.window makeKeyAndVisible];
+  [self.window layoutIfNeeded];
+}
+
+- (void)tearDown {
+  self.window.hidden = YES;
+  self.window = nil;
+  self.galleryController = nil;
+  [super tearDown];
+}
+
+- (void)testOnlyNeighboringPagesHaveDetailViews {
+  for (NSInteger page = 0; page < (NSInteger)kGSCXGalleryTestsElementCount; page++) {
+    [self.galleryController focusIssueAtIndex:page animated:NO];
+
+    NSMutableSet<NSNumber *> *expectedPages = [[NSMutableSet alloc] init];
+    for (NSInteger neighbor = MAX(0, page - 1);
+         neighbor <= MIN(page + 1, (NSInteger)kGSCXGalleryTestsElementCount - 1); neighbor++) {
+      [expectedPages addObject:@(neighbor)];
+    }
+    XCTAssertEqualObjects([NSSet setWithArray:[self.galleryController.detailViews allKeys]],
+                          expectedPages, @"Unexpected detail views on page %ld", (long)page);
+    for (GSCXContinuousScannerGalleryDetailViewData *detailView in
+             [self.galleryController.detailViews allValues]) {
+      XCTAssertFalse(detailView.containerView.hidden);
+    }
+    for (GSCXContinuousScannerGalleryDetailViewData *detailView in
+             self.galleryController.reusableDetailViews) {
+      XCTAssertTrue(detailView.containerView.hidden);
+    }
+  }
+}
+
+- (void)testDetailViewsAreReusedWhilePaging {
+  NSHashTable<GSCXContinuousScannerGalleryDetailViewData *> *allDetailViews =
+      [NSHashTable weakObjectsHashTable];
+  for (NSInteger page = 0; page < (NSInteger)kGSCXGalleryTestsElementCount; page++) {
+    [self.galleryController focusIssueAtIndex:page animated:NO];
+    for (GSCXContinuousScannerGalleryDetailViewData *detailView in
+             [self.galleryController.detailViews allValues]) {
+      [allDetailViews addObject:detailView];
+    }
+    XCTAssertLessThanOrEqual(self.galleryController.detailViews.count +
+                                 self.galleryController.reusableDetailViews.count,
+                             kGSCXGalleryTestsMaximumDetailViewCount);
+  }
+  XCTAssertEqual(allDetailViews.count, kGSCXGalleryTestsMaximumDetailViewCount);
+
+  // Jumping to a page with no visible neighbors recycles every detail view instead of creating new
+  // ones.
+  [self.galleryController focusIssueAtIndex:1 animated:NO];
+  XCTAssertEqual(self.galleryController.reusableDetailViews.count, 0ul);
+  for (GSCXContinuousScannerGalleryDetailViewData *detailView in
+           [self.galleryController.detailViews allValues]) {
+    XCTAssertTrue([allDetailViews containsObject:detailView]);
+    // Reused views only display the new page's check: one title and one description label.
+    XCTAssertEqual(detailView.stackView.arrangedSubviews.count, 2ul);
+  }
+}
+
+- (void)testDetailViewReusesCheckLabels {
+  GSCXContinuousScannerGalleryDetailViewData *detailView =
+      [[GSCXContinuousScannerGalleryDetailViewData alloc] init];
+  [detailView addCheckWithTitle:@"Title 1" contents:@"Contents 1"];
+  NSArray<UIView *> *labels = [detailView.stackView.arrangedSubviews copy];
+
+  [detailView removeAllChecks];
+  XCTAssertEqual(detailView.stackView.arrangedSubviews.count, 0ul);
+  XCTAssertNil(labels[0].superview);
+  [detailView addCheckWithTitle:@"Title 2" contents:@"Contents 2"];
+
+  XCTAssertEqual(detailView.stackView.arrangedSubviews.count, 2ul);
+  for (UIView *label in detailView.stackView.arrangedSubviews) {
+    XCTAssertTrue([labels containsObject:label]);
+  }
+  NSString *titleText = ((UILabel *)detailView.stackView.arrangedSubviews[0]).text;
+  XCTAssertEqualObjects(titleText, @"Title 2");
+}
+
+#pragma mark - Private
+
+/**
+ * Constructs a scan result with @c count elements at different positions, each failing one check.
+ *
+ * @param count The number of element results.
+ * @return The scan result.
+ */
+- (GTXHierarchyResultCollection *)gscx_resultWithElementCount:(NSUInteger)count {
+  NSMutableArray<GTXElementResultCollection *> *elementResults = [[NSMutableArray alloc] init];
+  for (NSUInteger i = 0; i < count; i++) {
+    GTXElementReference *elementReference =
+        [[GTXElementReference alloc] initWithElementAddress:0
+                                               elementClass:[UIView class]
+                                         accessibilityLabel:nil
+                                    accessibilityIdentifier:nil
+                                         accessibilityFrame:CGRectMake(i * 10.0, i * 10.0, 10, 10)
+                                         elementDescription:@"Description"];
+    GTXCheckResult *checkResult = [[GTXCheckResult alloc] initWithCheckName:@"Check"
+                                                           errorDescription:@"Description"];
+    [elementResults addObject:[[GTXElementResultCollection alloc]
+                                  initWithElement:elementReference
+                                     checkResults:@[ checkResult ]]];
+  }
+  UIGraphicsBeginImageContext(CGSizeMake(count * 10.0, count * 10.0));
+  UIImage *screenshot = UIGraphicsGetImageFromCurrentImageContext();
+  UIGraphicsEndImageContext();
+  return [[GTXHierarchyResultCollection alloc] initWithElementResults:elementResults
+                                                           screenshot:screenshot];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -248,8 +248,60 @@ NS_ASSUME_NONNULL_BEGIN
                                                rowTitles:expectedRowTitles];
 }
 
+- (void)testSectionsWithUniqueIssuesByScreenIndexAreOrderedByScreen {
+  NSArray<GTXHierarchyResultCollection *> *results = @[
+    [[GTXHierarchyResultCollection alloc]
+        initWithElementResults:@[ self.elementWithAccessibilityLabelCheck ]
+                    screenshot:self.dummyImage],
+    [[GTXHierarchyResultCollection alloc]
+        initWithElementResults:@[ self.elementWithTouchTargetCheck ]
+                    screenshot:self.dummyImage],
+    [[GTXHierarchyResultCollection alloc] initWithElementResults:@[ self.elementWithThreeChecks ]
+                                                      screenshot:self.dummyImage],
+  ];
+  GSCXUniqueIssue *firstScreenIssue =
+      [self gscxtest_uniqueIssueWithElementResult:self.elementWithAccessibilityLabelCheck
+                                        scanIndex:0];
+  GSCXUniqueIssue *secondScreenIssue =
+      [self gscxtest_uniqueIssueWithElementResult:self.elementWithTouchTargetCheck scanIndex:1];
+  GSCXUniqueIssue *repeatedScreenIssue =
+      [self gscxtest_uniqueIssueWithElementResult:self.elementWithThreeChecks scanIndex:2];
+
+  NSArray<GSCXScannerIssueTableViewSection *> *sections = [GSCXContinuousScannerListTabBarUtils
+      sectionsWithUniqueIssuesByScreenIndex:@{
+        @1 : @[ secondScreenIssue ],
+        @0 : @[ firstScreenIssue, repeatedScreenIssue ],
+      }
+                                  inResults:results];
+
+  XCTAssertEqual(sections.count, 2ul);
+  XCTAssertEqualObjects(sections[0].title, @"Screen 1");
+  XCTAssertEqual([sections[0] numberOfRows], 2ul);
+  XCTAssertEqual([sections[0] rowAtIndex:1].originalResult, results[2]);
+  XCTAssertEqualObjects(sections[1].title, @"Screen 2");
+  XCTAssertEqual([sections[1] numberOfRows], 1ul);
+}
+
 #pragma mark - Private
 
+/**
+ * Constructs a unique issue for the first check result of @c elementResult.
+ *
+ * @param elementResult The element the issue occurred on, at index 0 of its result.
+ * @param scanIndex The index of the result containing @c elementResult.
+ * @return A unique issue seen once, in the result at @c scanIndex.
+ */
+- (GSCXUniqueIssue *)gscxtest_uniqueIssueWithElementResult:
+                         (GTXElementResultCollection *)elementResult
+                                                 scanIndex:(NSUInteger)scanIndex {
+  GTXCheckResult *checkResult = elementResult.checkResults[0];
+  return [[GSCXUniqueIssue alloc] initWithIssueKey:checkResult.checkName
+                                       checkResult:checkResult
+                          originalElementReference:elementResult.elementReference
+                              originalElementIndex:0
+                                         scanIndex:scanIndex];
+}
+
 /**
  * Constructs an array of @c GSCXScannerIssueTableViewSection instances using
  * @c sectionsWithGroupedByScanResults and compares its structure to @c results. If the sections,
@@ -0,0 +1,117 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXContinuousScannerScreenshotViewController.h"
+
+#import <XCTest/XCTest.h>
+
+#import "GSCXDefaultSharingDelegate.h"
+#import "GSCXScannerResultCarousel.h"
+#import "third_party/objective_c/GSCXScanner/Tests/Common/GSCXCommonTestUtils.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * The number of results in a long continuous scanning session.
+ */
+static const NSUInteger kGSCXLongSessionResultCount = 500;
+
+/**
+ * The time, in seconds, to wait for the carousel to finish loading.
+ */
+static const NSTimeInterval kGSCXCarouselLoadingTimeout = 10.0;
+
+@interface GSCXContinuousScannerScreenshotViewController (ExposedForTesting)
+- (GSCXScannerResultCarousel *)carousel;
+@end
+
+@interface GSCXContinuousScannerScreenshotViewControllerTests : XCTestCase
+
+/**
+ * Results of a long continuous scanning session.
+ */
+@property(strong, nonatomic) NSArray<GTXHierarchyResultCollection *> *longSessionResults;
+
+@end
+
+@implementation GSCXContinuousScannerScreenshotViewControllerTests
+
+- (void)setUp {
+  [super setUp];
+  NSMutableArray<GTXHierarchyResultCollection *> *results = [NSMutableArray array];
+  for (NSUInteger i = 0; i < kGSCXLongSessionResultCount; i++) {
+    [results addObject:[GSCXCommonTestUtils newHierarchyResultCollection]];
+  }
+  self.longSessionResults = results;
+}
+
+- (void)testCarouselDisplayResultsUpToCountIncreasesResultCount {
+  GSCXScannerResultCarousel *carousel = [[GSCXScannerResultCarousel alloc]
+           initWithResults:self.longSessionResults
+      displayedResultCount:1
+            selectionBlock:^(NSUInteger index, GTXHierarchyResultCollection *result){
+            }];
+  XCTAssertEqual([carousel resultCount], 1);
+  [carousel displayResultsUpToCount:10];
+  XCTAssertEqual([carousel resultCount], 10);
+  [carousel displayResultsUpToCount:5];
+  XCTAssertEqual([carousel resultCount], 10);
+  [carousel displayResultsUpToCount:self.longSessionResults.count + 1];
+  XCTAssertEqual([carousel resultCount], self.longSessionResults.count);
+}
+
+- (void)testCarouselLoadsRemainingResultsAfterFirstFrame {
+  GSCXContinuousScannerScreenshotViewController *viewController =
+      [[GSCXContinuousScannerScreenshotViewController alloc]
+          initWithScannerResults:self.longSessionResults
+                 sharingDelegate:[[GSCXDefaultSharingDelegate alloc] init]];
+  UIWindow *window = [[UIWindow alloc] initWithFrame:[UIScreen mainScreen].bounds];
+  window.rootViewController = viewController;
+  [window makeKeyAndVisible];
+  [window layoutIfNeeded];
+  XCTAssertEqual([viewController.carousel resultCount], 1);
+
+  NSDate *deadline = [NSDate dateWithTimeIntervalSinceNow:kGSCXCarouselLoadingTimeout];
+  NSUInteger previousCount = 1;
+  BOOL grewIncrementally = NO;
+  while ([viewController.carousel resultCount] < self.longSessionResults.count &&
+         [deadline timeIntervalSinceNow] > 0) {
+    [[NSRunLoop mainRunLoop] runMode:NSDefaultRunLoopMode
+                          beforeDate:[NSDate dateWithTimeIntervalSinceNow:0.01]];
+    NSUInteger count = [viewController.carousel resultCount];
+    grewIncrementally |= count > previousCount && count < self.longSessionResults.count;
+    previousCount = count;
+  }
+  XCTAssertEqual([viewController.carousel resultCount], self.longSessionResults.count);
+  XCTAssertTrue(grewIncrementally);
+  window.hidden = YES;
+}
+
+- (void)testFirstFrameLatencyForLongSession {
+  GSCXDefaultSharingDelegate *sharingDelegate = [[GSCXDefaultSharingDelegate alloc] init];
+  [self measureBlock:^{
+    GSCXContinuousScannerScreenshotViewController *viewController =
+        [[GSCXContinuousScannerScreenshotViewController alloc]
+            initWithScannerResults:self.longSessionResults
+                   sharingDelegate:sharingDelegate];
+    [viewController loadViewIfNeeded];
+    [viewController.view layoutIfNeeded];
+  }];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
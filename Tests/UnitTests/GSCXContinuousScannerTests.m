@@ -250,6 +250,148 @@ static NSString *const kGSCXContinuousScannerTestAccessibilityIdentifier2 =
   XCTAssertEqual([self.scanResults[2] checkResultCount], 4);
 }
 
+- (void)testContinuousScannerKeepsLatestResultPerScreen {
+  self.scanner.screenRetention = GSCXContinuousScannerScreenRetentionLatestPerScreen;
+  self.rootViewsToScan = @[ self.rootViewWithIssues ];
+  [self.scanner startScanning];
+  [self.scheduler triggerScheduleScanEvent];
+  [self.scheduler triggerScheduleScanEvent];
+  XCTAssertEqual(self.scanResults.count, 2);
+  XCTAssertEqual(self.scanner.scanResults.count, 1);
+  XCTAssertEqual(self.scanner.scanResults[0], self.scanResults[1]);
+  XCTAssertEqual([self.scanner uniqueIssueCount], 1);
+  self.rootViewsToScan = @[ self.alternateRootViewWithIssues ];
+  [self.scheduler triggerScheduleScanEvent];
+  XCTAssertEqual(self.scanner.scanResults.count, 2);
+  XCTAssertEqual([self.scanner.screenClusterer screenCount], 2);
+}
+
+- (void)testContinuousScannerMergesResultsPerScreen {
+  self.scanner.screenRetention = GSCXContinuousScannerScreenRetentionMergedPerScreen;
+  self.rootViewsToScan = @[ self.rootViewWithIssues ];
+  [self.scanner startScanning];
+  [self.scheduler triggerScheduleScanEvent];
+  [self.scheduler triggerScheduleScanEvent];
+  XCTAssertEqual(self.scanner.scanResults.count, 1);
+  XCTAssertEqual(self.scanner.scanResults[0], self.scanResults[0]);
+  XCTAssertEqual([self.scanner issueCount], 1);
+}
+
+- (void)testContinuousScannerStoresResultsCompactly {
+  self.scanner.usesCompactResultStore = YES;
+  self.rootViewsToScan = @[ self.rootViewWithIssues ];
+  [self.scanner startScanning];
+  [self.scheduler triggerScheduleScanEvent];
+  self.rootViewsToScan = @[ self.rootViewWithIssues, self.alternateRootViewWithIssues ];
+  [self.scheduler triggerScheduleScanEvent];
+  XCTAssertEqual(self.scanner.scanResults.count, 2);
+  XCTAssertEqual([self.scanner issueCount], 3);
+  XCTAssertEqual([self.scanner.scanResults[1] checkResultCount], 2);
+  XCTAssertEqualObjects(self.scanner.scanResults[0].elementResults[0].checkResults[0].checkName,
+                        self.scanResults[0].elementResults[0].checkResults[0].checkName);
+  XCTAssertEqual(self.scanner.scanResults[1].screenshot, self.scanResults[1].screenshot);
+}
+
+- (void)testContinuousScannerSkipsScansOverScreenQuota {
+  self.scanner.screenScanQuota = [GSCXScreenScanQuota quotaWithMaximumScansPerScreen:1
+                                                                          timeWindow:600.0];
+  self.rootViewsToScan = @[ self.rootViewWithIssues ];
+  [self.scanner startScanning];
+  [self.scheduler triggerScheduleScanEvent];
+  [self.scheduler triggerScheduleScanEvent];
+  XCTAssertEqual(self.scanResults.count, 1);
+  self.rootViewsToScan = @[ self.alternateRootViewWithIssues ];
+  [self.scheduler triggerScheduleScanEvent];
+  XCTAssertEqual(self.scanResults.count, 2);
+}
+
+- (void)testScreenScanQuotaResetsAfterTimeWindowAndEvictsLeastRecentlySeenScreen {
+  GSCXScreenScanQuota *quota = [[GSCXScreenScanQuota alloc] initWithMaximumScansPerScreen:2
+                                                                               timeWindow:10.0
+                                                                                 capacity:2];
+  XCTAssertTrue([quota shouldScanScreenAtIndex:0 time:0.0]);
+  XCTAssertTrue([quota shouldScanScreenAtIndex:0 time:1.0]);
+  XCTAssertFalse([quota shouldScanScreenAtIndex:0 time:2.0]);
+  XCTAssertTrue([quota shouldScanScreenAtIndex:0 time:10.0]);
+  XCTAssertTrue([quota shouldScanScreenAtIndex:1 time:11.0]);
+  XCTAssertTrue([quota shouldScanScreenAtIndex:2 time:12.0]);
+  XCTAssertEqual([quota trackedScreenCount], 2);
+  // Screen 0 was evicted, so its quota starts over.
+  XCTAssertTrue([quota shouldScanScreenAtIndex:0 time:13.0]);
+  XCTAssertTrue([quota shouldScanScreenAtIndex:0 time:14.0]);
+  XCTAssertFalse([quota shouldScanScreenAtIndex:0 time:15.0]);
+}
+
+- (void)testContinuousScannerRotatesProfiles {
+  [self.manualScanner
+      addProfile:[GSCXCheckProfile profileWithName:@"Empty" checks:@[] excludeLists:@[]]];
+  self.scanner.profileRotation = @[ @"Empty", @"Empty", [NSNull null] ];
+  self.rootViewsToScan = @[ self.rootViewWithIssues ];
+  [self.scanner startScanning];
+  for (NSUInteger i = 0; i < 6; i++) {
+    [self.scheduler triggerScheduleScanEvent];
+  }
+  XCTAssertEqual(self.scanResults.count, 6);
+  XCTAssertEqual([self.scanner issueCount], 2);
+  XCTAssertEqual([self.scanResults[2] checkResultCount], 1);
+  XCTAssertEqual([self.scanResults[5] checkResultCount], 1);
+  XCTAssertNil(self.manualScanner.activeProfileName);
+}
+
+- (void)testContinuousScannerThrottlesChecksAlreadyRunOnScreen {
+  self.scanner.checkTimeBudgetPerMinute = DBL_MIN;
+  self.rootViewsToScan = @[ self.rootViewWithIssues ];
+  [self.scanner startScanning];
+  [self.scheduler triggerScheduleScanEvent];
+  [self.scheduler triggerScheduleScanEvent];
+  self.rootViewsToScan = @[ self.alternateRootViewWithIssues ];
+  [self.scheduler triggerScheduleScanEvent];
+  XCTAssertEqual(self.scanResults.count, 3);
+  XCTAssertEqual([self.scanResults[0] checkResultCount], 1);
+  XCTAssertEqual(self.scanResults[0].gscx_throttledCheckNames.count, 0ul);
+  XCTAssertEqual([self.scanResults[1] checkResultCount], 0);
+  XCTAssertEqual(self.scanResults[1].gscx_throttledCheckNames.count, 1ul);
+  XCTAssertEqual([self.scanResults[2] checkResultCount], 1);
+}
+
+- (void)testContinuousScannerSamplingCoversScreenWithinTickCount {
+  self.scanner.samplingTickCount = 3;
+  self.rootViewsToScan = @[ [self gscxtest_rootViewWithFailingElementCount:6] ];
+  [self.scanner startScanning];
+  for (NSUInteger i = 0; i < 4; i++) {
+    [self.scheduler triggerScheduleScanEvent];
+  }
+  XCTAssertEqual(self.scanResults.count, 4);
+  for (NSUInteger i = 0; i < 4; i++) {
+    XCTAssertLessThan([self.scanResults[i] checkResultCount], 6);
+  }
+  XCTAssertEqual(self.scanner.scanResults.count, 1);
+  XCTAssertEqual([self.scanner.scanResults[0] checkResultCount], 6);
+  XCTAssertEqual([self.scanner uniqueIssueCount], 6);
+}
+
+- (void)testContinuousScannerSamplingKeepsIssuesOfEvictedScreens {
+  self.scanner.samplingTickCount = 3;
+  self.scanner.screenScanQuota =
+      [[GSCXScreenScanQuota alloc] initWithMaximumScansPerScreen:100 timeWindow:600.0 capacity:1];
+  UIView *sampledRootView = [self gscxtest_rootViewWithFailingElementCount:6];
+  self.rootViewsToScan = @[ sampledRootView ];
+  [self.scanner startScanning];
+  for (NSUInteger i = 0; i < 4; i++) {
+    [self.scheduler triggerScheduleScanEvent];
+  }
+  XCTAssertEqual([self.scanner.scanResults[0] checkResultCount], 6);
+  // Sampling another screen evicts the first screen's rolling state.
+  self.rootViewsToScan = @[ self.alternateRootViewWithIssues ];
+  [self.scheduler triggerScheduleScanEvent];
+  self.rootViewsToScan = @[ sampledRootView ];
+  [self.scheduler triggerScheduleScanEvent];
+
+  XCTAssertLessThan([self.scanResults.lastObject checkResultCount], 6);
+  XCTAssertEqual(self.scanner.scanResults.count, 2);
+  XCTAssertEqual([self.scanner.scanResults[0] checkResultCount], 6);
+}
+
 #pragma mark - GSCXContinuousScannerDelegate
 
 - (void)continuousScannerWillStart:(GSCXContinuousScanner *)scanner {
@@ -261,6 +403,28 @@ static NSString *const kGSCXContinuousScannerTestAccessibilityIdentifier2 =
   self.scanResults = [self.scanResults arrayByAddingObject:result];
 }
 
+#pragma mark - Private
+
+/**
+ * Constructs a root view in the test window with @c count accessible subviews failing the test
+ * check, each with a distinct accessibility identifier.
+ *
+ * @param count The number of failing subviews.
+ * @return The root view.
+ */
+- (UIView *)gscxtest_rootViewWithFailingElementCount:(NSUInteger)count {
+  UIView *rootView = [[UIView alloc] initWithFrame:CGRectMake(0, 0, 100, 100)];
+  for (NSUInteger i = 0; i < count; i++) {
+    UIView *view = [[UIView alloc] initWithFrame:CGRectMake(i * 10, 0, 10, 10)];
+    view.isAccessibilityElement = YES;
+    view.tag = kGSCXTestCheckFailingElementTag;
+    view.accessibilityIdentifier = [NSString stringWithFormat:@"%lu", (unsigned long)i];
+    [rootView addSubview:view];
+  }
+  [self.rootViewWithIssues.window addSubview:rootView];
+  return rootView;
+}
+
 @end
 
 NS_ASSUME_NONNULL_END
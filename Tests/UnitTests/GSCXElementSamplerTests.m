@@ -0,0 +1,136 @@
+//
+// Copyright 2018 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXElementSampler.h"
+
+#import <UIKit/UIKit.h>
+#import <XCTest/XCTest.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface GSCXElementSamplerTests : XCTestCase
+
+/**
+ * Eight labels followed by four buttons, so samples are stratified across two classes.
+ */
+@property(strong, nonatomic) NSArray<UIView *> *elements;
+
+@end
+
+@implementation GSCXElementSamplerTests
+
+- (void)setUp {
+  [super setUp];
+  NSMutableArray<UIView *> *elements = [[NSMutableArray alloc] init];
+  for (NSUInteger i = 0; i < 8; i++) {
+    [elements addObject:[[UILabel alloc] init]];
+  }
+  for (NSUInteger i = 0; i < 4; i++) {
+    [elements addObject:[[UIButton alloc] init]];
+  }
+  self.elements = elements;
+}
+
+- (void)testEveryElementIsCoveredWithinTickCount {
+  GSCXElementSampler *sampler = [[GSCXElementSampler alloc] initWithTickCount:4];
+  NSMutableSet<UIView *> *sampledElements = [[NSMutableSet alloc] init];
+
+  for (NSUInteger tick = 0; tick < 4; tick++) {
+    NSArray *sample = [sampler sampleElements:self.elements];
+    XCTAssertEqual(sample.count, 3ul);
+    [sampledElements addObjectsFromArray:sample];
+  }
+
+  XCTAssertEqual(sampledElements.count, self.elements.count);
+  for (UIView *element in self.elements) {
+    XCTAssertTrue([sampler isElementCovered:element]);
+  }
+  XCTAssertEqual(sampler.completedRoundCount, 0ul);
+}
+
+- (void)testSamplesAreStratifiedAndOrdered {
+  GSCXElementSampler *sampler = [[GSCXElementSampler alloc] initWithTickCount:4];
+
+  NSArray *sample = [sampler sampleElements:self.elements];
+
+  XCTAssertEqualObjects(sample, (@[ self.elements[0], self.elements[1], self.elements[8] ]));
+}
+
+- (void)testNewRoundBeginsOnceEveryElementIsCovered {
+  GSCXElementSampler *sampler = [[GSCXElementSampler alloc] initWithTickCount:2];
+  [sampler sampleElements:self.elements];
+  [sampler sampleElements:self.elements];
+
+  NSArray *sample = [sampler sampleElements:self.elements];
+
+  XCTAssertEqual(sampler.completedRoundCount, 1ul);
+  XCTAssertEqual(sample.count, 6ul);
+  XCTAssertFalse([sampler isElementCovered:self.elements.lastObject]);
+  [sampler reset];
+  XCTAssertEqual(sampler.completedRoundCount, 0ul);
+  XCTAssertFalse([sampler isElementCovered:self.elements[0]]);
+}
+
+- (void)testRecreatedAccessibilityElementsAreCoveredWithinTickCount {
+  GSCXElementSampler *sampler = [[GSCXElementSampler alloc] initWithTickCount:2];
+  UIView *container = [[UIView alloc] init];
+  NSMutableArray<NSNumber *> *sampledFrameOrigins = [[NSMutableArray alloc] init];
+  NSArray<UIAccessibilityElement *> *elements;
+
+  for (NSUInteger tick = 0; tick < 2; tick++) {
+    // Containers often create new elements each time they are asked for them.
+    elements = [self gscx_accessibilityElementsInContainer:container];
+    NSArray *sample = [sampler sampleElements:elements];
+    XCTAssertEqual(sample.count, 2ul);
+    for (UIAccessibilityElement *element in sample) {
+      [sampledFrameOrigins addObject:@(element.accessibilityFrame.origin.x)];
+    }
+  }
+
+  // Each element is sampled exactly once, even though every tick sees new instances.
+  XCTAssertEqual(sampledFrameOrigins.count, 4ul);
+  XCTAssertEqual([NSSet setWithArray:sampledFrameOrigins].count, 4ul);
+  elements = [self gscx_accessibilityElementsInContainer:container];
+  for (UIAccessibilityElement *element in elements) {
+    XCTAssertTrue([sampler isElementCovered:element]);
+  }
+  XCTAssertEqual(sampler.completedRoundCount, 0ul);
+}
+
+#pragma mark - Private
+
+/**
+ * Creates four new accessibility elements in @c container, with distinct accessibility frames,
+ * and makes them the container's accessibility elements.
+ *
+ * @param container The container of the elements.
+ * @return The new elements.
+ */
+- (NSArray<UIAccessibilityElement *> *)gscx_accessibilityElementsInContainer:(UIView *)container {
+  NSMutableArray<UIAccessibilityElement *> *elements = [[NSMutableArray alloc] init];
+  for (NSUInteger i = 0; i < 4; i++) {
+    UIAccessibilityElement *element =
+        [[UIAccessibilityElement alloc] initWithAccessibilityContainer:container];
+    element.accessibilityFrame = CGRectMake(i * 10, 0, 10, 10);
+    [elements addObject:element];
+  }
+  container.accessibilityElements = elements;
+  return elements;
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
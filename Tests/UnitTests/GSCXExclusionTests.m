@@ -0,0 +1,140 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXExclusion.h"
+
+#import <XCTest/XCTest.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * The name passed as the check name to @c shouldIgnoreElement:forCheckNamed:.
+ */
+static NSString *const kGSCXExclusionTestsCheckName = @"Check";
+
+@interface GSCXExclusionTests : XCTestCase
+
+/**
+ * The window containing @c rootView.
+ */
+@property(strong, nonatomic) UIWindow *window;
+
+/**
+ * The root of the hierarchy. Contains a label and a table view.
+ */
+@property(strong, nonatomic) UIView *rootView;
+
+/**
+ * A label directly under @c rootView.
+ */
+@property(strong, nonatomic) UILabel *label;
+
+/**
+ * A table view directly under @c rootView, containing @c nestedView.
+ */
+@property(strong, nonatomic) UITableView *tableView;
+
+/**
+ * A view inside @c tableView.
+ */
+@property(strong, nonatomic) UIView *nestedView;
+
+@end
+
+@implementation GSCXExclusionTests
+
+- (void)setUp {
+  [super setUp];
+  CGRect frame = CGRectMake(0, 0, 100, 100);
+  self.window = [[UIWindow alloc] initWithFrame:frame];
+  self.rootView = [[UIView alloc] initWithFrame:frame];
+  self.label = [[UILabel alloc] initWithFrame:frame];
+  self.tableView = [[UITableView alloc] initWithFrame:frame];
+  self.nestedView = [[UIView alloc] initWithFrame:frame];
+  [self.tableView addSubview:self.nestedView];
+  [self.rootView addSubview:self.label];
+  [self.rootView addSubview:self.tableView];
+  [self.window addSubview:self.rootView];
+}
+
+- (void)testIndexExcludesNothingUntilPrepared {
+  GSCXExclusionIndex *index = [[GSCXExclusionIndex alloc] init];
+  [index addExclusion:[GSCXExclusion exclusionWithSubtreeRootedAtView:self.rootView]];
+
+  XCTAssertFalse([index shouldIgnoreElement:self.label forCheckNamed:kGSCXExclusionTestsCheckName]);
+  [index prepareWithRootViews:@[ self.rootView ]];
+  XCTAssertTrue([index shouldIgnoreElement:self.label forCheckNamed:kGSCXExclusionTestsCheckName]);
+  [index reset];
+  XCTAssertFalse([index shouldIgnoreElement:self.label forCheckNamed:kGSCXExclusionTestsCheckName]);
+}
+
+- (void)testSubtreeExclusionExcludesDescendantsAndContainedElements {
+  GSCXExclusionIndex *index = [[GSCXExclusionIndex alloc] init];
+  [index addExclusion:[GSCXExclusion exclusionWithSubtreeRootedAtView:self.tableView]];
+  UIAccessibilityElement *element =
+      [[UIAccessibilityElement alloc] initWithAccessibilityContainer:self.nestedView];
+
+  [index prepareWithRootViews:@[ self.rootView ]];
+
+  XCTAssertTrue([index shouldIgnoreElement:self.tableView
+                             forCheckNamed:kGSCXExclusionTestsCheckName]);
+  XCTAssertTrue([index shouldIgnoreElement:self.nestedView
+                             forCheckNamed:kGSCXExclusionTestsCheckName]);
+  XCTAssertTrue([index shouldIgnoreElement:element forCheckNamed:kGSCXExclusionTestsCheckName]);
+  XCTAssertFalse([index shouldIgnoreElement:self.label forCheckNamed:kGSCXExclusionTestsCheckName]);
+  XCTAssertFalse([index shouldIgnoreElement:self.rootView
+                              forCheckNamed:kGSCXExclusionTestsCheckName]);
+}
+
+- (void)testClassExclusionMatchesSubclasses {
+  GSCXExclusionIndex *index = [[GSCXExclusionIndex alloc] init];
+  [index addExclusion:[GSCXExclusion exclusionWithClass:[UIScrollView class]]];
+
+  [index prepareWithRootViews:@[ self.rootView ]];
+
+  XCTAssertTrue([index shouldIgnoreElement:self.nestedView
+                             forCheckNamed:kGSCXExclusionTestsCheckName]);
+  XCTAssertFalse([index shouldIgnoreElement:self.label forCheckNamed:kGSCXExclusionTestsCheckName]);
+}
+
+- (void)testWindowExclusionExcludesRootViewsInWindow {
+  GSCXExclusionIndex *index = [[GSCXExclusionIndex alloc] init];
+  [index addExclusion:[GSCXExclusion exclusionWithWindow:self.window]];
+
+  [index prepareWithRootViews:@[ self.rootView ]];
+
+  XCTAssertTrue([index shouldIgnoreElement:self.rootView
+                             forCheckNamed:kGSCXExclusionTestsCheckName]);
+  XCTAssertTrue([index shouldIgnoreElement:self.label forCheckNamed:kGSCXExclusionTestsCheckName]);
+}
+
+- (void)testRemovedExclusionNoLongerExcludes {
+  GSCXExclusionIndex *index = [[GSCXExclusionIndex alloc] init];
+  GSCXExclusion *exclusion = [GSCXExclusion exclusionWithAccessibilityIdentifier:@"label"];
+  self.label.accessibilityIdentifier = @"label";
+  [index addExclusion:exclusion];
+  [index addExclusion:exclusion];
+  [index removeExclusion:exclusion];
+
+  [index prepareWithRootViews:@[ self.rootView ]];
+
+  XCTAssertEqual(index.exclusions.count, 0ul);
+  XCTAssertFalse([index shouldIgnoreElement:self.label forCheckNamed:kGSCXExclusionTestsCheckName]);
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,136 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXIssueDeduplicator.h"
+
+#import <XCTest/XCTest.h>
+
+#import "GSCXTestCheckNames.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface GSCXIssueDeduplicatorTests : XCTestCase
+
+/**
+ * A blank image passed to @c GTXHierarchyResultCollection initializers.
+ */
+@property(strong, nonatomic) UIImage *dummyImage;
+
+@end
+
+@implementation GSCXIssueDeduplicatorTests
+
+- (void)setUp {
+  [super setUp];
+  UIGraphicsBeginImageContext(CGSizeMake(1.0, 1.0));
+  self.dummyImage = UIGraphicsGetImageFromCurrentImageContext();
+  UIGraphicsEndImageContext();
+}
+
+- (void)testRepeatedIssuesAreCountedOnce {
+  GSCXIssueDeduplicator *deduplicator = [GSCXIssueDeduplicator deduplicatorWithResults:@[
+    [self gscx_resultWithIdentifier:@"A" frame:CGRectMake(0, 0, 10, 10)],
+    [self gscx_resultWithIdentifier:@"A" frame:CGRectMake(0, 0, 10, 10)],
+    [self gscx_resultWithIdentifier:@"A" frame:CGRectMake(0.2, 0, 10, 10)]
+  ]];
+  XCTAssertEqual(deduplicator.scanCount, 3);
+  XCTAssertEqual([deduplicator uniqueIssueCount], 1);
+  GSCXUniqueIssue *issue = deduplicator.uniqueIssues[0];
+  XCTAssertEqual(issue.occurrenceCount, 3);
+  XCTAssertEqual(issue.firstSeenScanIndex, 0);
+  XCTAssertEqual(issue.lastSeenScanIndex, 2);
+  XCTAssertEqualObjects(issue.checkName, kGSCXTestAccessibilityLabelCheckName);
+}
+
+- (void)testDistinctElementsAreSeparateIssues {
+  GSCXIssueDeduplicator *deduplicator = [[GSCXIssueDeduplicator alloc] init];
+  [deduplicator addResult:[self gscx_resultWithIdentifier:@"A" frame:CGRectMake(0, 0, 10, 10)]];
+  [deduplicator addResult:[self gscx_resultWithIdentifier:@"B" frame:CGRectMake(0, 0, 10, 10)]];
+  [deduplicator addResult:[self gscx_resultWithIdentifier:@"A" frame:CGRectMake(0, 50, 10, 10)]];
+  XCTAssertEqual([deduplicator uniqueIssueCount], 3);
+  XCTAssertEqual(deduplicator.uniqueIssues[1].firstSeenScanIndex, 1);
+  XCTAssertEqual(deduplicator.uniqueIssues[2].firstSeenScanIndex, 2);
+  [deduplicator reset];
+  XCTAssertEqual([deduplicator uniqueIssueCount], 0);
+  XCTAssertEqual(deduplicator.scanCount, 0);
+}
+
+- (void)testDeduplicatedResultsContainOnlyFirstOccurrences {
+  NSArray<GTXHierarchyResultCollection *> *scanResults = @[
+    [self gscx_resultWithIdentifier:@"A" frame:CGRectMake(0, 0, 10, 10)],
+    [self gscx_resultWithIdentifier:@"A" frame:CGRectMake(0, 0, 10, 10)],
+    [self gscx_resultWithIdentifier:@"B" frame:CGRectMake(0, 0, 10, 10)]
+  ];
+  GSCXIssueDeduplicator *deduplicator = [GSCXIssueDeduplicator deduplicatorWithResults:scanResults];
+  NSArray<GTXHierarchyResultCollection *> *results =
+      [deduplicator deduplicatedResultsOfResults:scanResults];
+  XCTAssertEqual(results.count, 2);
+  XCTAssertEqualObjects(results[0].elementResults[0].elementReference.accessibilityIdentifier,
+                        @"A");
+  XCTAssertEqualObjects(results[1].elementResults[0].elementReference.accessibilityIdentifier,
+                        @"B");
+  XCTAssertEqual([results[0] checkResultCount], 1);
+  XCTAssertEqual([results[1] checkResultCount], 1);
+  XCTAssertEqual(results[1].screenshot, scanResults[2].screenshot);
+}
+
+- (void)testUniqueIssuesDoNotRetainResults {
+  GSCXIssueDeduplicator *deduplicator = [[GSCXIssueDeduplicator alloc] init];
+  __weak GTXHierarchyResultCollection *weakResult;
+  @autoreleasepool {
+    GTXHierarchyResultCollection *result =
+        [self gscx_resultWithIdentifier:@"A" frame:CGRectMake(0, 0, 10, 10)];
+    weakResult = result;
+    [deduplicator addResult:result];
+  }
+  XCTAssertNil(weakResult);
+  GSCXUniqueIssue *issue = deduplicator.uniqueIssues[0];
+  XCTAssertEqualObjects(issue.originalElementReference.accessibilityIdentifier, @"A");
+  XCTAssertEqual(issue.originalElementIndex, 0);
+}
+
+#pragma mark - Private
+
+/**
+ * Constructs a scan result containing a single element failing a single check.
+ *
+ * @param identifier The accessibility identifier of the element.
+ * @param frame The accessibility frame of the element.
+ * @return A scan result containing a single element failing
+ *  @c kGSCXTestAccessibilityLabelCheckName.
+ */
+- (GTXHierarchyResultCollection *)gscx_resultWithIdentifier:(NSString *)identifier
+                                                      frame:(CGRect)frame {
+  GTXElementReference *elementReference =
+      [[GTXElementReference alloc] initWithElementAddress:0
+                                             elementClass:[UIView class]
+                                       accessibilityLabel:@"Label"
+                                  accessibilityIdentifier:identifier
+                                       accessibilityFrame:frame
+                                       elementDescription:@"Description"];
+  GTXCheckResult *checkResult =
+      [[GTXCheckResult alloc] initWithCheckName:kGSCXTestAccessibilityLabelCheckName
+                               errorDescription:kGSCXTestAccessibilityLabelCheckDescription];
+  GTXElementResultCollection *elementResult =
+      [[GTXElementResultCollection alloc] initWithElement:elementReference
+                                             checkResults:@[ checkResult ]];
+  return [[GTXHierarchyResultCollection alloc] initWithElementResults:@[ elementResult ]
+                                                           screenshot:self.dummyImage];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,174 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXMappedSession.h"
+
+#import <XCTest/XCTest.h>
+
+#import "GSCXSessionJournal.h"
+#import "GTXHierarchyResultCollection+GSCXCompleteness.h"
+#import "GTXHierarchyResultCollection+GSCXScreenshot.h"
+#import "NSArray+GSCXResults.h"
+#import "third_party/objective_c/GSCXScanner/Tests/Common/GSCXSessionJournalTestUtils.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * The number of results in the session used to measure opening performance.
+ */
+static const NSUInteger kGSCXMappedSessionTestsLargeSessionResultCount = 5000;
+
+@interface GSCXMappedSessionTests : XCTestCase
+
+/**
+ * A temporary directory sessions are created in. Removed after each test.
+ */
+@property(strong, nonatomic) NSURL *directory;
+
+/**
+ * An image passed to @c GTXHierarchyResultCollection initializers.
+ */
+@property(strong, nonatomic) UIImage *screenshot;
+
+@end
+
+@implementation GSCXMappedSessionTests
+
+- (void)setUp {
+  [super setUp];
+  NSString *directoryPath =
+      [NSTemporaryDirectory() stringByAppendingPathComponent:[NSUUID UUID].UUIDString];
+  self.directory = [NSURL fileURLWithPath:directoryPath isDirectory:YES];
+  UIGraphicsBeginImageContextWithOptions(CGSizeMake(4.0, 8.0), YES, 2.0);
+  self.screenshot = UIGraphicsGetImageFromCurrentImageContext();
+  UIGraphicsEndImageContext();
+}
+
+- (void)tearDown {
+  [[NSFileManager defaultManager] removeItemAtURL:self.directory error:nil];
+  [super tearDown];
+}
+
+- (void)testMappedResultsMatchJournaledResults {
+  GSCXSessionJournal *journal = [GSCXSessionJournal journalInDirectory:self.directory error:nil];
+  GTXHierarchyResultCollection *first =
+      [GSCXSessionJournalTestUtils resultWithLabel:@"First"
+                                        screenshot:self.screenshot];
+  first.gscx_screenshotFrame = CGRectMake(1, 2, 4, 8);
+  first.gscx_incomplete = YES;
+  first.gscx_throttledCheckNames = @[ kGSCXSessionJournalTestUtilsCheckName ];
+  [journal appendResult:first];
+  [journal appendResult:[GSCXSessionJournalTestUtils resultWithLabel:nil
+                                                          screenshot:self.screenshot]];
+  GTXHierarchyResultCollection *replacement =
+      [GSCXSessionJournalTestUtils resultWithLabel:@"Replaced"
+                                        screenshot:self.screenshot];
+  [journal replaceResultAtIndex:1 withResult:replacement];
+  [GSCXSessionJournalTestUtils synchronizeJournal:journal inTestCase:self];
+
+  NSError *error;
+  GSCXMappedSession *session = [GSCXMappedSession sessionAtURL:journal.sessionURL error:&error];
+  XCTAssertNil(error);
+  XCTAssertEqual(session.resultCount, 2);
+  XCTAssertEqual(session.checkResultCount, 2);
+  XCTAssertEqual([session checkResultCountAtIndex:1], 1);
+  NSArray<GTXHierarchyResultCollection *> *results = [session results];
+  XCTAssertEqual(results.count, 2);
+  GTXElementReference *elementReference = results[0].elementResults[0].elementReference;
+  XCTAssertEqualObjects(elementReference.accessibilityLabel, @"First");
+  XCTAssertEqualObjects(elementReference.accessibilityIdentifier, @"Identifier");
+  XCTAssertEqualObjects(elementReference.elementDescription, @"Description");
+  XCTAssertEqual(elementReference.elementClass, [UILabel class]);
+  XCTAssert(CGRectEqualToRect(elementReference.accessibilityFrame, CGRectMake(1, 2, 3, 4)));
+  XCTAssertEqualObjects(results[0].elementResults[0].checkResults[0].checkName,
+                        kGSCXSessionJournalTestUtilsCheckName);
+  XCTAssertEqualObjects(results[0].elementResults[0].checkResults[0].errorDescription,
+                        kGSCXSessionJournalTestUtilsCheckDescription);
+  XCTAssertEqualObjects(results[1].elementResults[0].elementReference.accessibilityLabel,
+                        @"Replaced");
+  XCTAssert(CGRectEqualToRect(results[0].gscx_screenshotFrame, CGRectMake(1, 2, 4, 8)));
+  XCTAssertTrue(results[0].gscx_isIncomplete);
+  XCTAssertEqualObjects(results[0].gscx_throttledCheckNames,
+                        @[ kGSCXSessionJournalTestUtilsCheckName ]);
+  XCTAssertFalse(results[1].gscx_isIncomplete);
+  XCTAssertEqualObjects(results[1].gscx_throttledCheckNames, @[]);
+  XCTAssert(CGSizeEqualToSize(results[0].screenshot.size, self.screenshot.size));
+  XCTAssertEqual(results[0].screenshot, results[1].screenshot);
+  XCTAssertEqual([session resultAtIndex:0], results[0]);
+}
+
+- (void)testResultsArePagedWithoutDecodingScreenshots {
+  GSCXSessionJournal *journal = [GSCXSessionJournal journalInDirectory:self.directory error:nil];
+  GTXHierarchyResultCollection *first =
+      [GSCXSessionJournalTestUtils resultWithLabel:@"First"
+                                        screenshot:self.screenshot];
+  first.gscx_screenshotFrame = CGRectMake(1, 2, 4, 8);
+  [journal appendResult:first];
+  [GSCXSessionJournalTestUtils synchronizeJournal:journal inTestCase:self];
+
+  GSCXMappedSession *session = [GSCXMappedSession sessionAtURL:journal.sessionURL error:nil];
+  NSArray<GTXHierarchyResultCollection *> *results = [session results];
+  XCTAssertEqual([results copy], results);
+  XCTAssert(CGSizeEqualToSize([results gscx_screenshotSizeOfResultAtIndex:0], CGSizeMake(4, 8)));
+  NSArray<GTXElementResultCollection *> *elementResults =
+      [results gscx_elementResultsOfResultAtIndex:0];
+  XCTAssertEqual(elementResults.count, 1);
+  XCTAssertEqualObjects(elementResults[0].elementReference.accessibilityLabel, @"First");
+}
+
+- (void)testStaleIndexIsRebuilt {
+  GSCXSessionJournal *journal = [GSCXSessionJournal journalInDirectory:self.directory error:nil];
+  [journal appendResult:[GSCXSessionJournalTestUtils resultWithLabel:@"First"
+                                                          screenshot:self.screenshot]];
+  [GSCXSessionJournalTestUtils synchronizeJournal:journal inTestCase:self];
+  XCTAssertEqual([GSCXMappedSession sessionAtURL:journal.sessionURL error:nil].resultCount, 1);
+
+  [journal appendResult:[GSCXSessionJournalTestUtils resultWithLabel:@"Second"
+                                                          screenshot:self.screenshot]];
+  [GSCXSessionJournalTestUtils synchronizeJournal:journal inTestCase:self];
+  GSCXMappedSession *session = [GSCXMappedSession sessionAtURL:journal.sessionURL error:nil];
+  XCTAssertEqual(session.resultCount, 2);
+  XCTAssertEqualObjects(
+      [session resultAtIndex:1].elementResults[0].elementReference.accessibilityLabel, @"Second");
+}
+
+- (void)testInvalidSessionIsRejected {
+  NSError *error;
+  XCTAssertNil([GSCXMappedSession
+      sessionAtURL:[self.directory URLByAppendingPathComponent:@"missing.gscxsession"]
+             error:&error]);
+  XCTAssertNotNil(error);
+}
+
+- (void)testOpeningLargeSessionPerformance {
+  GSCXSessionJournal *journal = [GSCXSessionJournal journalInDirectory:self.directory error:nil];
+  for (NSUInteger i = 0; i < kGSCXMappedSessionTestsLargeSessionResultCount; i++) {
+    NSString *label = [NSString stringWithFormat:@"Label %lu", (unsigned long)(i % 100)];
+    [journal appendResult:[GSCXSessionJournalTestUtils resultWithLabel:label
+                                                            screenshot:self.screenshot]];
+  }
+  [GSCXSessionJournalTestUtils synchronizeJournal:journal inTestCase:self];
+  XCTAssert([GSCXMappedSession writeIndexForSessionAtURL:journal.sessionURL error:nil]);
+  [self measureBlock:^{
+    GSCXMappedSession *session = [GSCXMappedSession sessionAtURL:journal.sessionURL error:nil];
+    XCTAssertEqual(session.resultCount, kGSCXMappedSessionTestsLargeSessionResultCount);
+    [session resultAtIndex:kGSCXMappedSessionTestsLargeSessionResultCount - 1];
+  }];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,178 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXReportExporter.h"
+
+#import <XCTest/XCTest.h>
+
+#import "GSCXTestCheckNames.h"
+#import "GTXHierarchyResultCollection+GSCXScreenshot.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * The time, in seconds, to wait for an export to complete.
+ */
+static const NSTimeInterval kGSCXReportExporterTestsTimeout = 5.0;
+
+@interface GSCXReportExporterTests : XCTestCase
+
+/**
+ * A temporary directory exports are written to. Removed after each test.
+ */
+@property(strong, nonatomic) NSURL *directory;
+
+/**
+ * Results exported by each test. Two scans sharing a screenshot, with three check results total.
+ */
+@property(strong, nonatomic) NSArray<GTXHierarchyResultCollection *> *results;
+
+@end
+
+@implementation GSCXReportExporterTests
+
+- (void)setUp {
+  [super setUp];
+  NSString *directoryPath =
+      [NSTemporaryDirectory() stringByAppendingPathComponent:[NSUUID UUID].UUIDString];
+  self.directory = [NSURL fileURLWithPath:directoryPath isDirectory:YES];
+  [[NSFileManager defaultManager] createDirectoryAtURL:self.directory
+                           withIntermediateDirectories:YES
+                                            attributes:nil
+                                                 error:nil];
+  UIGraphicsBeginImageContextWithOptions(CGSizeMake(40.0, 80.0), YES, 2.0);
+  UIImage *screenshot = UIGraphicsGetImageFromCurrentImageContext();
+  UIGraphicsEndImageContext();
+  GTXCheckResult *labelCheckResult =
+      [[GTXCheckResult alloc] initWithCheckName:kGSCXTestAccessibilityLabelCheckName
+                               errorDescription:kGSCXTestAccessibilityLabelCheckDescription];
+  GTXCheckResult *contrastCheckResult =
+      [[GTXCheckResult alloc] initWithCheckName:kGSCXTestContrastRatioCheckName
+                               errorDescription:kGSCXTestContrastRatioCheckDescription];
+  GTXHierarchyResultCollection *first = [[GTXHierarchyResultCollection alloc]
+      initWithElementResults:@[ [self gscx_elementResultWithCheckResults:@[
+        labelCheckResult, contrastCheckResult
+      ]] ]
+                  screenshot:screenshot];
+  first.gscx_screenshotFrame = CGRectMake(0, 10, 40, 80);
+  GTXHierarchyResultCollection *second = [[GTXHierarchyResultCollection alloc]
+      initWithElementResults:@[ [self gscx_elementResultWithCheckResults:@[ labelCheckResult ]] ]
+                  screenshot:screenshot];
+  self.results = @[ first, second ];
+}
+
+- (void)tearDown {
+  [[NSFileManager defaultManager] removeItemAtURL:self.directory error:nil];
+  [super tearDown];
+}
+
+- (void)testJSONLinesExportContainsOneRecordPerCheckResult {
+  NSData *data = [self gscx_exportWithFormat:GSCXReportExportFormatJSONLines];
+  NSString *string = [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding];
+  NSArray<NSString *> *lines =
+      [[string stringByTrimmingCharactersInSet:[NSCharacterSet newlineCharacterSet]]
+          componentsSeparatedByString:@"\n"];
+  XCTAssertEqual(lines.count, 3);
+  NSMutableArray<NSDictionary<NSString *, id> *> *records = [[NSMutableArray alloc] init];
+  for (NSString *line in lines) {
+    [records addObject:[NSJSONSerialization
+                           JSONObjectWithData:[line dataUsingEncoding:NSUTF8StringEncoding]
+                                      options:0
+                                        error:nil]];
+  }
+  XCTAssertEqualObjects(records[0][kGSCXReportExporterScanIndexKey], @0);
+  XCTAssertEqualObjects(records[0][kGSCXReportExporterCheckNameKey],
+                        kGSCXTestAccessibilityLabelCheckName);
+  XCTAssertEqualObjects(records[1][kGSCXReportExporterCheckNameKey],
+                        kGSCXTestContrastRatioCheckName);
+  XCTAssertEqualObjects(records[0][kGSCXReportExporterElementDescriptionKey], @"Description");
+  XCTAssertEqualObjects(records[0][kGSCXReportExporterFrameKey][@"width"], @30);
+  XCTAssertEqualObjects(records[2][kGSCXReportExporterScanIndexKey], @1);
+  NSString *screenshotFileName = records[0][kGSCXReportExporterScreenshotKey];
+  XCTAssertEqualObjects(records[2][kGSCXReportExporterScreenshotKey], screenshotFileName);
+  XCTAssertTrue([[NSFileManager defaultManager]
+      fileExistsAtPath:[self.directory URLByAppendingPathComponent:screenshotFileName].path]);
+}
+
+- (void)testSARIFExportIsValidLog {
+  NSData *data = [self gscx_exportWithFormat:GSCXReportExportFormatSARIF];
+  NSDictionary<NSString *, id> *log = [NSJSONSerialization JSONObjectWithData:data
+                                                                       options:0
+                                                                         error:nil];
+  XCTAssertEqualObjects(log[@"version"], @"2.1.0");
+  NSDictionary<NSString *, id> *run = log[@"runs"][0];
+  XCTAssertEqualObjects(run[@"tool"][@"driver"][@"name"], @"GSCXScanner");
+  NSArray<NSDictionary<NSString *, id> *> *results = run[@"results"];
+  XCTAssertEqual(results.count, 3);
+  XCTAssertEqualObjects(results[1][@"ruleId"], kGSCXTestContrastRatioCheckName);
+  XCTAssertEqualObjects(results[1][@"message"][@"text"], kGSCXTestContrastRatioCheckDescription);
+  NSDictionary<NSString *, id> *rectangle = results[0][@"attachments"][0][@"rectangles"][0];
+  // The element's frame is relative to the screenshot, which starts 10 points down the screen, and
+  // is in the screenshot's pixels.
+  XCTAssertEqualObjects(rectangle[@"top"], @20);
+  XCTAssertEqualObjects(rectangle[@"bottom"], @100);
+}
+
+#pragma mark - Private
+
+/**
+ * Exports @c results to a file in @c directory and waits for the export to complete.
+ *
+ * @param format The format to export.
+ * @return The contents of the exported file.
+ */
+- (NSData *)gscx_exportWithFormat:(GSCXReportExportFormat)format {
+  GSCXReportExporter *exporter = [[GSCXReportExporter alloc] initWithFormat:format];
+  NSURL *fileURL = [[self.directory URLByAppendingPathComponent:@"report"]
+      URLByAppendingPathExtension:[exporter fileExtension]];
+  [[NSData data] writeToURL:fileURL atomically:YES];
+  NSFileHandle *fileHandle = [NSFileHandle fileHandleForWritingToURL:fileURL error:nil];
+  XCTestExpectation *expectation = [self expectationWithDescription:@"Export completed."];
+  [exporter exportResults:self.results
+                toFileHandle:fileHandle
+      screenshotDirectoryURL:self.directory
+                  completion:^(NSError *_Nullable error) {
+                    XCTAssertTrue([NSThread isMainThread]);
+                    XCTAssertNil(error);
+                    [expectation fulfill];
+                  }];
+  [self waitForExpectations:@[ expectation ] timeout:kGSCXReportExporterTestsTimeout];
+  [fileHandle closeFile];
+  return [NSData dataWithContentsOfURL:fileURL];
+}
+
+/**
+ * Constructs an element result with @c checkResults.
+ *
+ * @param checkResults The check results of the element.
+ * @return An element result at (5, 20, 30, 40) failing @c checkResults.
+ */
+- (GTXElementResultCollection *)gscx_elementResultWithCheckResults:
+    (NSArray<GTXCheckResult *> *)checkResults {
+  GTXElementReference *elementReference =
+      [[GTXElementReference alloc] initWithElementAddress:1
+                                             elementClass:[UILabel class]
+                                       accessibilityLabel:@"Label"
+                                  accessibilityIdentifier:@"Identifier"
+                                       accessibilityFrame:CGRectMake(5, 20, 30, 40)
+                                       elementDescription:@"Description"];
+  return [[GTXElementResultCollection alloc] initWithElement:elementReference
+                                                checkResults:checkResults];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
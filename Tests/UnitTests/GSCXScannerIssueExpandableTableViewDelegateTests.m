@@ -120,6 +120,25 @@ NS_ASSUME_NONNULL_BEGIN
   [self gscx_assertDelegateCalculatesCorrectCountsForSections:sections];
 }
 
+- (void)testCellReusesLabelsAcrossConfigurations {
+  GSCXScannerIssueExpandableTableViewCell *cell = [[GSCXScannerIssueExpandableTableViewCell alloc]
+        initWithStyle:UITableViewCellStyleDefault
+      reuseIdentifier:kGSCXScannerIssueExpandableTableViewCellReuseIdentifier];
+  [cell setLabelTexts:@[ @"Title", @"Subtitle", @"Suggestion" ]];
+  NSArray<UIView *> *labels = [cell.suggestionStack.arrangedSubviews copy];
+  XCTAssertEqual(labels.count, 3);
+  [cell setLabelTexts:@[ @"Other Title" ]];
+  XCTAssertEqualObjects(cell.suggestionStack.arrangedSubviews, labels);
+  XCTAssertEqualObjects(((UILabel *)labels[0]).text, @"Other Title");
+  XCTAssertFalse(labels[0].hidden);
+  XCTAssertTrue(labels[1].hidden);
+  XCTAssertTrue(labels[2].hidden);
+  [cell setLabelTextColor:[UIColor redColor]];
+  for (UIView *label in labels) {
+    XCTAssertEqualObjects(((UILabel *)label).textColor, [UIColor redColor]);
+  }
+}
+
 #pragma mark - Private
 
 /**
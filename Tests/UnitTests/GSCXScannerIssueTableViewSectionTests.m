@@ -136,6 +136,29 @@ static NSString *const kGSCXScannerIssueTableViewSectionTitle = @"Scan 1";
   XCTAssertEqual([section numberOfSuggestions], 6);
 }
 
+- (void)testLazySectionCreatesRowsOnlyWhenRequested {
+  __block NSUInteger providerCallCount = 0;
+  GSCXScannerIssueTableViewSection *section = [[GSCXScannerIssueTableViewSection alloc]
+            initWithTitle:kGSCXScannerIssueTableViewSectionTitle
+                 subtitle:nil
+             numberOfRows:3
+      numberOfSuggestions:3
+              rowProvider:^GSCXScannerIssueTableViewRow *(NSUInteger rowIndex) {
+                providerCallCount++;
+                return [GSCXScannerTestsUtils newRow];
+              }];
+  XCTAssertEqual([section numberOfRows], 3);
+  XCTAssertEqual([section numberOfSuggestions], 3);
+  XCTAssertEqual(providerCallCount, 0);
+  GSCXScannerIssueTableViewRow *row = [section rowAtIndex:1];
+  XCTAssertEqual(providerCallCount, 1);
+  XCTAssertEqual([section rowAtIndex:1], row);
+  XCTAssertEqual(providerCallCount, 1);
+  XCTAssertEqual(section.rows.count, 3);
+  XCTAssertEqual(section.rows[1], row);
+  XCTAssertEqual(providerCallCount, 3);
+}
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -17,8 +17,12 @@
 #import <UIKit/UIKit.h>
 #import <XCTest/XCTest.h>
 
+#import "GSCXAnalytics.h"
+#import "GSCXAttributeCache.h"
 #import "GSCXScanner.h"
+#import "GSCXSnapshotCheck.h"
 #import "GSCXTestCheck.h"
+#import "GTXHierarchyResultCollection+GSCXScreenshot.h"
 #import <GTXiLib/GTXiLib.h>
 NS_ASSUME_NONNULL_BEGIN
 
@@ -55,6 +59,13 @@ static const CGRect kGSCXScannerTestsWindowFrame = {{0, 0}, {44, 44}};
 @property(assign, nonatomic) void (^scannerDidFinishScanWithResult)
     (GSCXScanner *, GTXHierarchyResultCollection *);
 
+/**
+ * Provides the implementation for the scanner:didInterruptScanWithReason:slowestCheckName: method.
+ * Does nothing if @c nil.
+ */
+@property(copy, nonatomic, nullable) void (^scannerDidInterruptScanBlock)
+    (GSCXScanner *, GSCXScanInterruptionReason, NSString *_Nullable);
+
 /**
  * Returns a UIView whose @c isAccessible property is YES and whose tag is
  * @c kGSCXScannerDummyCheckTag, so it fails @c dummyCheck.
@@ -280,6 +291,547 @@ static const CGRect kGSCXScannerTestsWindowFrame = {{0, 0}, {44, 44}};
   [self gscxtest_assertIssueCountOnViewWithIssue:1 withScanner:scanner];
 }
 
+- (void)testBatchUpdatesApplyAllChanges {
+  GSCXScanner *scanner = [GSCXScanner scanner];
+  id<GTXChecking> duplicateCheck = [GSCXTestCheck duplicateTestCheck];
+  id<GTXExcludeListing> excludeList = [GTXExcludeListBlock
+      excludeListWithBlock:^BOOL(id _Nonnull element, NSString *_Nonnull checkName) {
+        return YES;
+      }];
+  [scanner performBatchUpdates:^{
+    [scanner registerCheck:self.dummyCheck];
+    [scanner registerCheck:duplicateCheck];
+    [scanner registerExcludeList:excludeList];
+    [scanner deregisterExcludeList:excludeList];
+  }];
+  UIView *rootView = [[UIView alloc] initWithFrame:kGSCXScannerTestsRootViewFrame];
+  [rootView addSubview:[GSCXScannerTests gscxtest_checkFailingAccessibleView]];
+  UIWindow *window = [[UIWindow alloc] initWithFrame:kGSCXScannerTestsWindowFrame];
+  [window addSubview:rootView];
+
+  GTXHierarchyResultCollection *result = [scanner scanRootViews:@[ rootView ]];
+
+  XCTAssertEqual(result.elementResults.count, 1ul);
+  XCTAssertEqual(result.elementResults[0].checkResults.count, 2ul);
+}
+
+- (void)testReturningToPreviousConfigurationReusesToolkit {
+  GSCXScanner *scanner = [GSCXScanner scanner];
+  id<GTXChecking> duplicateCheck = [GSCXTestCheck duplicateTestCheck];
+  [scanner registerCheck:self.dummyCheck];
+  id toolkit = [scanner valueForKey:@"toolkit"];
+
+  [scanner registerCheck:duplicateCheck];
+  id toolkitWithDuplicateCheck = [scanner valueForKey:@"toolkit"];
+  [scanner deregisterCheck:duplicateCheck];
+  id toolkitWithoutDuplicateCheck = [scanner valueForKey:@"toolkit"];
+  [scanner registerCheck:duplicateCheck];
+
+  XCTAssertNotEqual(toolkitWithoutDuplicateCheck, toolkitWithDuplicateCheck);
+  XCTAssertEqual([scanner valueForKey:@"toolkit"], toolkitWithDuplicateCheck);
+  XCTAssertEqual(toolkit, toolkitWithDuplicateCheck);
+  [scanner deregisterCheck:duplicateCheck];
+  XCTAssertEqual([scanner valueForKey:@"toolkit"], toolkitWithoutDuplicateCheck);
+  [self gscxtest_assertIssueCountOnViewWithIssue:1 withScanner:scanner];
+}
+
+- (void)testExclusionSkipsSubtree {
+  GSCXScanner *scanner = [GSCXScanner scanner];
+  [scanner registerCheck:self.dummyCheck];
+  UIView *rootView = [[UIView alloc] initWithFrame:kGSCXScannerTestsRootViewFrame];
+  UIView *containerView = [[UIView alloc] initWithFrame:kGSCXScannerTestsRootViewFrame];
+  [containerView addSubview:[GSCXScannerTests gscxtest_checkFailingAccessibleView]];
+  [rootView addSubview:containerView];
+  UIView *includedViewWithIssue = [GSCXScannerTests gscxtest_checkFailingAccessibleView];
+  includedViewWithIssue.frame = kGSCXScannerTestsFailingElementFrame2;
+  [rootView addSubview:includedViewWithIssue];
+  UIWindow *window = [[UIWindow alloc] initWithFrame:kGSCXScannerTestsWindowFrame];
+  [window addSubview:rootView];
+  GSCXExclusion *exclusion = [GSCXExclusion exclusionWithSubtreeRootedAtView:containerView];
+  [scanner addExclusion:exclusion];
+
+  GTXHierarchyResultCollection *excludedResult = [scanner scanRootViews:@[ rootView ]];
+  [scanner removeExclusion:exclusion];
+  GTXHierarchyResultCollection *result = [scanner scanRootViews:@[ rootView ]];
+
+  XCTAssertEqual(excludedResult.elementResults.count, 1ul);
+  XCTAssertEqual(result.elementResults.count, 2ul);
+  XCTAssertEqual(scanner.exclusions.count, 0ul);
+}
+
+- (void)testExclusionSkipsAccessibilityIdentifier {
+  GSCXScanner *scanner = [GSCXScanner scanner];
+  [scanner registerCheck:self.dummyCheck];
+  UIView *rootView = [[UIView alloc] initWithFrame:kGSCXScannerTestsRootViewFrame];
+  UIView *viewWithIssue = [GSCXScannerTests gscxtest_checkFailingAccessibleView];
+  viewWithIssue.accessibilityIdentifier = @"excluded";
+  [rootView addSubview:viewWithIssue];
+  UIWindow *window = [[UIWindow alloc] initWithFrame:kGSCXScannerTestsWindowFrame];
+  [window addSubview:rootView];
+  [scanner addExclusion:[GSCXExclusion exclusionWithAccessibilityIdentifier:@"excluded"]];
+
+  GTXHierarchyResultCollection *result = [scanner scanRootViews:@[ rootView ]];
+
+  XCTAssertEqual(result.elementResults.count, 0ul);
+}
+
+- (void)testGuardedScanDoesNotCheckExcludedElements {
+  GSCXScanner *scanner = [GSCXScanner scanner];
+  [scanner registerCheck:self.dummyCheck];
+  scanner.watchdogTimeout = 60.0;
+  UIView *rootView = [[UIView alloc] initWithFrame:kGSCXScannerTestsRootViewFrame];
+  UIView *containerView = [[UIView alloc] initWithFrame:kGSCXScannerTestsRootViewFrame];
+  [containerView addSubview:[GSCXScannerTests gscxtest_checkFailingAccessibleView]];
+  [rootView addSubview:containerView];
+  UIWindow *window = [[UIWindow alloc] initWithFrame:kGSCXScannerTestsWindowFrame];
+  [window addSubview:rootView];
+  GTXHierarchyResultCollection *result = [scanner scanRootViews:@[ rootView ]];
+  NSUInteger elementCount = scanner.checkCostModel.lastScanElementCount;
+
+  [scanner addExclusion:[GSCXExclusion exclusionWithSubtreeRootedAtView:containerView]];
+  GTXHierarchyResultCollection *excludedResult = [scanner scanRootViews:@[ rootView ]];
+
+  XCTAssertEqual(result.elementResults.count, 1ul);
+  XCTAssertEqual(excludedResult.elementResults.count, 0ul);
+  XCTAssertLessThan(scanner.checkCostModel.lastScanElementCount, elementCount);
+}
+
+- (void)testCapturePolicySkipsScreenshotWithoutIssues {
+  GSCXScanner *scanner = [GSCXScanner scanner];
+  [scanner registerCheck:self.dummyCheck];
+  GSCXScreenshotCapturePolicy *policy = [GSCXScreenshotCapturePolicy defaultPolicy];
+  policy.skipsCaptureWithoutIssues = YES;
+  scanner.screenshotCapturePolicy = policy;
+
+  UIView *rootView = [[UIView alloc] initWithFrame:kGSCXScannerTestsRootViewFrame];
+  UIWindow *window = [[UIWindow alloc] initWithFrame:kGSCXScannerTestsWindowFrame];
+  [window addSubview:rootView];
+  GTXHierarchyResultCollection *result = [scanner scanRootViews:@[ rootView ]];
+
+  CGRect screenBounds = window.screen.bounds;
+  XCTAssertEqual(result.elementResults.count, 0ul);
+  XCTAssertLessThan(result.screenshot.scale, 1.0);
+  XCTAssertEqualWithAccuracy(result.screenshot.size.width / result.screenshot.size.height,
+                             screenBounds.size.width / screenBounds.size.height, 0.1);
+  XCTAssert(CGRectEqualToRect(result.gscx_screenshotFrame, screenBounds));
+}
+
+- (void)testCapturePolicyCropsScreenshotToIssuesAtReducedScale {
+  GSCXScanner *scanner = [GSCXScanner scanner];
+  [scanner registerCheck:self.dummyCheck];
+  GSCXScreenshotCapturePolicy *policy = [GSCXScreenshotCapturePolicy defaultPolicy];
+  policy.scale = 1.0;
+  policy.cropsToIssues = YES;
+  policy.cropMargin = 4.0;
+  scanner.screenshotCapturePolicy = policy;
+
+  UIView *rootView = [[UIView alloc] initWithFrame:kGSCXScannerTestsRootViewFrame];
+  UIView *viewWithIssue = [GSCXScannerTests gscxtest_checkFailingAccessibleView];
+  [rootView addSubview:viewWithIssue];
+  UIWindow *window = [[UIWindow alloc] initWithFrame:kGSCXScannerTestsWindowFrame];
+  [window addSubview:rootView];
+  GTXHierarchyResultCollection *result = [scanner scanRootViews:@[ rootView ]];
+
+  CGRect elementFrame = result.elementResults[0].elementReference.accessibilityFrame;
+  CGRect expectedFrame =
+      CGRectIntersection(CGRectIntegral(CGRectInset(elementFrame, -4.0, -4.0)),
+                         window.screen.bounds);
+  XCTAssertEqual(result.elementResults.count, 1ul);
+  XCTAssert(CGRectEqualToRect(result.gscx_screenshotFrame, expectedFrame));
+  XCTAssert(CGSizeEqualToSize(result.screenshot.size, expectedFrame.size));
+  XCTAssertEqual(result.screenshot.scale, 1.0);
+}
+
+- (void)testBaselineSuppressesKnownIssues {
+  GSCXScanner *scanner = [GSCXScanner scanner];
+  [scanner registerCheck:self.dummyCheck];
+  UIView *rootView = [[UIView alloc] initWithFrame:kGSCXScannerTestsRootViewFrame];
+  UIView *knownViewWithIssue = [GSCXScannerTests gscxtest_checkFailingAccessibleView];
+  knownViewWithIssue.accessibilityIdentifier = @"known";
+  UIView *newViewWithIssue = [GSCXScannerTests gscxtest_checkFailingAccessibleView];
+  newViewWithIssue.frame = kGSCXScannerTestsFailingElementFrame2;
+  newViewWithIssue.accessibilityIdentifier = @"new";
+  [rootView addSubview:knownViewWithIssue];
+  [rootView addSubview:newViewWithIssue];
+  UIWindow *window = [[UIWindow alloc] initWithFrame:kGSCXScannerTestsWindowFrame];
+  [window addSubview:rootView];
+  GTXHierarchyResultCollection *unfilteredResult = [scanner scanRootViews:@[ rootView ]];
+  GTXElementResultCollection *knownElementResult =
+      [unfilteredResult.elementResults[0].elementReference.accessibilityIdentifier
+          isEqualToString:@"known"]
+          ? unfilteredResult.elementResults[0]
+          : unfilteredResult.elementResults[1];
+  NSString *fingerprint =
+      [GSCXBaseline fingerprintForCheckResult:knownElementResult.checkResults[0]
+                             elementReference:knownElementResult.elementReference];
+  scanner.baseline = [[GSCXBaseline alloc] initWithFingerprints:[NSSet setWithObject:fingerprint]];
+  BOOL wasAnalyticsEnabled = GSCXAnalytics.enabled;
+  GSCXAnalyticsHandlerBlock previousHandler = GSCXAnalytics.handler;
+  __block NSInteger reportedErrorCount = 0;
+  GSCXAnalytics.enabled = YES;
+  GSCXAnalytics.handler = ^(GSCXAnalyticsEvent event, NSInteger count) {
+    if (event == GSCXAnalyticsEventErrorsFound) {
+      reportedErrorCount += count;
+    }
+  };
+
+  GTXHierarchyResultCollection *result = [scanner scanRootViews:@[ rootView ]];
+
+  GSCXAnalytics.handler = previousHandler;
+  GSCXAnalytics.enabled = wasAnalyticsEnabled;
+  // Only the issue that is not in the baseline is reported.
+  XCTAssertEqual(reportedErrorCount, 1);
+  XCTAssertEqual(unfilteredResult.elementResults.count, 2ul);
+  XCTAssertEqual(result.elementResults.count, 1ul);
+  XCTAssertEqualObjects(result.elementResults[0].elementReference.accessibilityIdentifier, @"new");
+  XCTAssertNotNil(result.screenshot);
+}
+
+- (void)testActiveProfileReplacesRegisteredChecks {
+  GSCXScanner *scanner = [GSCXScanner scanner];
+  [scanner registerCheck:self.dummyCheck];
+  id<GTXChecking> duplicateCheck = [GSCXTestCheck duplicateTestCheck];
+  [scanner addProfile:[GSCXCheckProfile profileWithName:@"Empty" checks:@[] excludeLists:@[]]];
+  [scanner addProfile:[GSCXCheckProfile profileWithName:@"Full"
+                                                 checks:@[ self.dummyCheck, duplicateCheck ]
+                                           excludeLists:@[]]];
+  UIView *rootView = [[UIView alloc] initWithFrame:kGSCXScannerTestsRootViewFrame];
+  [rootView addSubview:[GSCXScannerTests gscxtest_checkFailingAccessibleView]];
+  UIWindow *window = [[UIWindow alloc] initWithFrame:kGSCXScannerTestsWindowFrame];
+  [window addSubview:rootView];
+
+  scanner.activeProfileName = @"Empty";
+  GTXHierarchyResultCollection *emptyResult = [scanner scanRootViews:@[ rootView ]];
+  scanner.activeProfileName = @"Full";
+  GTXHierarchyResultCollection *fullResult = [scanner scanRootViews:@[ rootView ]];
+  scanner.activeProfileName = nil;
+  GTXHierarchyResultCollection *registeredResult = [scanner scanRootViews:@[ rootView ]];
+
+  XCTAssertEqual(emptyResult.elementResults.count, 0ul);
+  XCTAssertEqual(fullResult.elementResults[0].checkResults.count, 2ul);
+  XCTAssertEqual(registeredResult.elementResults[0].checkResults.count, 1ul);
+}
+
+- (void)testRemovingActiveProfileRestoresRegisteredChecks {
+  GSCXScanner *scanner = [GSCXScanner scanner];
+  [scanner registerCheck:self.dummyCheck];
+  [scanner addProfile:[GSCXCheckProfile profileWithName:@"Empty" checks:@[] excludeLists:@[]]];
+  [scanner addProfile:[GSCXCheckProfile profileWithName:@"Empty" checks:@[] excludeLists:@[]]];
+  scanner.activeProfileName = @"Empty";
+
+  [scanner removeProfileNamed:@"Empty"];
+
+  XCTAssertEqual(scanner.profiles.count, 0ul);
+  XCTAssertNil(scanner.activeProfileName);
+  [self gscxtest_assertIssueCountOnViewWithIssue:1 withScanner:scanner];
+}
+
+- (void)testSlicedScanMatchesSynchronousScan {
+  GSCXScanner *scanner = [GSCXScanner scanner];
+  [scanner registerCheck:self.dummyCheck];
+  UIView *rootView = [[UIView alloc] initWithFrame:kGSCXScannerTestsRootViewFrame];
+  UIView *viewWithIssue1 = [GSCXScannerTests gscxtest_checkFailingAccessibleView];
+  UIView *viewWithIssue2 = [GSCXScannerTests gscxtest_checkFailingAccessibleView];
+  viewWithIssue2.frame = kGSCXScannerTestsFailingElementFrame2;
+  [rootView addSubview:viewWithIssue1];
+  [rootView addSubview:viewWithIssue2];
+  UIWindow *window = [[UIWindow alloc] initWithFrame:kGSCXScannerTestsWindowFrame];
+  [window addSubview:rootView];
+  GTXHierarchyResultCollection *synchronousResult = [scanner scanRootViews:@[ rootView ]];
+  __block GTXHierarchyResultCollection *slicedResult;
+
+  // A budget of 0 checks one element per slice.
+  GSCXSlicedScan *slicedScan =
+      [scanner beginSlicedScanOfRootViews:@[ rootView ]
+                               timeBudget:0.0
+                               completion:^(GTXHierarchyResultCollection *_Nullable result) {
+                                 slicedResult = result;
+                               }];
+  while ([slicedScan performSlice]) {
+    XCTAssertNil(slicedResult);
+  }
+
+  XCTAssertTrue(slicedScan.isFinished);
+  XCTAssertGreaterThan(slicedScan.sliceCount, 1ul);
+  XCTAssertEqual(slicedResult.elementResults.count, synchronousResult.elementResults.count);
+  XCTAssertEqual(scanner.lastScanResult, slicedResult);
+}
+
+- (void)testSlicedScanIsInvalidatedWhenHierarchyChanges {
+  GSCXScanner *scanner = [GSCXScanner scanner];
+  [scanner registerCheck:self.dummyCheck];
+  UIView *rootView = [[UIView alloc] initWithFrame:kGSCXScannerTestsRootViewFrame];
+  [rootView addSubview:[GSCXScannerTests gscxtest_checkFailingAccessibleView]];
+  UIWindow *window = [[UIWindow alloc] initWithFrame:kGSCXScannerTestsWindowFrame];
+  [window addSubview:rootView];
+  __block BOOL completed = NO;
+  __block GTXHierarchyResultCollection *slicedResult;
+  GSCXSlicedScan *slicedScan =
+      [scanner beginSlicedScanOfRootViews:@[ rootView ]
+                               timeBudget:0.0
+                               completion:^(GTXHierarchyResultCollection *_Nullable result) {
+                                 completed = YES;
+                                 slicedResult = result;
+                               }];
+
+  XCTAssertTrue([slicedScan performSlice]);
+  [rootView removeFromSuperview];
+  XCTAssertFalse([slicedScan performSlice]);
+
+  XCTAssertTrue(completed);
+  XCTAssertNil(slicedResult);
+  XCTAssertTrue(slicedScan.isInvalidated);
+  XCTAssertNil(scanner.lastScanResult);
+}
+
+- (void)testCancelledScanReturnsIncompleteResult {
+  GSCXScanner *scanner = [GSCXScanner scanner];
+  [scanner registerCheck:self.dummyCheck];
+  scanner.delegate = self;
+  NSMutableArray<NSString *> *events = [[NSMutableArray alloc] init];
+  self.scannerWillBeginScanBlock = ^(GSCXScanner *scanner) {
+  };
+  self.scannerDidInterruptScanBlock =
+      ^(GSCXScanner *scanner, GSCXScanInterruptionReason reason, NSString *_Nullable checkName) {
+        XCTAssertEqual(reason, GSCXScanInterruptionReasonCancelled);
+        [events addObject:@"interrupt"];
+      };
+  self.scannerDidFinishScanWithResult =
+      ^(GSCXScanner *scanner, GTXHierarchyResultCollection *result) {
+        [events addObject:@"finish"];
+      };
+  UIView *rootView = [[UIView alloc] initWithFrame:kGSCXScannerTestsRootViewFrame];
+  [rootView addSubview:[GSCXScannerTests gscxtest_checkFailingAccessibleView]];
+  UIWindow *window = [[UIWindow alloc] initWithFrame:kGSCXScannerTestsWindowFrame];
+  [window addSubview:rootView];
+  GSCXScanCancellationToken *token = [GSCXScanCancellationToken token];
+  [token cancel];
+
+  GTXHierarchyResultCollection *result = [scanner scanRootViews:@[ rootView ]
+                                              cancellationToken:token];
+
+  XCTAssertTrue(result.gscx_isIncomplete);
+  XCTAssertEqual(result.elementResults.count, 0ul);
+  XCTAssertEqualObjects(events, (@[ @"interrupt", @"finish" ]));
+}
+
+- (void)testScanWithinWatchdogTimeoutMatchesUnguardedScan {
+  GSCXScanner *scanner = [GSCXScanner scanner];
+  [scanner registerCheck:self.dummyCheck];
+  [scanner registerCheck:[GSCXTestCheck duplicateTestCheck]];
+  UIView *rootView = [[UIView alloc] initWithFrame:kGSCXScannerTestsRootViewFrame];
+  UIView *viewWithIssue2 = [GSCXScannerTests gscxtest_checkFailingAccessibleView];
+  viewWithIssue2.frame = kGSCXScannerTestsFailingElementFrame2;
+  [rootView addSubview:[GSCXScannerTests gscxtest_checkFailingAccessibleView]];
+  [rootView addSubview:viewWithIssue2];
+  UIWindow *window = [[UIWindow alloc] initWithFrame:kGSCXScannerTestsWindowFrame];
+  [window addSubview:rootView];
+  GTXHierarchyResultCollection *unguardedResult = [scanner scanRootViews:@[ rootView ]];
+
+  scanner.watchdogTimeout = 60.0;
+  GTXHierarchyResultCollection *result = [scanner scanRootViews:@[ rootView ]];
+
+  XCTAssertFalse(result.gscx_isIncomplete);
+  XCTAssertEqual(result.elementResults.count, unguardedResult.elementResults.count);
+  XCTAssertEqual(result.elementResults[0].checkResults.count, 2ul);
+  XCTAssertEqual([result checkResultCount], [unguardedResult checkResultCount]);
+}
+
+- (void)testWatchdogTimeoutReportsSlowestCheck {
+  NSString *slowCheckName = @"Slow";
+  id<GTXChecking> slowCheck =
+      [GTXCheckBlock GTXCheckWithName:slowCheckName
+                                block:^BOOL(id element, GTXErrorRefType errorOrNil) {
+                                  [NSThread sleepForTimeInterval:0.01];
+                                  return YES;
+                                }];
+  GSCXScanner *scanner = [GSCXScanner scannerWithChecks:@[ self.dummyCheck, slowCheck ]
+                                           excludeLists:@[]];
+  scanner.watchdogTimeout = 0.001;
+  scanner.delegate = self;
+  __block NSString *reportedCheckName;
+  self.scannerWillBeginScanBlock = ^(GSCXScanner *scanner) {
+  };
+  self.scannerDidInterruptScanBlock =
+      ^(GSCXScanner *scanner, GSCXScanInterruptionReason reason, NSString *_Nullable checkName) {
+        XCTAssertEqual(reason, GSCXScanInterruptionReasonTimedOut);
+        reportedCheckName = checkName;
+      };
+  self.scannerDidFinishScanWithResult =
+      ^(GSCXScanner *scanner, GTXHierarchyResultCollection *result) {
+      };
+  UIView *rootView = [[UIView alloc] initWithFrame:kGSCXScannerTestsRootViewFrame];
+  UIView *viewWithIssue2 = [GSCXScannerTests gscxtest_checkFailingAccessibleView];
+  viewWithIssue2.frame = kGSCXScannerTestsFailingElementFrame2;
+  [rootView addSubview:[GSCXScannerTests gscxtest_checkFailingAccessibleView]];
+  [rootView addSubview:viewWithIssue2];
+  UIWindow *window = [[UIWindow alloc] initWithFrame:kGSCXScannerTestsWindowFrame];
+  [window addSubview:rootView];
+
+  GTXHierarchyResultCollection *result = [scanner scanRootViews:@[ rootView ]];
+
+  XCTAssertTrue(result.gscx_isIncomplete);
+  XCTAssertLessThan(result.elementResults.count, 2ul);
+  XCTAssertEqualObjects(reportedCheckName, slowCheckName);
+}
+
+- (void)testThrottledCheckIsNotRunAndIsMeasuredOtherwise {
+  GSCXScanner *scanner = [GSCXScanner scanner];
+  [scanner registerCheck:self.dummyCheck];
+  [scanner registerCheck:[GSCXTestCheck duplicateTestCheck]];
+  UIView *rootView = [[UIView alloc] initWithFrame:kGSCXScannerTestsRootViewFrame];
+  [rootView addSubview:[GSCXScannerTests gscxtest_checkFailingAccessibleView]];
+  UIWindow *window = [[UIWindow alloc] initWithFrame:kGSCXScannerTestsWindowFrame];
+  [window addSubview:rootView];
+  GSCXScanOptions *options = [GSCXScanOptions defaultOptions];
+  options.throttledCheckNames = [NSSet setWithObject:[self.dummyCheck name]];
+
+  GTXHierarchyResultCollection *result = [scanner scanRootViews:@[ rootView ] options:options];
+
+  XCTAssertEqual([result checkResultCount], 1ul);
+  XCTAssertEqualObjects(result.gscx_throttledCheckNames, @[ [self.dummyCheck name] ]);
+  XCTAssertFalse([scanner.checkCostModel hasCostForCheckNamed:[self.dummyCheck name]]);
+  XCTAssertTrue([scanner.checkCostModel
+      hasCostForCheckNamed:[[GSCXTestCheck duplicateTestCheck] name]]);
+  XCTAssertGreaterThan(scanner.checkCostModel.lastScanElementCount, 0ul);
+}
+
+- (void)testMaximumFailuresPerElementStopsCheckingElement {
+  GSCXScanner *scanner = [GSCXScanner scanner];
+  [scanner registerCheck:self.dummyCheck];
+  [scanner registerCheck:[GSCXTestCheck duplicateTestCheck]];
+  UIView *rootView = [[UIView alloc] initWithFrame:kGSCXScannerTestsRootViewFrame];
+  [rootView addSubview:[GSCXScannerTests gscxtest_checkFailingAccessibleView]];
+  UIWindow *window = [[UIWindow alloc] initWithFrame:kGSCXScannerTestsWindowFrame];
+  [window addSubview:rootView];
+  GSCXScanOptions *options = [GSCXScanOptions defaultOptions];
+  options.maximumFailuresPerElement = 1;
+
+  GTXHierarchyResultCollection *result = [scanner scanRootViews:@[ rootView ] options:options];
+
+  XCTAssertEqual(result.elementResults.count, 1ul);
+  XCTAssertEqual(result.elementResults[0].checkResults.count, 1ul);
+}
+
+- (void)testCheapestBlockingCheckIsReportedFirst {
+  NSString *slowCheckName = @"Slow";
+  id<GTXChecking> slowCheck =
+      [GTXCheckBlock GTXCheckWithName:slowCheckName
+                                block:^BOOL(id element, GTXErrorRefType errorOrNil) {
+                                  [NSThread sleepForTimeInterval:0.005];
+                                  if ([element tag] != kGSCXTestCheckFailingElementTag) {
+                                    return YES;
+                                  }
+                                  [NSError gtx_logOrSetGTXCheckFailedError:errorOrNil
+                                                                   element:element
+                                                                      name:slowCheckName
+                                                               description:@"Slow check failed."];
+                                  return NO;
+                                }];
+  GSCXScanner *scanner = [GSCXScanner scannerWithChecks:@[ slowCheck, self.dummyCheck ]
+                                           excludeLists:@[]];
+  UIView *rootView = [[UIView alloc] initWithFrame:kGSCXScannerTestsRootViewFrame];
+  [rootView addSubview:[GSCXScannerTests gscxtest_checkFailingAccessibleView]];
+  UIWindow *window = [[UIWindow alloc] initWithFrame:kGSCXScannerTestsWindowFrame];
+  [window addSubview:rootView];
+  GSCXScanOptions *options = [GSCXScanOptions defaultOptions];
+  options.measuresCheckCosts = YES;
+  GTXHierarchyResultCollection *fullResult = [scanner scanRootViews:@[ rootView ]
+                                                            options:options];
+  options.measuresCheckCosts = NO;
+  options.ordersChecksByCost = YES;
+  options.blockingCheckNames = [NSSet setWithObject:[self.dummyCheck name]];
+
+  GTXHierarchyResultCollection *result = [scanner scanRootViews:@[ rootView ] options:options];
+
+  XCTAssertEqual([fullResult checkResultCount], 2ul);
+  XCTAssertEqual([result checkResultCount], 1ul);
+  XCTAssertEqualObjects(result.elementResults[0].checkResults[0].checkName,
+                        [self.dummyCheck name]);
+}
+
+- (void)testParallelSnapshotEvaluationMatchesSerialEvaluation {
+  id<GTXChecking> snapshotCheck =
+      [GSCXSnapshotCheck checkWithName:@"Snapshot"
+                      errorDescription:@"Snapshot check failed."
+                                 block:^BOOL(GSCXElementSnapshot *snapshot) {
+                                   return snapshot.accessibilityIdentifier.length == 0;
+                                 }];
+  GSCXScanner *scanner = [GSCXScanner scannerWithChecks:@[ self.dummyCheck, snapshotCheck ]
+                                           excludeLists:@[]];
+  UIView *rootView = [[UIView alloc] initWithFrame:kGSCXScannerTestsRootViewFrame];
+  for (NSUInteger i = 0; i < 20; i++) {
+    UIView *view = [GSCXScannerTests gscxtest_checkFailingAccessibleView];
+    view.frame = CGRectMake(i, 0, 1, 1);
+    view.tag = (i % 2 == 0) ? kGSCXTestCheckFailingElementTag : 0;
+    if (i % 3 == 0) {
+      view.accessibilityIdentifier = [NSString stringWithFormat:@"%lu", (unsigned long)i];
+    }
+    [rootView addSubview:view];
+  }
+  UIWindow *window = [[UIWindow alloc] initWithFrame:kGSCXScannerTestsWindowFrame];
+  [window addSubview:rootView];
+  GSCXScanOptions *options = [GSCXScanOptions defaultOptions];
+  options.measuresCheckCosts = YES;
+  GTXHierarchyResultCollection *serialResult = [scanner scanRootViews:@[ rootView ]
+                                                              options:options];
+  options.evaluatesSnapshotChecksInParallel = YES;
+
+  GTXHierarchyResultCollection *result = [scanner scanRootViews:@[ rootView ] options:options];
+
+  XCTAssertEqual(result.elementResults.count, serialResult.elementResults.count);
+  XCTAssertEqual([result checkResultCount], [serialResult checkResultCount]);
+  for (NSUInteger i = 0; i < result.elementResults.count; i++) {
+    GTXElementResultCollection *elementResult = result.elementResults[i];
+    GTXElementResultCollection *serialElementResult = serialResult.elementResults[i];
+    XCTAssertEqualObjects(elementResult.elementReference.accessibilityIdentifier,
+                          serialElementResult.elementReference.accessibilityIdentifier);
+    XCTAssertTrue(CGRectEqualToRect(elementResult.elementReference.accessibilityFrame,
+                                    serialElementResult.elementReference.accessibilityFrame));
+    XCTAssertEqual(elementResult.checkResults.count, serialElementResult.checkResults.count);
+  }
+  XCTAssertTrue([scanner.checkCostModel hasCostForCheckNamed:@"Snapshot"]);
+}
+
+- (void)testSnapshotChecksShareAttributeCache {
+  GSCXSnapshotCheckBlock block = ^BOOL(GSCXElementSnapshot *snapshot) {
+    return YES;
+  };
+  GSCXScanner *scanner = [GSCXScanner
+      scannerWithChecks:@[
+        [GSCXSnapshotCheck checkWithName:@"Snapshot1" errorDescription:@"" block:block],
+        [GSCXSnapshotCheck checkWithName:@"Snapshot2" errorDescription:@"" block:block],
+      ]
+           excludeLists:@[]];
+  UIView *rootView = [[UIView alloc] initWithFrame:kGSCXScannerTestsRootViewFrame];
+  [rootView addSubview:[GSCXScannerTests gscxtest_checkFailingAccessibleView]];
+  UIWindow *window = [[UIWindow alloc] initWithFrame:kGSCXScannerTestsWindowFrame];
+  [window addSubview:rootView];
+
+  [scanner scanRootViews:@[ rootView ]];
+
+  XCTAssertNil([GSCXAttributeCache currentCache]);
+  XCTAssertGreaterThan(scanner.lastScanProfile.attributeCacheMissCount, 0ul);
+  XCTAssertEqual(scanner.lastScanProfile.attributeCacheHitCount,
+                 scanner.lastScanProfile.attributeCacheMissCount);
+  XCTAssertEqualWithAccuracy([scanner.lastScanProfile attributeCacheHitRate], 0.5, 1e-9);
+}
+
+- (void)testScanRestoresPreviousAttributeCache {
+  GSCXScanner *scanner = [GSCXScanner scannerWithChecks:@[ self.dummyCheck ] excludeLists:@[]];
+  UIView *rootView = [[UIView alloc] initWithFrame:kGSCXScannerTestsRootViewFrame];
+  [rootView addSubview:[GSCXScannerTests gscxtest_checkFailingAccessibleView]];
+  UIWindow *window = [[UIWindow alloc] initWithFrame:kGSCXScannerTestsWindowFrame];
+  [window addSubview:rootView];
+  GSCXAttributeCache *outerCache = [[GSCXAttributeCache alloc] init];
+  [GSCXAttributeCache setCurrentCache:outerCache];
+
+  [scanner scanRootViews:@[ rootView ]];
+
+  XCTAssertEqual([GSCXAttributeCache currentCache], outerCache);
+  [GSCXAttributeCache setCurrentCache:nil];
+}
+
 #pragma mark - GSCXScannerDelegate
 
 - (void)scannerWillBeginScan:(GSCXScanner *)scanner {
@@ -291,6 +843,14 @@ static const CGRect kGSCXScannerTestsWindowFrame = {{0, 0}, {44, 44}};
   self.scannerDidFinishScanWithResult(scanner, scanResult);
 }
 
+- (void)scanner:(GSCXScanner *)scanner
+    didInterruptScanWithReason:(GSCXScanInterruptionReason)reason
+              slowestCheckName:(nullable NSString *)checkName {
+  if (self.scannerDidInterruptScanBlock != nil) {
+    self.scannerDidInterruptScanBlock(scanner, reason, checkName);
+  }
+}
+
 #pragma mark - Private
 
 + (UIView *)gscxtest_checkFailingAccessibleView {
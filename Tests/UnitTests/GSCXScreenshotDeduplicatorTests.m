@@ -0,0 +1,207 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXScreenshotDeduplicator.h"
+
+#import <XCTest/XCTest.h>
+
+#import "GSCXTestCheckNames.h"
+#import "GTXHierarchyResultCollection+GSCXCompleteness.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * The time, in seconds, to wait for deduplication to complete.
+ */
+static const NSTimeInterval kGSCXScreenshotDeduplicatorTestsTimeout = 5.0;
+
+@interface GSCXScreenshotDeduplicatorTests : XCTestCase
+@end
+
+@implementation GSCXScreenshotDeduplicatorTests
+
+- (void)testHashOfSimilarImagesIsClose {
+  UIImage *image = [self gscx_gradientImageWithMarkerColor:nil];
+  UIImage *similarImage = [self gscx_gradientImageWithMarkerColor:[UIColor colorWithWhite:0.52
+                                                                                    alpha:1.0]];
+  UIImage *invertedImage = [self gscx_invertedGradientImage];
+  uint64_t hash = [GSCXScreenshotDeduplicator differenceHashOfImage:image];
+  uint64_t similarHash = [GSCXScreenshotDeduplicator differenceHashOfImage:similarImage];
+  uint64_t invertedHash = [GSCXScreenshotDeduplicator differenceHashOfImage:invertedImage];
+  XCTAssertLessThanOrEqual(__builtin_popcountll(hash ^ similarHash),
+                           kGSCXScreenshotDeduplicatorDefaultMaximumHammingDistance);
+  XCTAssertGreaterThan(__builtin_popcountll(hash ^ invertedHash),
+                       kGSCXScreenshotDeduplicatorDefaultMaximumHammingDistance);
+}
+
+- (void)testSimilarScreenshotsWithSameIssuesShareImage {
+  GSCXScreenshotDeduplicator *deduplicator = [[GSCXScreenshotDeduplicator alloc] init];
+  GTXHierarchyResultCollection *first =
+      [self gscx_resultWithIdentifier:@"A" screenshot:[self gscx_gradientImageWithMarkerColor:nil]];
+  UIColor *markerColor = [UIColor colorWithWhite:0.52 alpha:1.0];
+  GTXHierarchyResultCollection *second =
+      [self gscx_resultWithIdentifier:@"A"
+                           screenshot:[self gscx_gradientImageWithMarkerColor:markerColor]];
+  GTXHierarchyResultCollection *firstResult = [self gscx_deduplicate:first with:deduplicator];
+  GTXHierarchyResultCollection *secondResult = [self gscx_deduplicate:second with:deduplicator];
+  XCTAssertEqual(firstResult, first);
+  XCTAssertNotEqual(secondResult, second);
+  XCTAssertEqual(secondResult.screenshot, first.screenshot);
+  XCTAssertEqual(secondResult.elementResults.count, second.elementResults.count);
+}
+
+- (void)testSharedScreenshotResultKeepsCompleteness {
+  GSCXScreenshotDeduplicator *deduplicator = [[GSCXScreenshotDeduplicator alloc] init];
+  GTXHierarchyResultCollection *first =
+      [self gscx_resultWithIdentifier:@"A" screenshot:[self gscx_gradientImageWithMarkerColor:nil]];
+  GTXHierarchyResultCollection *second =
+      [self gscx_resultWithIdentifier:@"A" screenshot:[self gscx_gradientImageWithMarkerColor:nil]];
+  second.gscx_incomplete = YES;
+  second.gscx_throttledCheckNames = @[ kGSCXTestContrastRatioCheckName ];
+  [self gscx_deduplicate:first with:deduplicator];
+  GTXHierarchyResultCollection *secondResult = [self gscx_deduplicate:second with:deduplicator];
+  XCTAssertEqual(secondResult.screenshot, first.screenshot);
+  XCTAssertTrue(secondResult.gscx_isIncomplete);
+  XCTAssertEqualObjects(secondResult.gscx_throttledCheckNames,
+                        @[ kGSCXTestContrastRatioCheckName ]);
+}
+
+- (void)testSimilarScreenshotsWithDifferentIssuesKeepTheirImages {
+  GSCXScreenshotDeduplicator *deduplicator = [[GSCXScreenshotDeduplicator alloc] init];
+  GTXHierarchyResultCollection *first =
+      [self gscx_resultWithIdentifier:@"A" screenshot:[self gscx_gradientImageWithMarkerColor:nil]];
+  GTXHierarchyResultCollection *second =
+      [self gscx_resultWithIdentifier:@"B" screenshot:[self gscx_gradientImageWithMarkerColor:nil]];
+  GTXHierarchyResultCollection *third =
+      [self gscx_resultWithIdentifier:@"A" screenshot:[self gscx_invertedGradientImage]];
+  [self gscx_deduplicate:first with:deduplicator];
+  XCTAssertEqual([self gscx_deduplicate:second with:deduplicator], second);
+  XCTAssertEqual([self gscx_deduplicate:third with:deduplicator], third);
+}
+
+- (void)testReleasedScreenshotsAreNotRetained {
+  GSCXScreenshotDeduplicator *deduplicator = [[GSCXScreenshotDeduplicator alloc] init];
+  __weak UIImage *weakScreenshot = nil;
+  @autoreleasepool {
+    GTXHierarchyResultCollection *first =
+        [self gscx_resultWithIdentifier:@"A"
+                             screenshot:[self gscx_gradientImageWithMarkerColor:nil]];
+    weakScreenshot = first.screenshot;
+    [self gscx_deduplicate:first with:deduplicator];
+  }
+  GTXHierarchyResultCollection *second =
+      [self gscx_resultWithIdentifier:@"A" screenshot:[self gscx_gradientImageWithMarkerColor:nil]];
+  // Deduplication is serial, so the first result is no longer in use once the second completes.
+  XCTAssertEqual([self gscx_deduplicate:second with:deduplicator], second);
+  XCTAssertNil(weakScreenshot);
+}
+
+#pragma mark - Private
+
+/**
+ * Deduplicates @c result with @c deduplicator and waits for completion.
+ *
+ * @param result The result to deduplicate.
+ * @param deduplicator The deduplicator to use.
+ * @return The deduplicated result.
+ */
+- (GTXHierarchyResultCollection *)gscx_deduplicate:(GTXHierarchyResultCollection *)result
+                                              with:(GSCXScreenshotDeduplicator *)deduplicator {
+  XCTestExpectation *expectation = [self expectationWithDescription:@"Deduplication completed."];
+  __block GTXHierarchyResultCollection *deduplicatedResult = nil;
+  [deduplicator deduplicateResult:result
+                       completion:^(GTXHierarchyResultCollection *completedResult) {
+                         XCTAssertTrue([NSThread isMainThread]);
+                         deduplicatedResult = completedResult;
+                         [expectation fulfill];
+                       }];
+  [self waitForExpectations:@[ expectation ] timeout:kGSCXScreenshotDeduplicatorTestsTimeout];
+  return deduplicatedResult;
+}
+
+/**
+ * Draws a horizontal gradient from black to white, optionally with a small marker in the center.
+ *
+ * @param markerColor The color of the marker, or @c nil for no marker.
+ * @return The drawn image.
+ */
+- (UIImage *)gscx_gradientImageWithMarkerColor:(nullable UIColor *)markerColor {
+  return [self gscx_gradientImageInverted:NO markerColor:markerColor];
+}
+
+/**
+ * @return A horizontal gradient from white to black.
+ */
+- (UIImage *)gscx_invertedGradientImage {
+  return [self gscx_gradientImageInverted:YES markerColor:nil];
+}
+
+/**
+ * Draws a horizontal gradient, optionally with a small marker in the center.
+ *
+ * @param inverted @c YES if the gradient goes from white to black, @c NO if it goes from black to
+ *  white.
+ * @param markerColor The color of the marker, or @c nil for no marker.
+ * @return The drawn image.
+ */
+- (UIImage *)gscx_gradientImageInverted:(BOOL)inverted markerColor:(nullable UIColor *)markerColor {
+  const CGFloat width = 90.0;
+  const CGFloat height = 80.0;
+  UIGraphicsBeginImageContextWithOptions(CGSizeMake(width, height), YES, 1.0);
+  for (CGFloat x = 0; x < width; x++) {
+    CGFloat white = x / width;
+    [[UIColor colorWithWhite:(inverted ? 1.0 - white : white) alpha:1.0] setFill];
+    UIRectFill(CGRectMake(x, 0, 1, height));
+  }
+  if (markerColor != nil) {
+    [markerColor setFill];
+    UIRectFill(CGRectMake(width / 2.0 - 1.0, height / 2.0 - 1.0, 2, 2));
+  }
+  UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
+  UIGraphicsEndImageContext();
+  return image;
+}
+
+/**
+ * Constructs a scan result containing a single element failing a single check.
+ *
+ * @param identifier The accessibility identifier of the element.
+ * @param screenshot The screenshot of the result.
+ * @return A scan result containing a single element failing
+ *  @c kGSCXTestAccessibilityLabelCheckName.
+ */
+- (GTXHierarchyResultCollection *)gscx_resultWithIdentifier:(NSString *)identifier
+                                                 screenshot:(UIImage *)screenshot {
+  GTXElementReference *elementReference =
+      [[GTXElementReference alloc] initWithElementAddress:0
+                                             elementClass:[UIView class]
+                                       accessibilityLabel:@"Label"
+                                  accessibilityIdentifier:identifier
+                                       accessibilityFrame:CGRectMake(0, 0, 10, 10)
+                                       elementDescription:@"Description"];
+  GTXCheckResult *checkResult =
+      [[GTXCheckResult alloc] initWithCheckName:kGSCXTestAccessibilityLabelCheckName
+                               errorDescription:kGSCXTestAccessibilityLabelCheckDescription];
+  GTXElementResultCollection *elementResult =
+      [[GTXElementResultCollection alloc] initWithElement:elementReference
+                                             checkResults:@[ checkResult ]];
+  return [[GTXHierarchyResultCollection alloc] initWithElementResults:@[ elementResult ]
+                                                           screenshot:screenshot];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,176 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXSessionDiff.h"
+
+#import <XCTest/XCTest.h>
+
+#import "GSCXTestCheckNames.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface GSCXSessionDiffTests : XCTestCase
+@end
+
+@implementation GSCXSessionDiffTests
+
+- (void)testDiffOfEmptySessionsIsEmpty {
+  GSCXSessionDiff *diff = [GSCXSessionDiff diffWithBaseResults:@[] comparedResults:@[]];
+
+  XCTAssertEqual(diff.addedIssues.count, 0ul);
+  XCTAssertEqual(diff.removedIssues.count, 0ul);
+  XCTAssertEqual(diff.unchangedIssues.count, 0ul);
+}
+
+- (void)testDiffMatchesIssuesAcrossSessions {
+  NSString *labelCheckName = kGSCXTestAccessibilityLabelCheckName;
+  NSString *contrastCheckName = kGSCXTestContrastRatioCheckName;
+  NSArray<GTXHierarchyResultCollection *> *baseResults = @[
+    [self gscx_resultWithIdentifiers:@[ @"A", @"B" ] checkName:labelCheckName],
+  ];
+  // The compared session scans the same screen twice, and the unchanged element moved. Neither
+  // should affect the diff.
+  NSArray<GTXHierarchyResultCollection *> *comparedResults = @[
+    [self gscx_resultWithIdentifiers:@[ @"B", @"C" ] checkName:labelCheckName],
+    [self gscx_resultWithIdentifiers:@[ @"B" ] checkName:contrastCheckName],
+    [self gscx_resultWithIdentifiers:@[ @"B", @"C" ] checkName:labelCheckName],
+  ];
+
+  GSCXSessionDiff *diff = [GSCXSessionDiff diffWithBaseResults:baseResults
+                                               comparedResults:comparedResults];
+
+  XCTAssertEqual(diff.addedIssues.count, 2ul);
+  XCTAssertEqual(diff.removedIssues.count, 1ul);
+  XCTAssertEqual(diff.unchangedIssues.count, 1ul);
+  XCTAssertEqual(diff.unchangedIssues[0].occurrenceCount, 2ul);
+  XCTAssertEqual([diff.removedIssues[0] originalResultInResults:baseResults], baseResults[0]);
+  XCTAssertEqual([diff resultsContainingIssuesWithChange:GSCXSessionDiffChangeRemoved],
+                 baseResults);
+  XCTAssertEqual(diff.removedIssues[0].originalElementIndex, 0);
+  NSDictionary<NSString *, NSArray<GSCXUniqueIssue *> *> *addedByCheckName =
+      [diff issuesByCheckNameWithChange:GSCXSessionDiffChangeAdded];
+  XCTAssertEqual(addedByCheckName[kGSCXTestAccessibilityLabelCheckName].count, 1ul);
+  XCTAssertEqual(addedByCheckName[kGSCXTestContrastRatioCheckName].count, 1ul);
+  NSDictionary<NSNumber *, NSArray<GSCXUniqueIssue *> *> *addedByScreenIndex =
+      [diff issuesByScreenIndexWithChange:GSCXSessionDiffChangeAdded];
+  XCTAssertEqual(addedByScreenIndex[@0].count, 1ul);
+  XCTAssertEqual(addedByScreenIndex[@1].count, 1ul);
+  XCTAssertNil(addedByScreenIndex[@2]);
+}
+
+- (void)testIssuesAreGroupedByScreen {
+  NSString *labelCheckName = kGSCXTestAccessibilityLabelCheckName;
+  // The first and last scans show the same screen, and the last one has an extra issue.
+  NSArray<GTXHierarchyResultCollection *> *comparedResults = @[
+    [self gscx_resultWithIdentifiers:@[ @"A", @"B", @"C", @"D", @"E" ] checkName:labelCheckName],
+    [self gscx_resultWithIdentifiers:@[ @"Z" ] checkName:labelCheckName],
+    [self gscx_resultWithIdentifiers:@[ @"A", @"B", @"C", @"D", @"E", @"F" ]
+                           checkName:labelCheckName],
+  ];
+  GSCXSessionDiff *diff = [GSCXSessionDiff diffWithBaseResults:@[]
+                                               comparedResults:comparedResults];
+
+  NSDictionary<NSNumber *, NSArray<GSCXUniqueIssue *> *> *addedByScreenIndex =
+      [diff issuesByScreenIndexWithChange:GSCXSessionDiffChangeAdded];
+
+  XCTAssertEqual(addedByScreenIndex.count, 2ul);
+  XCTAssertEqual(addedByScreenIndex[@0].count, 6ul);
+  XCTAssertEqual(addedByScreenIndex[@0].lastObject.firstSeenScanIndex, 2ul);
+  XCTAssertEqual(addedByScreenIndex[@1].count, 1ul);
+  XCTAssertEqual([diff issuesByScreenIndexWithChange:GSCXSessionDiffChangeRemoved].count, 0ul);
+}
+
+- (void)testResultsWithChangeContainOnlyFirstOccurrences {
+  NSString *labelCheckName = kGSCXTestAccessibilityLabelCheckName;
+  NSArray<GTXHierarchyResultCollection *> *baseResults = @[
+    [self gscx_resultWithIdentifiers:@[ @"A" ] checkName:labelCheckName],
+  ];
+  NSArray<GTXHierarchyResultCollection *> *comparedResults = @[
+    [self gscx_resultWithIdentifiers:@[ @"A", @"B" ] checkName:labelCheckName],
+    [self gscx_resultWithIdentifiers:@[ @"A", @"B" ] checkName:labelCheckName],
+  ];
+  GSCXSessionDiff *diff = [GSCXSessionDiff diffWithBaseResults:baseResults
+                                               comparedResults:comparedResults];
+
+  NSArray<GTXHierarchyResultCollection *> *addedResults =
+      [diff resultsWithChange:GSCXSessionDiffChangeAdded];
+
+  XCTAssertEqual(addedResults.count, 1ul);
+  XCTAssertEqual(addedResults[0].elementResults.count, 1ul);
+  XCTAssertEqualObjects(addedResults[0].elementResults[0].elementReference.accessibilityIdentifier,
+                        @"B");
+  XCTAssertEqual([diff resultsWithChange:GSCXSessionDiffChangeRemoved].count, 0ul);
+}
+
+- (void)testDiffPerformance {
+  NSMutableArray<NSString *> *baseIdentifiers = [[NSMutableArray alloc] init];
+  NSMutableArray<NSString *> *comparedIdentifiers = [[NSMutableArray alloc] init];
+  for (NSUInteger i = 0; i < 2000; i++) {
+    [baseIdentifiers addObject:[NSString stringWithFormat:@"%lu", (unsigned long)i]];
+    [comparedIdentifiers addObject:[NSString stringWithFormat:@"%lu", (unsigned long)(i + 1000)]];
+  }
+  NSArray<GTXHierarchyResultCollection *> *baseResults = @[
+    [self gscx_resultWithIdentifiers:baseIdentifiers checkName:kGSCXTestAccessibilityLabelCheckName]
+  ];
+  NSArray<GTXHierarchyResultCollection *> *comparedResults = @[ [self
+      gscx_resultWithIdentifiers:comparedIdentifiers
+                       checkName:kGSCXTestAccessibilityLabelCheckName] ];
+  [self measureBlock:^{
+    GSCXSessionDiff *diff = [GSCXSessionDiff diffWithBaseResults:baseResults
+                                                 comparedResults:comparedResults];
+    XCTAssertEqual(diff.unchangedIssues.count, 1000ul);
+  }];
+}
+
+#pragma mark - Private
+
+/**
+ * Constructs a scan result with one element per identifier, each failing a single check. Elements
+ * are placed at a different frame in every result, so they are only matched by identifier.
+ *
+ * @param identifiers The accessibility identifiers of the elements.
+ * @param checkName The name of the check every element fails.
+ * @return The scan result.
+ */
+- (GTXHierarchyResultCollection *)gscx_resultWithIdentifiers:(NSArray<NSString *> *)identifiers
+                                                   checkName:(NSString *)checkName {
+  static CGFloat offset = 0;
+  offset++;
+  NSMutableArray<GTXElementResultCollection *> *elementResults = [[NSMutableArray alloc] init];
+  for (NSString *identifier in identifiers) {
+    GTXElementReference *elementReference =
+        [[GTXElementReference alloc] initWithElementAddress:0
+                                               elementClass:[UIView class]
+                                         accessibilityLabel:nil
+                                    accessibilityIdentifier:identifier
+                                         accessibilityFrame:CGRectMake(offset, 0, 10, 10)
+                                         elementDescription:identifier];
+    GTXCheckResult *checkResult = [[GTXCheckResult alloc] initWithCheckName:checkName
+                                                           errorDescription:@"Description"];
+    [elementResults addObject:[[GTXElementResultCollection alloc]
+                                  initWithElement:elementReference
+                                     checkResults:@[ checkResult ]]];
+  }
+  UIGraphicsBeginImageContextWithOptions(CGSizeMake(1.0, 1.0), YES, 1.0);
+  UIImage *screenshot = UIGraphicsGetImageFromCurrentImageContext();
+  UIGraphicsEndImageContext();
+  return [[GTXHierarchyResultCollection alloc] initWithElementResults:elementResults
+                                                           screenshot:screenshot];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
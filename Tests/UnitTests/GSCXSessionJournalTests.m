@@ -0,0 +1,208 @@
+//
+// Copyright 2020 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#import "GSCXSessionJournal.h"
+
+#import <XCTest/XCTest.h>
+
+#import "GTXHierarchyResultCollection+GSCXCompleteness.h"
+#import "GTXHierarchyResultCollection+GSCXScreenshot.h"
+#import "third_party/objective_c/GSCXScanner/Tests/Common/GSCXSessionJournalTestUtils.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface GSCXSessionJournalTests : XCTestCase
+
+/**
+ * A temporary directory sessions are created in. Removed after each test.
+ */
+@property(strong, nonatomic) NSURL *directory;
+
+/**
+ * An image passed to @c GTXHierarchyResultCollection initializers.
+ */
+@property(strong, nonatomic) UIImage *screenshot;
+
+@end
+
+@implementation GSCXSessionJournalTests
+
+- (void)setUp {
+  [super setUp];
+  NSString *directoryPath =
+      [NSTemporaryDirectory() stringByAppendingPathComponent:[NSUUID UUID].UUIDString];
+  self.directory = [NSURL fileURLWithPath:directoryPath isDirectory:YES];
+  UIGraphicsBeginImageContextWithOptions(CGSizeMake(4.0, 8.0), YES, 2.0);
+  self.screenshot = UIGraphicsGetImageFromCurrentImageContext();
+  UIGraphicsEndImageContext();
+}
+
+- (void)tearDown {
+  [[NSFileManager defaultManager] removeItemAtURL:self.directory error:nil];
+  [super tearDown];
+}
+
+- (void)testJournaledResultsAreRecovered {
+  GSCXSessionJournal *journal = [GSCXSessionJournal journalInDirectory:self.directory error:nil];
+  XCTAssertNotNil(journal);
+  GTXHierarchyResultCollection *first =
+      [GSCXSessionJournalTestUtils resultWithLabel:@"First"
+                                        screenshot:self.screenshot];
+  first.gscx_screenshotFrame = CGRectMake(1, 2, 4, 8);
+  first.gscx_incomplete = YES;
+  first.gscx_throttledCheckNames = @[ kGSCXSessionJournalTestUtilsCheckName ];
+  [journal appendResult:first];
+  [journal appendResult:[GSCXSessionJournalTestUtils resultWithLabel:nil
+                                                          screenshot:self.screenshot]];
+  GTXHierarchyResultCollection *replacement =
+      [GSCXSessionJournalTestUtils resultWithLabel:@"Replaced"
+                                        screenshot:self.screenshot];
+  [journal replaceResultAtIndex:1 withResult:replacement];
+  [GSCXSessionJournalTestUtils synchronizeJournal:journal inTestCase:self];
+
+  NSURL *sessionURL = [GSCXSessionJournal latestSessionInDirectory:self.directory];
+  XCTAssertEqualObjects(sessionURL.lastPathComponent, journal.sessionURL.lastPathComponent);
+  NSError *error;
+  NSArray<GTXHierarchyResultCollection *> *results =
+      [GSCXSessionJournal resultsOfSessionAtURL:sessionURL error:&error];
+  XCTAssertNil(error);
+  XCTAssertEqual(results.count, 2);
+  GTXElementReference *elementReference = results[0].elementResults[0].elementReference;
+  XCTAssertEqualObjects(elementReference.accessibilityLabel, @"First");
+  XCTAssertEqualObjects(elementReference.accessibilityIdentifier, @"Identifier");
+  XCTAssertEqual(elementReference.elementClass, [UILabel class]);
+  XCTAssert(CGRectEqualToRect(elementReference.accessibilityFrame, CGRectMake(1, 2, 3, 4)));
+  XCTAssertEqualObjects(results[0].elementResults[0].checkResults[0].checkName,
+                        kGSCXSessionJournalTestUtilsCheckName);
+  XCTAssertEqualObjects(results[0].elementResults[0].checkResults[0].errorDescription,
+                        kGSCXSessionJournalTestUtilsCheckDescription);
+  XCTAssertEqualObjects(results[1].elementResults[0].elementReference.accessibilityLabel,
+                        @"Replaced");
+  XCTAssert(CGRectEqualToRect(results[0].gscx_screenshotFrame, CGRectMake(1, 2, 4, 8)));
+  XCTAssertTrue(results[0].gscx_isIncomplete);
+  XCTAssertEqualObjects(results[0].gscx_throttledCheckNames,
+                        @[ kGSCXSessionJournalTestUtilsCheckName ]);
+  XCTAssertFalse(results[1].gscx_isIncomplete);
+  XCTAssertEqualObjects(results[1].gscx_throttledCheckNames, @[]);
+  XCTAssert(CGSizeEqualToSize(results[0].screenshot.size, self.screenshot.size));
+  XCTAssertEqual(results[0].screenshot.scale, self.screenshot.scale);
+  // Results sharing a screenshot before the session was journaled still share it.
+  XCTAssertEqual(results[0].screenshot, results[1].screenshot);
+  XCTAssertEqual([[[NSFileManager defaultManager] contentsOfDirectoryAtPath:sessionURL.path
+                                                                      error:nil] count],
+                 2);
+}
+
+- (void)testTornRecordsAreIgnored {
+  GSCXSessionJournal *journal = [GSCXSessionJournal journalInDirectory:self.directory error:nil];
+  [journal appendResult:[GSCXSessionJournalTestUtils resultWithLabel:@"First"
+                                                          screenshot:self.screenshot]];
+  [journal appendResult:[GSCXSessionJournalTestUtils resultWithLabel:@"Second"
+                                                          screenshot:self.screenshot]];
+  [GSCXSessionJournalTestUtils synchronizeJournal:journal inTestCase:self];
+
+  NSURL *journalURL = [journal.sessionURL URLByAppendingPathComponent:@"journal.bin"];
+  NSMutableData *data = [NSMutableData dataWithContentsOfURL:journalURL];
+  // Simulates the application terminating while the second record was being written.
+  data.length -= 5;
+  [data writeToURL:journalURL atomically:YES];
+  NSArray<GTXHierarchyResultCollection *> *results =
+      [GSCXSessionJournal resultsOfSessionAtURL:journal.sessionURL error:nil];
+  XCTAssertEqual(results.count, 1);
+  XCTAssertEqualObjects(results[0].elementResults[0].elementReference.accessibilityLabel,
+                        @"First");
+}
+
+- (void)testVersion1JournalsAreRead {
+  NSURL *sessionURL = [self.directory URLByAppendingPathComponent:@"version1.gscxsession"];
+  [[NSFileManager defaultManager] createDirectoryAtURL:sessionURL
+                           withIntermediateDirectories:YES
+                                            attributes:nil
+                                                 error:nil];
+  [UIImagePNGRepresentation(self.screenshot)
+      writeToURL:[sessionURL URLByAppendingPathComponent:@"screenshot_0.png"]
+      atomically:YES];
+  // An append record of a result without elements, in the format written before records stored
+  // completeness and throttled checks.
+  NSMutableData *payload = [[NSMutableData alloc] init];
+  uint8_t type = 0;
+  uint32_t index = 0;
+  NSData *fileName = [@"screenshot_0.png" dataUsingEncoding:NSUTF8StringEncoding];
+  uint32_t fileNameLength = (uint32_t)fileName.length;
+  double scale = self.screenshot.scale;
+  double frame[4] = {0, 0, 4, 8};
+  uint32_t elementCount = 0;
+  [payload appendBytes:&type length:sizeof(type)];
+  [payload appendBytes:&index length:sizeof(index)];
+  [payload appendBytes:&fileNameLength length:sizeof(fileNameLength)];
+  [payload appendData:fileName];
+  [payload appendBytes:&scale length:sizeof(scale)];
+  [payload appendBytes:frame length:sizeof(frame)];
+  [payload appendBytes:&elementCount length:sizeof(elementCount)];
+  uint32_t checksum = 2166136261u;
+  for (NSUInteger i = 0; i < payload.length; i++) {
+    checksum ^= ((const uint8_t *)payload.bytes)[i];
+    checksum *= 16777619u;
+  }
+  uint32_t header[2] = {(uint32_t)payload.length, checksum};
+  NSMutableData *journal = [[@"GSCXJRN1" dataUsingEncoding:NSUTF8StringEncoding] mutableCopy];
+  [journal appendBytes:header length:sizeof(header)];
+  [journal appendData:payload];
+  [journal writeToURL:[sessionURL URLByAppendingPathComponent:@"journal.bin"] atomically:YES];
+
+  NSArray<GTXHierarchyResultCollection *> *results =
+      [GSCXSessionJournal resultsOfSessionAtURL:sessionURL error:nil];
+  XCTAssertEqual(results.count, 1);
+  XCTAssertEqual(results[0].elementResults.count, 0);
+  XCTAssert(CGRectEqualToRect(results[0].gscx_screenshotFrame, CGRectMake(0, 0, 4, 8)));
+  XCTAssertFalse(results[0].gscx_isIncomplete);
+  XCTAssertEqualObjects(results[0].gscx_throttledCheckNames, @[]);
+}
+
+- (void)testOldSessionsAreRemoved {
+  for (NSUInteger i = 0; i < 3; i++) {
+    GSCXSessionJournal *journal = [GSCXSessionJournal journalInDirectory:self.directory error:nil];
+    [GSCXSessionJournalTestUtils synchronizeJournal:journal inTestCase:self];
+  }
+  NSURL *latestSessionURL = [GSCXSessionJournal latestSessionInDirectory:self.directory];
+  XCTAssertEqual([GSCXSessionJournal sessionsInDirectory:self.directory].count, 3);
+  [GSCXSessionJournal removeSessionsInDirectory:self.directory keepingLatestCount:1];
+  NSArray<NSURL *> *sessionURLs = [GSCXSessionJournal sessionsInDirectory:self.directory];
+  XCTAssertEqual(sessionURLs.count, 1);
+  XCTAssertEqualObjects(sessionURLs.firstObject.lastPathComponent,
+                        latestSessionURL.lastPathComponent);
+}
+
+- (void)testInvalidJournalIsRejected {
+  NSURL *sessionURL = [self.directory URLByAppendingPathComponent:@"invalid.gscxsession"];
+  [[NSFileManager defaultManager] createDirectoryAtURL:sessionURL
+                           withIntermediateDirectories:YES
+                                            attributes:nil
+                                                 error:nil];
+  [[@"not a journal" dataUsingEncoding:NSUTF8StringEncoding]
+      writeToURL:[sessionURL URLByAppendingPathComponent:@"journal.bin"]
+      atomically:YES];
+  NSError *error;
+  XCTAssertNil([GSCXSessionJournal resultsOfSessionAtURL:sessionURL error:&error]);
+  XCTAssertEqualObjects(error.domain, kGSCXSessionJournalErrorDomain);
+  XCTAssertEqual(error.code, GSCXSessionJournalErrorCodeInvalidJournal);
+  XCTAssertNil([GSCXSessionJournal
+      latestSessionInDirectory:[self.directory URLByAppendingPathComponent:@"missing"]]);
+}
+
+@end
+
+NS_ASSUME_NONNULL_END